@@ -0,0 +1,31 @@
+#include <cassert>
+#include <sstream>
+#include <string>
+
+// formatting is not part of the module on GCC 12, so this file includes the
+// header. The units come from module-test.cpp, which builds them through the
+// module: the two translation units agree on the types.
+#include "units-io.hpp"
+
+void run_module_io_tests
+(
+    si::meters<std::kilo> aLength,
+    si::newtons<> aForce,
+    si::units_t<double, si::r_one, si::reciprocal_quantity<si::time>> aRate
+)
+{
+    using namespace si;
+
+    assert( string_from(aLength) == "10³ m" );
+    assert( string_from(aForce) == "N" );
+    assert( string_from(aRate) == "Hz" );
+    assert( wstring_from(aLength) == L"10³ m" );
+
+    std::ostringstream theStream;
+    theStream << aLength << ' ' << aForce;
+    assert( theStream.str() == "1.5·10³ m 2 N" );
+
+    std::istringstream theInput{"4"};
+    theInput >> aForce;
+    assert( theInput && aForce == newtons<>{4.0} );
+}
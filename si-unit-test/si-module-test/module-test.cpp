@@ -0,0 +1,55 @@
+#include <cassert>
+
+// std::chrono and std::ratio come with the module
+import si;
+
+// compile-time unit tests, through the module
+namespace
+{
+
+using namespace si;
+using namespace si::literals;
+
+// core
+static_assert( meters<std::kilo>{2.0} + meters<>{500.0} == meters<>{2500.0}, "" );
+static_assert( meters<>{10.0} / seconds<>{2.0} == (units_t<double, r_one, divide_quantity<length, si::time>>{5.0}), "" );
+static_assert( units_cast<meters<std::milli, long long>>(meters<r_one, long long>{3}) == meters<std::milli, long long>{3000}, "" );
+
+// chrono
+static_assert( units_cast<seconds<std::milli>>(std::chrono::seconds{2}) == seconds<std::milli>{2000.0}, "" );
+static_assert( duration_cast<std::chrono::milliseconds>(seconds<>{1.5}) == std::chrono::milliseconds{1500}, "" );
+
+// math
+static_assert( square_root(meters<>{3.0} * meters<>{3.0}) == meters<>{3.0}, "" );
+static_assert( exponentiate<2>(meters<>{3.0}) == meters<>{3.0} * meters<>{3.0}, "" );
+
+// literals and constants
+static_assert( 1.5_m == meters<>{1.5}, "" );
+static_assert( 250_ms == milliseconds<long long>{250}, "" );
+static_assert( c<> > meters<>{299792457.0} / seconds<>{1.0}, "" );
+
+} // end of anonymous namespace
+
+// formatting, in module-io-test.cpp
+void run_module_io_tests
+(
+    si::meters<std::kilo> aLength,
+    si::newtons<> aForce,
+    si::units_t<double, si::r_one, si::reciprocal_quantity<si::time>> aRate
+);
+
+int main(int argc, const char * argv[])
+{
+    using namespace si;
+
+    meters<> theLength{1.5};
+    theLength += meters<std::milli>{500.0};
+    assert( theLength == meters<>{2.0} );
+    assert( absolute(meters<>{-2.0}) == meters<>{2.0} );
+    assert( sine(radians<>{0.0}).value() == 0.0 );
+    assert( absolute(volts<r_one, short>{-5}) == (volts<r_one, short>{5}) );
+
+    run_module_io_tests( meters<std::kilo>{1.5}, newtons<>{2.0}, 1.0 / seconds<>{0.5} );
+
+    return 0;
+}
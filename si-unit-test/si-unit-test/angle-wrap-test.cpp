@@ -0,0 +1,165 @@
+#include <cmath>
+#include <limits>
+#include <numbers>
+#include <vector>
+#include "helpers.hpp"
+#include "angle-wrap.hpp"
+#include "angle-wrap-test.hpp"
+
+// compile-time unit tests
+namespace
+{
+
+using namespace si;
+
+constexpr auto pi = std::numbers::pi;
+
+// the period in units of the interval
+static_assert( angle_period<double, r_one>::turn == 2 * pi, "" );
+static_assert( angle_period<double, std::milli>::turn == static_cast<double>(2000 * std::numbers::pi_v<long double>), "" );
+static_assert( angle_period<float, r_one>::turn == static_cast<float>(2 * pi), "" );
+
+// the high and middle parts have half the digits, and the parts sum to a turn
+static_assert( leading_bits(6.5L, 2) == 6.0L, "" );
+static_assert( angle_period<double, r_one>::high * 8388608.0 == static_cast<std::int64_t>(angle_period<double, r_one>::high * 8388608.0), "" );
+static_assert( angle_period<float, r_one>::high * 512.0f == static_cast<std::int32_t>(angle_period<float, r_one>::high * 512.0f), "" );
+static_assert( angle_period<double, r_one>::high + angle_period<double, r_one>::middle + angle_period<double, r_one>::low == 2 * pi, "" );
+
+// rounding without a branch
+static_assert( round_to_integer(2.5) == 2.0, "" );
+static_assert( round_to_integer(-3.5) == -4.0, "" );
+static_assert( round_to_integer(0.49f) == 0.0f, "" );
+
+// the half-open intervals
+static_assert( wrap_pi(radians<>{pi}) == radians<>{-pi}, "" );
+static_assert( wrap_pi(radians<>{-pi}) == radians<>{-pi}, "" );
+static_assert( wrap_pi(radians<>{1.0}) == radians<>{1.0}, "" );
+static_assert( wrap_pi(radians<std::milli>{-1000.0}) == radians<std::milli>{-1000.0}, "" );
+static_assert( wrap_pi(radians<std::milli>{angle_period<double, std::milli>::half}).value() == -angle_period<double, std::milli>::half, "" );
+static_assert( wrap_two_pi(radians<>{0.0}) == radians<>{0.0}, "" );
+static_assert( wrap_two_pi(radians<>{2 * pi}) == radians<>{0.0}, "" );
+static_assert( wrap_two_pi(radians<>{-1e-20}) == radians<>{0.0}, "" );
+static_assert( wrap_two_pi(radians<r_one, float>{1.0f}) == radians<r_one, float>{1.0f}, "" );
+static_assert( wrap_pi(radians<>{1e20}).value() >= -pi && wrap_pi(radians<>{1e20}).value() < pi, "" );
+
+// the shortest way around
+static_assert( angle_diff(radians<>{0.25}, radians<>{0.75}) == radians<>{-0.5}, "" );
+static_assert( std::is_same<decltype(angle_diff(radians<>{}, radians<std::milli>{})), radians<std::milli>>::value, "" );
+
+} // end of anonymous namespace
+
+void si::run_angle_wrap_tests()
+{
+    using namespace si;
+
+    // wrapped into the intervals, and equal to the input modulo a turn
+    {
+    for( int i = -20000; i <= 20000; ++i )
+    {
+        const double theValue = i * 0.731 + i * i * 1e-3;
+        const auto theWrapped = wrap_pi(radians<>{theValue}).value();
+        const auto theTurn = wrap_two_pi(radians<>{theValue}).value();
+        assert( theWrapped >= -pi && theWrapped < pi );
+        assert( theTurn >= 0 && theTurn < 2 * pi );
+        assert( std::abs(std::remainder(theWrapped - theValue, 2 * pi)) <= 1e-15 * (1 + std::abs(theValue)) );
+        assert( std::abs(std::remainder(theTurn - theValue, 2 * pi)) <= 1e-15 * (1 + std::abs(theValue)) );
+
+        const auto theMilli = wrap_pi(radians<std::milli, float>{static_cast<float>(theValue)}).value();
+        assert( theMilli >= -1000 * pi && theMilli < 1000 * pi );
+        assert( std::abs(std::remainder(static_cast<double>(theMilli) - static_cast<float>(theValue), 2000 * pi)) <= 1e-3 );
+    }
+    }
+
+    // beyond the exact turns, in range and equal to the input modulo a turn
+    {
+    for( const double theValue : {1e9, -1e9, 1e15, 1e20, -1e20, 1e300} )
+    {
+        const auto theWrapped = wrap_pi(radians<>{theValue}).value();
+        const auto theTurn = wrap_two_pi(radians<>{theValue}).value();
+        assert( theWrapped >= -pi && theWrapped < pi );
+        assert( theTurn >= 0 && theTurn < 2 * pi );
+        assert( std::abs(theWrapped - std::atan2(std::sin(theValue), std::cos(theValue))) <= 1e-15 );
+
+        const auto theMilli = wrap_pi(radians<std::milli>{theValue}).value();
+        assert( theMilli >= -1000 * pi && theMilli < 1000 * pi );
+    }
+    for( const float theValue : {1e6f, 3e7f, -1e20f, 1e38f} )
+    {
+        const auto theWrapped = wrap_pi(radians<r_one, float>{theValue}).value();
+        assert( theWrapped >= -static_cast<float>(pi) && theWrapped < static_cast<float>(pi) );
+        assert( std::abs(theWrapped - std::atan2(std::sin(double{theValue}), std::cos(double{theValue}))) <= 1e-6 );
+    }
+    assert( std::isnan(wrap_pi(radians<>{std::numeric_limits<double>::infinity()}).value()) );
+
+    std::vector<radians<>> theRadians{radians<>{1.0}, radians<>{1e20}, radians<>{-4.0}};
+    std::vector<radians<>> theWrapped(theRadians.size());
+    wrap_pi(std::span{theRadians}, std::span{theWrapped});
+    for( std::size_t i = 0; i < theRadians.size(); ++i )
+    {
+        assert( theWrapped[i] == wrap_pi(theRadians[i]) );
+    }
+    }
+
+    // the shortest way around across the cut
+    {
+    const auto theDiff = angle_diff(radians<>{pi - 0.1}, radians<>{-pi + 0.1});
+    assert( std::abs(theDiff.value() + 0.2) < 1e-12 );
+    const auto theMixed = angle_diff(radians<>{0.1}, radians<std::milli>{6183.185307179586});
+    assert( std::abs(theMixed.value() - 200) < 1e-9 );
+    }
+
+    // batch paths match the scalar functions
+    {
+    std::vector<radians<>> theRadians;
+    std::vector<radians<>> theOthers;
+    for( int i = 0; i < 37; ++i )
+    {
+        theRadians.push_back(radians<>{i * 0.9 - 15.0});
+        theOthers.push_back(radians<>{i * -1.7 + 4.0});
+    }
+    std::vector<radians<>> theWrapped(theRadians.size());
+    std::vector<radians<>> theTurns(theRadians.size());
+    std::vector<radians<>> theDiffs(theRadians.size());
+    wrap_pi(std::span{theRadians}, std::span{theWrapped});
+    wrap_two_pi(std::span{theRadians}, std::span{theTurns});
+    angle_diff(std::span{theRadians}, std::span{theOthers}, std::span{theDiffs});
+    for( std::size_t i = 0; i < theRadians.size(); ++i )
+    {
+        assert( theWrapped[i] == wrap_pi(theRadians[i]) );
+        assert( theTurns[i] == wrap_two_pi(theRadians[i]) );
+        assert( theDiffs[i] == angle_diff(theRadians[i], theOthers[i]) );
+    }
+    }
+
+    // unwrap recovers a phase ramp, in one call or in chunks
+    {
+    std::vector<radians<>> thePhase;
+    std::vector<radians<>> theWrapped;
+    for( int i = 0; i < 1000; ++i )
+    {
+        thePhase.push_back(radians<>{5e-4 * i * i - 3.0});
+        theWrapped.push_back(wrap_pi(thePhase.back()));
+    }
+    std::vector<radians<>> theWhole(theWrapped.size());
+    unwrap(std::span{theWrapped}, std::span{theWhole});
+
+    std::vector<radians<>> theChunked(theWrapped.size());
+    unwrapper<radians<>> theUnwrapper;
+    const std::span<const radians<>> theInput{theWrapped};
+    const std::span<radians<>> theOutput{theChunked};
+    theUnwrapper(theInput.subspan(0, 333), theOutput.subspan(0, 333));
+    theUnwrapper(theInput.subspan(333, 1), theOutput.subspan(333, 1));
+    theUnwrapper(theInput.subspan(334, 0), theOutput.subspan(334, 0));
+    theUnwrapper(theInput.subspan(334), theOutput.subspan(334));
+    for( std::size_t i = 0; i < thePhase.size(); ++i )
+    {
+        assert( std::abs(theWhole[i].value() - thePhase[i].value()) < 1e-12 );
+        assert( theChunked[i] == theWhole[i] );
+    }
+
+    // a new signal after reset starts from its own first sample
+    theUnwrapper.reset();
+    theUnwrapper(theInput.subspan(500), theOutput.subspan(0, 500));
+    assert( theChunked[0] == theWrapped[500] );
+    }
+}
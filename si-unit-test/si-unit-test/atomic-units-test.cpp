@@ -0,0 +1,96 @@
+#include <cstdint>
+#include <thread>
+#include <vector>
+#include "helpers.hpp"
+#include "atomic-units.hpp"
+#include "atomic-units-test.hpp"
+
+// compile-time unit tests
+namespace
+{
+
+using namespace si;
+
+template< typename AtomicT, typename UnitsT, typename = void >
+struct can_fetch_add : std::false_type {};
+
+template< typename AtomicT, typename UnitsT >
+struct can_fetch_add<AtomicT, UnitsT, std::void_t<decltype(std::declval<AtomicT&>().fetch_add(std::declval<UnitsT>()))>> : std::true_type {};
+
+// lock free for the arithmetic value types
+static_assert( atomic_units<joules<>>::is_always_lock_free, "" );
+static_assert( atomic_units<seconds<std::micro, std::int64_t>>::is_always_lock_free, "" );
+static_assert( sizeof(atomic_units<joules<>>) == sizeof(joules<>), "" );
+
+// only lossless conversions are added
+static_assert( can_fetch_add<atomic_units<joules<std::milli, std::int64_t>>, joules<r_one, std::int64_t>>::value, "" );
+static_assert( !can_fetch_add<atomic_units<joules<r_one, std::int64_t>>, joules<std::milli, std::int64_t>>::value, "" );
+static_assert( can_fetch_add<atomic_units<joules<>>, joules<std::kilo>>::value, "" );
+static_assert( !can_fetch_add<atomic_units<joules<>>, watts<>>::value, "" );
+
+// the shards are on separate cache lines
+static_assert( sizeof(sharded_atomic_units<joules<>, 8>) == 8 * cache_line_size, "" );
+static_assert( alignof(sharded_atomic_units<joules<>, 8>) == cache_line_size, "" );
+
+} // end of anonymous namespace
+
+void si::run_atomic_units_tests()
+{
+    using namespace si;
+
+    // single thread operations
+    {
+    using Milliseconds_t = seconds<std::milli, std::int64_t>;
+    atomic_units<Milliseconds_t> theTime;
+    assert( theTime.load() == Milliseconds_t{0} );
+    assert( theTime.fetch_add(seconds<r_one, std::int64_t>{2}) == Milliseconds_t{0} );
+    assert( theTime.fetch_sub(Milliseconds_t{500}) == Milliseconds_t{2000} );
+    assert( (theTime -= Milliseconds_t{250}) == Milliseconds_t{1250} );
+    assert( theTime.exchange(Milliseconds_t{7}) == Milliseconds_t{1250} );
+
+    auto theExpected = Milliseconds_t{8};
+    assert( !theTime.compare_exchange_strong(theExpected, Milliseconds_t{9}) );
+    assert( theExpected == Milliseconds_t{7} );
+    assert( theTime.compare_exchange_strong(theExpected, Milliseconds_t{9}) );
+    assert( Milliseconds_t{theTime} == Milliseconds_t{9} );
+
+    atomic_units<joules<>> theEnergy{joules<>{1.5}};
+    theEnergy += joules<std::kilo>{0.002};
+    assert( theEnergy.load() == joules<>{3.5} );
+    theEnergy = joules<>{0.25};
+    assert( theEnergy.load() == joules<>{0.25} );
+    }
+
+    // concurrent additions are not lost
+    {
+    constexpr int theThreadCount = 8;
+    constexpr int theAddCount = 20000;
+    atomic_units<joules<std::milli, std::int64_t>> theCount;
+    atomic_units<joules<>> theEnergy;
+    sharded_atomic_units<joules<>, 4> theSharded;
+    std::vector<std::thread> theThreads;
+    for( int i = 0; i < theThreadCount; ++i )
+    {
+        theThreads.emplace_back([&]
+        {
+            for( int j = 0; j < theAddCount; ++j )
+            {
+                theCount.fetch_add(joules<r_one, std::int64_t>{1});
+                theCount.fetch_sub(joules<std::milli, std::int64_t>{1});
+                theEnergy.fetch_add(joules<>{0.5});
+                theSharded.add(joules<std::milli>{250.0});
+                theSharded.subtract(joules<>{0.125});
+            }
+        });
+    }
+    for( auto& theThread : theThreads )
+    {
+        theThread.join();
+    }
+    assert( theCount.load() == (joules<std::milli, std::int64_t>{999 * theThreadCount * theAddCount}) );
+    assert( theEnergy.load() == joules<>{0.5 * theThreadCount * theAddCount} );
+    assert( theSharded.load() == joules<>{0.125 * theThreadCount * theAddCount} );
+    theSharded.reset();
+    assert( theSharded.load() == joules<>{0.0} );
+    }
+}
@@ -0,0 +1,8 @@
+#pragma once
+
+namespace si
+{
+
+void run_atomic_units_tests();
+
+} // end of namespace si
@@ -0,0 +1,111 @@
+#include <cmath>
+#include <numbers>
+#include <vector>
+#include "helpers.hpp"
+#include "binary-angle.hpp"
+#include "binary-angle-test.hpp"
+
+// compile-time unit tests
+namespace
+{
+
+using namespace si;
+
+constexpr auto pi = std::numbers::pi;
+
+// type traits
+static_assert( is_binary_angle<bam16>, "" );
+static_assert( !is_binary_angle<radians<>>, "" );
+static_assert( sizeof(bam16) == 2, "" );
+static_assert( bam16::digits == 16, "" );
+
+// special values
+static_assert( bam16::quarter_turn().value() == 0x4000, "" );
+static_assert( bam32::half_turn().value() == 0x80000000u, "" );
+static_assert( bam8::quarter_turn().value() == 0x40, "" );
+
+// arithmetic wraps around the turn
+static_assert( bam16::half_turn() + bam16::half_turn() == bam16::zero(), "" );
+static_assert( bam16{0x0010} - bam16{0x0020} == bam16{0xfff0}, "" );
+static_assert( -bam16::quarter_turn() == bam16{0xc000}, "" );
+
+// units_cast rounds to the nearest step and wraps
+static_assert( units_cast<bam16>(radians<>{pi / 2}) == bam16::quarter_turn(), "" );
+static_assert( units_cast<bam16>(radians<>{-pi / 2}) == bam16{0xc000}, "" );
+static_assert( units_cast<bam16>(radians<>{5 * pi / 2}) == bam16::quarter_turn(), "" );
+static_assert( units_cast<bam16>(radians<std::milli>{-3141.592653589793}) == bam16::half_turn(), "" );
+static_assert( units_cast<bam32>(radians<r_one, float>{0.0f}) == bam32::zero(), "" );
+static_assert( units_cast<radians<>>(bam16::half_turn()) == radians<>{pi}, "" );
+static_assert( units_cast<radians<std::milli>>(bam16::quarter_turn()).value() == 1000 * pi / 2, "" );
+
+// table lookups
+static_assert( binary_angle_sine_table.size() == 4097, "" );
+static_assert( sine(bam16::zero()) == scalar<r_one, float>{0.0f}, "" );
+static_assert( sine(bam16::quarter_turn()) == scalar<r_one, float>{1.0f}, "" );
+static_assert( cosine(bam32::zero()) == scalar<r_one, float>{1.0f}, "" );
+static_assert( cosine(bam8::half_turn()) == scalar<r_one, float>{-1.0f}, "" );
+
+} // end of anonymous namespace
+
+void si::run_binary_angle_tests()
+{
+    using namespace si;
+
+    // round trip within half a step
+    {
+    for( int i = -5000; i <= 5000; ++i )
+    {
+        const radians<> theAngle{i * 0.0123};
+        const auto theBinary = units_cast<bam32>(theAngle);
+        const auto theBack = units_cast<radians<>>(theBinary).value();
+        const auto theWrapped = std::remainder(theBack - theAngle.value(), 2 * pi);
+        assert( std::abs(theWrapped) <= pi / 4294967296.0 * 1.0001 );
+        assert( units_cast<bam16>(theAngle) == bam16{static_cast<std::uint16_t>((theBinary.value() + 0x8000u) >> 16)} || (theBinary.value() & 0xffff) == 0x8000 );
+    }
+    }
+
+    // interpolated trigonometry
+    {
+    double theError = 0;
+    for( std::uint32_t i = 0; i < 200000; ++i )
+    {
+        const bam32 theAngle{i * 21474u + (i >> 3)};
+        const double theRadians = units_cast<radians<>>(theAngle).value();
+        theError = std::max(theError, std::abs(sine(theAngle).value() - std::sin(theRadians)));
+        theError = std::max(theError, std::abs(cosine(theAngle).value() - std::cos(theRadians)));
+    }
+    assert( theError <= 4e-7 );
+
+    double theCoarseError = 0;
+    for( std::uint32_t i = 0; i < 65536; ++i )
+    {
+        const bam16 theAngle{static_cast<std::uint16_t>(i)};
+        theCoarseError = std::max(theCoarseError, std::abs(sine(theAngle).value() - std::sin(units_cast<radians<>>(theAngle).value())));
+    }
+    assert( theCoarseError <= 4e-7 );
+    }
+
+    // batch paths match the scalar functions
+    {
+    std::vector<radians<>> theRadians;
+    for( int i = 0; i < 37; ++i )
+    {
+        theRadians.push_back(radians<>{i * 0.9 - 15.0});
+    }
+    std::vector<bam16> theAngles(theRadians.size());
+    std::vector<radians<>> theBack(theRadians.size());
+    std::vector<scalar<r_one, float>> theSines(theRadians.size());
+    std::vector<scalar<r_one, float>> theCosines(theRadians.size());
+    convert(std::span{theRadians}, std::span{theAngles});
+    convert(std::span{theAngles}, std::span{theBack});
+    sine(std::span{theAngles}, std::span{theSines});
+    cosine(std::span{theAngles}, std::span{theCosines});
+    for( std::size_t i = 0; i < theRadians.size(); ++i )
+    {
+        assert( theAngles[i] == units_cast<bam16>(theRadians[i]) );
+        assert( theBack[i] == units_cast<radians<>>(theAngles[i]) );
+        assert( theSines[i] == sine(theAngles[i]) );
+        assert( theCosines[i] == cosine(theAngles[i]) );
+    }
+    }
+}
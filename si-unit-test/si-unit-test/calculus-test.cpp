@@ -0,0 +1,140 @@
+#include <iostream>
+#include <vector>
+#include "helpers.hpp"
+#include "calculus.hpp"
+#include "calculus-test.hpp"
+
+// compile-time unit tests
+namespace
+{
+
+using namespace si;
+
+using ns_t = seconds<std::nano, std::int64_t>;
+
+// integral_units
+static_assert( std::is_same<integral_units<const watts<>, ns_t>::quantity_t, energy>::value, "" );
+static_assert( std::is_same<integral_units<watts<>, ns_t>::interval_t, std::nano>::value, "" );
+
+// derivative_units
+static_assert( std::is_same<derivative_units<joules<>, const seconds<>>::quantity_t, power>::value, "" );
+
+constexpr watts<> thePowerValues[] = {watts<>{2.0}, watts<>{2.0}, watts<>{2.0}};
+constexpr seconds<> theTimeValues[] = {seconds<>{0.0}, seconds<>{1.0}, seconds<>{3.0}};
+constexpr auto theConstantPower = std::span<const watts<>>{thePowerValues};
+constexpr auto theConstantTimes = std::span<const seconds<>>{theTimeValues};
+
+// integrate_trapezoid
+static_assert( integrate_trapezoid(theConstantPower, theConstantTimes) == joules<>{6.0}, "" );
+
+// integrate_simpson
+static_assert( integrate_simpson(theConstantPower, theConstantTimes) == joules<>{6.0}, "" );
+
+} // end of anonymous namespace
+
+void si::run_calculus_tests()
+{
+    using namespace si;
+
+    // integrate_trapezoid, nanosecond timestamps
+    {
+    const std::vector<watts<>> thePower{watts<>{1.0}, watts<>{3.0}, watts<>{3.0}, watts<>{1.0}, watts<>{1.0}, watts<>{5.0}};
+    const std::vector<ns_t> theTimes{ns_t{0}, ns_t{1000000000}, ns_t{2000000000}, ns_t{4000000000}, ns_t{5000000000}, ns_t{5500000000}};
+    const joules<> theEnergy = integrate_trapezoid(std::span{thePower}, std::span{theTimes});
+    assert( theEnergy == joules<>{2.0 + 3.0 + 4.0 + 1.0 + 1.5} );
+    }
+
+    // integrate_trapezoid, fewer than two samples
+    {
+    const std::vector<watts<>> thePower{watts<>{1.0}};
+    const std::vector<seconds<>> theTimes{seconds<>{1.0}};
+    assert( integrate_trapezoid(std::span{thePower}, std::span{theTimes}) == joules<>{0.0} );
+    }
+
+    // integrate_trapezoid, integer values are halved once
+    {
+    using int_watts = watts<r_one, int>;
+    using int_seconds = seconds<r_one, int>;
+    const std::vector<int_watts> thePower{int_watts{1}, int_watts{2}, int_watts{2}};
+    const std::vector<int_seconds> theTimes{int_seconds{0}, int_seconds{1}, int_seconds{2}};
+    assert( integrate_trapezoid(std::span{thePower}, std::span{theTimes}).value() == 3 );
+    }
+
+    // integrate_simpson, exact for quadratics on irregular grids
+    {
+    std::vector<meters<>> theSamples;
+    std::vector<seconds<>> theTimes;
+    for( const auto t : {0.0, 0.5, 1.5, 2.0, 3.0, 4.0} )
+    {
+        theTimes.push_back(seconds<>{t});
+        theSamples.push_back(meters<>{t * t});
+    }
+    const auto theEven = integrate_simpson(std::span{theSamples}.first(5), std::span{theTimes}.first(5));
+    assert( std::abs(theEven.value() - 9.0) < 1e-12 );
+    const auto theOdd = integrate_simpson(std::span{theSamples}, std::span{theTimes});
+    assert( std::abs(theOdd.value() - 64.0 / 3.0) < 1e-12 );
+    }
+
+    // differentiate
+    {
+    const std::vector<joules<>> theCounter{joules<>{0.0}, joules<>{10.0}, joules<>{40.0}};
+    const std::vector<seconds<>> theTimes{seconds<>{0.0}, seconds<>{1.0}, seconds<>{4.0}};
+    std::vector<watts<>> theRates(2);
+    differentiate(std::span{theCounter}, std::span{theTimes}, std::span{theRates});
+    assert( theRates[0] == watts<>{10.0} );
+    assert( theRates[1] == watts<>{10.0} );
+    }
+
+    // gradient, exact for quadratics on irregular grids
+    {
+    const std::vector<meters<>> theSamples{meters<>{0.0}, meters<>{1.0}, meters<>{9.0}, meters<>{16.0}};
+    const std::vector<seconds<>> theTimes{seconds<>{0.0}, seconds<>{1.0}, seconds<>{3.0}, seconds<>{4.0}};
+    std::vector<divide_units<meters<>, seconds<>>> theRates(4);
+    gradient(std::span{theSamples}, std::span{theTimes}, std::span{theRates});
+    assert( theRates[0].value() == 1.0 );
+    assert( theRates[1].value() == 2.0 );
+    assert( theRates[2].value() == 6.0 );
+    assert( theRates[3].value() == 7.0 );
+    }
+
+    // running_integral matches integrate_trapezoid across chunks
+    {
+    const std::vector<watts<>> thePower{watts<>{1.0}, watts<>{3.0}, watts<>{3.0}, watts<>{1.0}, watts<>{1.0}, watts<>{5.0}};
+    const std::vector<ns_t> theTimes{ns_t{0}, ns_t{1000000000}, ns_t{2000000000}, ns_t{4000000000}, ns_t{5000000000}, ns_t{5500000000}};
+    running_integral<watts<>, ns_t> theIntegral;
+    theIntegral.push(std::span{thePower}.first(2), std::span{theTimes}.first(2));
+    theIntegral.push(thePower[2], theTimes[2]);
+    theIntegral.push(std::span{thePower}.subspan(3), std::span{theTimes}.subspan(3));
+    assert( theIntegral.total() == integrate_trapezoid(std::span{thePower}, std::span{theTimes}) );
+    theIntegral.reset();
+    assert( theIntegral.total() == joules<>{0.0} );
+    }
+
+    // running_integral converts a chunk in other units to its own
+    {
+    const std::vector<watts<std::kilo>> thePower{watts<std::kilo>{1.0}, watts<std::kilo>{1.0}, watts<std::kilo>{3.0}};
+    const std::vector<seconds<>> theTimes{seconds<>{0.0}, seconds<>{1.0}, seconds<>{2.0}};
+    running_integral<watts<>, seconds<>> theIntegral;
+    theIntegral.push(std::span{thePower}, std::span{theTimes});
+    assert( theIntegral.total() == joules<>{3000.0} );
+    theIntegral.push(watts<>{3000.0}, seconds<>{3.0});
+    assert( theIntegral.total() == joules<>{6000.0} );
+    }
+
+    // running_derivative carries the last sample across chunks
+    {
+    const std::vector<joules<>> theCounter{joules<>{0.0}, joules<>{10.0}, joules<>{40.0}, joules<>{50.0}};
+    const std::vector<seconds<>> theTimes{seconds<>{0.0}, seconds<>{1.0}, seconds<>{4.0}, seconds<>{9.0}};
+    running_derivative<joules<>, seconds<>> theDerivative;
+    std::vector<watts<>> theRates(4);
+    assert( theDerivative.push(std::span{theCounter}.first(2), std::span{theTimes}.first(2), std::span{theRates}) == 1 );
+    assert( theDerivative.push(std::span{theCounter}.subspan(2), std::span{theTimes}.subspan(2), std::span{theRates}.subspan(1)) == 2 );
+    assert( theRates[0] == watts<>{10.0} );
+    assert( theRates[1] == watts<>{10.0} );
+    assert( theRates[2] == watts<>{2.0} );
+    {
+    running_derivative<joules<>, seconds<>> theFirst;
+    assert( !theFirst.push(joules<>{1.0}, seconds<>{1.0}) );
+    }
+    }
+}
@@ -0,0 +1,124 @@
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <vector>
+#include "helpers.hpp"
+#include "column-file.hpp"
+#include "column-file-test.hpp"
+
+// compile-time unit tests
+namespace
+{
+
+using namespace si;
+
+static_assert( column_file_magic.size() == 8, "" );
+static_assert( column_chunk_record_size == 32, "" );
+
+} // end of anonymous namespace
+
+void si::run_column_file_tests()
+{
+    using namespace si;
+
+    const auto thePath = (std::filesystem::temp_directory_path() / "si-column-file-test.siucol").string();
+    using Times_t = seconds<std::nano, std::int64_t>;
+
+    // write two columns in interleaved chunks
+    {
+    column_file_writer theWriter{thePath};
+    assert( theWriter.good() );
+    for( int theChunk = 0; theChunk < 4; ++theChunk )
+    {
+        std::vector<Times_t> theTimes;
+        std::vector<watts<std::kilo>> thePower;
+        for( int i = 0; i < 100 + theChunk; ++i )
+        {
+            theTimes.push_back(Times_t{(theChunk * 1000 + i) * std::int64_t{1000000}});
+            thePower.push_back(watts<std::kilo>{theChunk * 10.0 + (i % 7)});
+        }
+        theWriter.write_chunk<Times_t>("time", theTimes);
+        theWriter.write_chunk<watts<std::kilo>>("power", thePower);
+    }
+    theWriter.write_chunk<meters<>>("empty", {});
+    assert( theWriter.close() );
+    }
+
+    // read in place, with statistics
+    {
+    const auto theReader = column_file_reader::open(thePath);
+    assert( theReader );
+    assert( theReader->column_count() == 3 );
+    assert( theReader->column_name(1) == "power" );
+
+    const auto theTimes = theReader->column<Times_t>("time");
+    assert( theTimes && theTimes->is_native() );
+    assert( theTimes->chunk_count() == 4 && theTimes->size() == 406 );
+    assert( theTimes->chunk(2).size() == 102 );
+    assert( theTimes->chunk(2)[5] == (Times_t{2005000000}) );
+    assert( theTimes->chunk_minimum(3) == (Times_t{3000000000}) );
+    assert( theTimes->chunk_maximum(3) == (Times_t{3102000000}) );
+
+    // a range query skips the chunks that cannot match
+    const auto thePower = theReader->column<watts<std::kilo>>("power");
+    assert( thePower );
+    std::size_t theMatches = 0;
+    for( std::size_t i = 0; i < thePower->chunk_count(); ++i )
+    {
+        if( thePower->may_contain(i, watts<std::kilo>{17.0}, watts<std::kilo>{22.0}) )
+        {
+            ++theMatches;
+        }
+    }
+    assert( theMatches == 1 );
+
+    // another interval converts when read
+    const auto theWatts = theReader->column<watts<>>("power");
+    assert( theWatts && !theWatts->is_native() );
+    std::vector<watts<>> theConverted(theWatts->chunk_size(1));
+    theWatts->read_chunk(1, theConverted);
+    assert( theConverted[3] == watts<>{13000.0} );
+    assert( theWatts->chunk_maximum(1) == watts<>{16000.0} );
+
+    const auto theSeconds = theReader->column<seconds<r_one, std::int64_t>>("time");
+    assert( theSeconds && theSeconds->chunk_minimum(1) == (seconds<r_one, std::int64_t>{1}) );
+
+    // another quantity or value type, or a missing column, is refused
+    assert( !theReader->column<joules<std::kilo>>("power") );
+    assert( (!theReader->column<watts<std::kilo, float>>("power")) );
+    assert( !theReader->column<watts<>>("voltage") );
+    assert( theReader->column<meters<>>("empty")->size() == 0 );
+    }
+
+    // NaN is left out of the statistics, so a range query still finds the
+    // other values of its chunk
+    {
+    const auto theNaN = std::numeric_limits<double>::quiet_NaN();
+    const auto theNaNPath = (std::filesystem::temp_directory_path() / "si-column-file-nan-test.siucol").string();
+    {
+    column_file_writer theWriter{theNaNPath};
+    const std::vector<meters<>> theLengths{meters<>{5.0}, meters<>{theNaN}, meters<>{1.0}, meters<>{3.0}};
+    const std::vector<meters<>> theNaNs{meters<>{theNaN}, meters<>{theNaN}};
+    theWriter.write_chunk<meters<>>("length", theLengths);
+    theWriter.write_chunk<meters<>>("length", theNaNs);
+    assert( theWriter.close() );
+    }
+    const auto theReader = column_file_reader::open(theNaNPath);
+    const auto theLengths = theReader->column<meters<>>("length");
+    assert( theLengths->chunk_minimum(0) == meters<>{1.0} );
+    assert( theLengths->chunk_maximum(0) == meters<>{5.0} );
+    assert( theLengths->may_contain(0, meters<>{4.5}, meters<>{5.5}) );
+    assert( !theLengths->may_contain(0, meters<>{5.5}, meters<>{6.0}) );
+    assert( theLengths->may_contain(1, meters<>{4.5}, meters<>{5.5}) );
+    std::filesystem::remove(theNaNPath);
+    }
+
+    // a truncated file does not open
+    {
+    std::filesystem::resize_file(thePath, std::filesystem::file_size(thePath) - 4);
+    assert( !column_file_reader::open(thePath) );
+    std::filesystem::remove(thePath);
+    assert( !column_file_reader::open(thePath) );
+    }
+}
@@ -0,0 +1,118 @@
+#include <cmath>
+#include <complex>
+#include <iostream>
+#include <numbers>
+#include <vector>
+#include "helpers.hpp"
+#include "complex.hpp"
+#include "complex-test.hpp"
+
+// compile-time unit tests
+namespace
+{
+
+using namespace si;
+
+using cd = std::complex<double>;
+using cf = std::complex<float>;
+using phasor_volts = volts<r_one, cd>;
+using phasor_amperes = amperes<r_one, cd>;
+using phasor_ohms = ohms<r_one, cd>;
+
+// complex value_t
+static_assert( is_complex<cd>, "" );
+static_assert( !is_complex<double>, "" );
+static_assert( is_units_value<cf>, "" );
+static_assert( std::is_same<real_value_t<cf>, float>::value, "" );
+static_assert( std::is_same<real_value_t<int>, int>::value, "" );
+
+// common_type promotion
+static_assert( std::is_same<common_value_t<cf, double>, cd>::value, "" );
+static_assert( std::is_same<common_value_t<cd, int>, cd>::value, "" );
+static_assert( std::is_same<common_value_t<float, double>, double>::value, "" );
+static_assert( std::is_same<std::common_type_t<volts<r_one, cf>, volts<std::milli, double>>, volts<std::milli, cd>>::value, "" );
+
+// arithmetic keeps the units
+static_assert( std::is_same<decltype(phasor_volts{} / phasor_amperes{}), phasor_ohms>::value, "" );
+static_assert( std::is_same<decltype(absolute(phasor_volts{})), volts<>>::value, "" );
+static_assert( std::is_same<decltype(phase(phasor_volts{})), radians<>>::value, "" );
+
+// a complex value is not narrowed to a real one
+static_assert( std::is_constructible<phasor_volts, volts<>>::value, "" );
+static_assert( !std::is_constructible<volts<>, phasor_volts>::value, "" );
+static_assert( std::is_constructible<phasor_volts, cd>::value, "" );
+static_assert( !std::is_constructible<volts<>, cd>::value, "" );
+
+// constexpr
+static_assert( conj(phasor_volts{cd{1.0, 2.0}}) == phasor_volts{cd{1.0, -2.0}}, "" );
+static_assert( units_cast<volts<std::milli, cd>>(phasor_volts{cd{1.0, 2.0}}) == volts<std::milli, cd>{cd{1000.0, 2000.0}}, "" );
+
+bool
+near
+(
+    cd aLHS,
+    cd aRHS
+)
+{
+    return std::abs(aLHS - aRHS) < 1e-12;
+}
+
+} // end of anonymous namespace
+
+void si::run_complex_tests()
+{
+    using namespace si;
+
+    // Ohm's law on phasors
+    {
+    const phasor_volts theVoltage{cd{10.0, 0.0}};
+    const phasor_ohms theImpedance{cd{3.0, 4.0}};
+    const auto theCurrent = theVoltage / theImpedance;
+    assert( near(theCurrent.value(), cd{1.2, -1.6}) );
+    assert( std::abs(magnitude(theCurrent).value() - 2.0) < 1e-12 );
+    assert( absolute(theImpedance) == ohms<>{5.0} );
+    assert( std::abs(phase(theImpedance).value() - std::atan2(4.0, 3.0)) < 1e-12 );
+    const auto thePower = theVoltage * conj(theCurrent);
+    assert( near(thePower.value(), cd{12.0, 16.0}) );
+    }
+
+    // polar form
+    {
+    const auto thePhasor = polar(volts<>{2.0}, radians<std::milli>{500.0 * std::numbers::pi});
+    assert( near(thePhasor.value(), cd{0.0, 2.0}) );
+    assert( std::abs(phase(thePhasor).value() - std::numbers::pi / 2) < 1e-12 );
+    }
+
+    // mixed real and complex values
+    {
+    const auto theSum = phasor_volts{cd{1.0, 1.0}} + volts<>{2.0};
+    assert( near(theSum.value(), cd{3.0, 1.0}) );
+    const auto theScaled = phasor_amperes{cd{1.0, 1.0}} * 2.0;
+    assert( near(theScaled.value(), cd{2.0, 2.0}) );
+    const volts<r_one, cf> theFloat{cf{1.0f, 0.5f}};
+    const auto thePromoted = theFloat * amperes<>{2.0};
+    static_assert( std::is_same<decltype(thePromoted)::value_t, cd>::value, "" );
+    assert( near(thePromoted.value(), cd{2.0, 1.0}) );
+    }
+
+    // span kernels match scalar arithmetic
+    {
+    std::vector<phasor_amperes> theCurrents;
+    std::vector<phasor_ohms> theImpedances;
+    for( int i = 0; i < 37; ++i )
+    {
+        theCurrents.push_back(phasor_amperes{cd{i * 0.5, 1.0 - i}});
+        theImpedances.push_back(phasor_ohms{cd{1.0 + i, i * 0.25 - 2.0}});
+    }
+
+    std::vector<phasor_volts> theVoltages(theCurrents.size());
+    multiply(std::span{theCurrents}, std::span{theImpedances}, theVoltages);
+    std::vector<phasor_amperes> theQuotients(theCurrents.size());
+    divide(std::span{theVoltages}, std::span{theImpedances}, theQuotients);
+    for( std::size_t i = 0; i < theCurrents.size(); ++i )
+    {
+        assert( near(theVoltages[i].value(), (theCurrents[i] * theImpedances[i]).value()) );
+        assert( near(theQuotients[i].value(), theCurrents[i].value()) );
+    }
+    }
+}
@@ -0,0 +1,111 @@
+#include <cmath>
+#include <limits>
+#include "helpers.hpp"
+#include "constexpr-math.hpp"
+#include "units-math.hpp"
+#include "constexpr-math-test.hpp"
+
+// compile-time unit tests
+namespace
+{
+
+using namespace si;
+
+// square root is correctly rounded
+static_assert( constexpr_sqrt(4.0) == 2.0, "" );
+static_assert( constexpr_sqrt(2.0) == 1.4142135623730951, "" );
+static_assert( constexpr_sqrt(1e-300) == 1e-150, "" );
+static_assert( constexpr_sqrt(0.0) == 0.0, "" );
+static_assert( constexpr_sqrt(std::numeric_limits<double>::infinity()) == std::numeric_limits<double>::infinity(), "" );
+static_assert( constexpr_sqrt(-1.0) != constexpr_sqrt(-1.0), "" );
+static_assert( constexpr_sqrt(std::numeric_limits<double>::denorm_min()) == 2.2227587494850775e-162, "" );
+
+// exact points
+static_assert( constexpr_sin(0.0) == 0.0, "" );
+static_assert( constexpr_cos(0.0) == 1.0, "" );
+static_assert( constexpr_atan2(0.0, -1.0) == 3.141592653589793, "" );
+static_assert( constexpr_atan(1.0) == 0.7853981633974483, "" );
+static_assert( constexpr_asin(1.0) == 1.5707963267948966, "" );
+static_assert( constexpr_acos(1.0) == 0.0, "" );
+
+// large arguments are reduced exactly, matching std::sin and std::cos
+static_assert( constexpr_sin(1e9) == 0.54584344944869956, "" );
+static_assert( constexpr_sin(1e15) == 0.85827279317023586, "" );
+static_assert( constexpr_cos(1e15) == -0.51319373778697031, "" );
+static_assert( constexpr_sin(1e300) == -0.81788191211590855, "" );
+static_assert( constexpr_sin(-1e15) == -0.85827279317023586, "" );
+static_assert( constexpr_sin(std::numeric_limits<double>::infinity()) != constexpr_sin(std::numeric_limits<double>::infinity()), "" );
+
+// the error in units of the last place of aExpected
+double
+ulps
+(
+    double aActual,
+    long double aExpected
+)
+{
+    const auto theExpected = static_cast<double>(aExpected);
+    const auto theMagnitude = std::fabs(theExpected);
+    const auto theULP = std::nextafter(theMagnitude, std::numeric_limits<double>::infinity()) - theMagnitude;
+    return static_cast<double>(std::fabs(static_cast<long double>(aActual) - aExpected) / theULP);
+}
+
+} // end of anonymous namespace
+
+void si::run_constexpr_math_tests()
+{
+    using namespace si;
+
+    // square root matches std::sqrt exactly
+    for( int i = -1074; i < 1024; ++i )
+    {
+        for( double m = 1.0; m < 2.0; m += 0.0371 )
+        {
+            const double x = std::ldexp(m, i);
+            assert( constexpr_sqrt(x) == std::sqrt(x) );
+        }
+    }
+
+    // trigonometry error bounds
+    double theError = 0;
+    double theTangentError = 0;
+    double theInverseError = 0;
+    for( int i = -20000; i <= 20000; ++i )
+    {
+        const double x = i * 0.00499;
+        theError = std::max(theError, ulps(constexpr_sin(x), std::sin(static_cast<long double>(x))));
+        theError = std::max(theError, ulps(constexpr_cos(x), std::cos(static_cast<long double>(x))));
+        theTangentError = std::max(theTangentError, ulps(constexpr_tan(x), std::tan(static_cast<long double>(x))));
+
+        const double y = i / 20000.5;
+        theInverseError = std::max(theInverseError, ulps(constexpr_asin(y), std::asin(static_cast<long double>(y))));
+        theInverseError = std::max(theInverseError, ulps(constexpr_acos(y), std::acos(static_cast<long double>(y))));
+        theInverseError = std::max(theInverseError, ulps(constexpr_atan(x), std::atan(static_cast<long double>(x))));
+    }
+    assert( theError <= 1.5 );
+
+    // the reduction of Payne and Hanek beyond |x| = 100, over every exponent
+    double theFarError = 0;
+    for( int i = 7; i < 1024; ++i )
+    {
+        for( double m = 1.0; m < 2.0; m += 0.0371 )
+        {
+            const double x = std::ldexp(m, i);
+            theFarError = std::max(theFarError, ulps(constexpr_sin(x), std::sin(x)));
+            theFarError = std::max(theFarError, ulps(constexpr_cos(-x), std::cos(-x)));
+        }
+    }
+    assert( theFarError <= 1.0 );
+    assert( constexpr_sin(1e9) == std::sin(1e9) );
+    assert( constexpr_sin(1e15) == std::sin(1e15) );
+
+    // sine and cosine folded at compile time agree with the run time
+    constexpr auto theFoldedSine = sine(radians<>{1e9});
+    constexpr auto theFoldedCosine = cosine(radians<>{1e15});
+    volatile double theRuntimeRadians = 1e9;
+    assert( theFoldedSine == sine(radians<>{theRuntimeRadians}) );
+    assert( theFoldedSine.value() == std::sin(1e9) );
+    assert( theFoldedCosine.value() == std::cos(1e15) );
+    assert( theTangentError <= 3.5 );
+    assert( theInverseError <= 3.5 );
+}
@@ -0,0 +1,8 @@
+#pragma once
+
+namespace si
+{
+
+void run_constexpr_math_tests();
+
+} // end of namespace si
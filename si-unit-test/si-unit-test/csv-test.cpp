@@ -0,0 +1,143 @@
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+#include "helpers.hpp"
+#include "csv.hpp"
+#include "csv-test.hpp"
+
+// compile-time unit tests
+namespace
+{
+
+using namespace si;
+
+static_assert( csv_reader<watts<>, seconds<>>::column_count == 2, "" );
+static_assert( std::is_same<csv_reader<watts<>, seconds<>>::units_type<1>, seconds<>>::value, "" );
+
+} // end of anonymous namespace
+
+void si::run_csv_tests()
+{
+    using namespace si;
+
+    const auto thePath = (std::filesystem::temp_directory_path() / "si-csv-test.csv").string();
+    using Milliseconds_t = seconds<std::milli, std::int64_t>;
+
+    // header cells
+    {
+    const auto thePower = parse_csv_column(" \"power [kW]\" ");
+    assert( thePower.name == "power" );
+    assert( thePower.symbol == "kW" );
+    assert( thePower.unit == unit_descriptor_of<watts<std::kilo>>() );
+    const auto theTime = parse_csv_column("time (ms)");
+    assert( theTime.name == "time" && theTime.symbol == "ms" );
+    const auto theCount = parse_csv_column("count");
+    assert( theCount.name == "count" && theCount.symbol.empty() );
+    assert( (theCount.unit == unit_descriptor_of<units_t<double, r_one, none>>()) );
+    assert( !parse_csv_column("site [north]").unit );
+    }
+
+    // write and read back in batches
+    {
+    constexpr std::int64_t theRowCount = 10000;
+    std::vector<Milliseconds_t> theTimes;
+    std::vector<watts<std::kilo>> thePower;
+    for( std::int64_t i = 0; i < theRowCount; ++i )
+    {
+        theTimes.push_back(Milliseconds_t{1700000000000 + i * 250});
+        thePower.push_back(watts<std::kilo>{0.1 * static_cast<double>(i) - 3.0});
+    }
+    {
+    csv_writer<Milliseconds_t, watts<std::kilo>> theWriter{thePath, {"time", "power"}};
+    theWriter.write(theTimes, thePower);
+    assert( theWriter.close() );
+    }
+
+    std::ifstream theFile{thePath};
+    std::string theHeader;
+    std::getline(theFile, theHeader);
+    assert( theHeader == "time [ms],power [kW]" );
+
+    auto theReader = csv_reader<watts<std::kilo>, Milliseconds_t>::open(thePath, {"power", "time"}, 3000);
+    assert( theReader );
+    std::size_t theRead = 0;
+    while( const auto theRows = theReader->next() )
+    {
+        const auto thePowerBatch = theReader->column<0>();
+        const auto theTimeBatch = theReader->column<1>();
+        assert( thePowerBatch.size() == theRows && theTimeBatch.size() == theRows );
+        for( std::size_t i = 0; i < theRows; ++i )
+        {
+            assert( thePowerBatch[i] == thePower[theRead + i] );
+            assert( theTimeBatch[i] == theTimes[theRead + i] );
+        }
+        theRead += theRows;
+    }
+    assert( theReader->good() );
+    assert( theRead == theRowCount );
+
+    // converted while read, and columns of other quantities refused
+    auto theWatts = csv_reader<watts<>, seconds<>>::open(thePath, {"power", "time"}, theRowCount);
+    assert( theWatts && theWatts->next() == theRowCount );
+    assert( theWatts->column<0>()[40] == watts<>{1000.0} );
+    assert( theWatts->column<1>()[2] == seconds<>{1700000000.5} );
+    assert( (!csv_reader<joules<>>::open(thePath, {"power"})) );
+    assert( (!csv_reader<watts<>>::open(thePath, {"energy"})) );
+    }
+
+    // TSV with skipped columns, CRLF line ends and a long line
+    {
+    {
+    std::ofstream theFile{thePath, std::ios::binary};
+    theFile << "site\tt (s)\tspeed [km/h]\r\n";
+    theFile << "north\t1\t36\r\n";
+    theFile << "\r\n";
+    theFile << std::string(3 * csv_chunk_size, 'x') << "\t2\t-72\r\n";
+    theFile << "south\t4\t0";
+    }
+    using Speed_t = units_t<double, r_one, divide_quantity<length, si::time>>;
+    auto theReader = csv_reader<Speed_t, Milliseconds_t>::open(thePath, {"speed", "t"}, 2, '\t');
+    assert( theReader );
+    assert( theReader->columns().size() == 3 );
+    assert( theReader->next() == 2 );
+    assert( theReader->column<0>()[0] == Speed_t{10.0} );
+    assert( theReader->column<0>()[1] == Speed_t{-20.0} );
+    assert( theReader->next() == 1 );
+    assert( theReader->column<1>()[0] == Milliseconds_t{4000} );
+    assert( theReader->next() == 0 );
+    assert( theReader->good() );
+    }
+
+    // a field that is not a number stops the reader at its line, after
+    // the rows before it
+    {
+    {
+    std::ofstream theFile{thePath, std::ios::binary};
+    theFile << "time [ms],power [W]\n1,2\n3,x\n5,6\n";
+    }
+    auto theReader = csv_reader<Milliseconds_t, watts<>>::open(thePath, {"time", "power"});
+    assert( theReader );
+    assert( theReader->next() == 1 );
+    assert( theReader->column<0>()[0] == Milliseconds_t{1} );
+    assert( theReader->column<1>()[0] == watts<>{2.0} );
+    assert( !theReader->good() );
+    assert( theReader->line() == 3 );
+    assert( theReader->next() == 0 );
+    assert( theReader->column<0>().size() == 0 );
+    }
+
+    // two UnitsT cannot be bound to one column
+    {
+    {
+    std::ofstream theFile{thePath, std::ios::binary};
+    theFile << "time [ms],power [W]\n1,2\n";
+    }
+    assert( (!csv_reader<watts<>, watts<>>::open(thePath, {"power", "power"})) );
+    assert( (csv_reader<watts<>, Milliseconds_t>::open(thePath, {"power", "time"})) );
+    }
+
+    std::filesystem::remove(thePath);
+    assert( (!csv_reader<watts<>>::open(thePath, {"power"})) );
+}
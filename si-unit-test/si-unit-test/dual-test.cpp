@@ -0,0 +1,121 @@
+#include <cmath>
+#include "helpers.hpp"
+#include "dual.hpp"
+#include "dual-test.hpp"
+
+// compile-time unit tests
+namespace
+{
+
+using namespace si;
+
+using d2 = dual<double, 2>;
+using length_t = meters<r_one, d2>;
+using duration_t = seconds<r_one, d2>;
+using mass_t = kilograms<r_one, d2>;
+
+// dual is a units_t value type
+static_assert( is_units_value<d2>, "" );
+static_assert( is_floating_value<d2>, "" );
+static_assert( sizeof(length_t) == 3 * sizeof(double), "" );
+
+// promotion
+static_assert( std::is_same<common_value_t<d2, double>, d2>::value, "" );
+static_assert( std::is_same<common_value_t<dual<float, 2>, double>, d2>::value, "" );
+static_assert( std::is_same<decltype(length_t{} / duration_t{})::value_t, d2>::value, "" );
+static_assert( std::is_same<decltype(length_t{} * 2.0)::value_t, d2>::value, "" );
+static_assert( std::is_same<decltype(square_root(length_t{} * length_t{})), length_t>::value, "" );
+static_assert( std::is_same<decltype(sine(radians<r_one, d2>{})), scalar<r_one, d2>>::value, "" );
+
+// derivatives have the units of the quotient
+static_assert( std::is_same<decltype(derivative<0>(joules<r_one, d2>{}, length_t{})), newtons<>>::value, "" );
+static_assert( std::is_same<decltype(derivative<1>(length_t{}, duration_t{})), decltype(meters<>{} / seconds<>{})>::value, "" );
+static_assert( std::is_same<decltype(primal(length_t{})), meters<>>::value, "" );
+
+// constexpr
+constexpr auto theX = independent<0, 2>(meters<>{3.0});
+constexpr auto theY = independent<1, 2>(meters<>{4.0});
+static_assert( derivative<0>(theX * theY, theX) == meters<>{4.0}, "" );
+static_assert( derivative<1>(theX * theY, theY) == meters<>{3.0}, "" );
+static_assert( derivative<0>(exponentiate<3>(theX), theX) == exponentiate<2>(meters<>{3.0}) * 3.0, "" );
+static_assert( derivative<0>(units_cast<meters<std::milli, d2>>(theX), theX).value() == 1000.0, "" );
+static_assert( primal(theX / theY) == 0.75, "" );
+
+bool
+near
+(
+    double aLHS,
+    double aRHS
+)
+{
+    return std::abs(aLHS - aRHS) < 1e-12;
+}
+
+} // end of anonymous namespace
+
+void si::run_dual_tests()
+{
+    using namespace si;
+
+    // gradient of kinetic energy with respect to mass and speed
+    {
+    using speed_t = decltype(meters<>{} / seconds<>{});
+    const auto theMass = independent<0, 2>(kilograms<>{2.0});
+    const auto theSpeed = independent<1, 2>(speed_t{3.0});
+    const auto theEnergy = theMass * exponentiate<2>(theSpeed) * 0.5;
+    assert( near(primal(theEnergy).value(), 9.0) );
+
+    const auto theEnergyPerMass = derivative<0>(theEnergy, theMass);
+    static_assert( std::is_same<decltype(theEnergyPerMass), const decltype(joules<>{} / kilograms<>{})>::value, "" );
+    assert( near(theEnergyPerMass.value(), 4.5) );
+
+    const auto theMomentum = derivative<1>(theEnergy, theSpeed);
+    static_assert( std::is_same<decltype(theMomentum), const decltype(kilograms<>{} * speed_t{})>::value, "" );
+    assert( near(theMomentum.value(), 6.0) );
+    }
+
+    // chain rule through square_root and division
+    {
+    const auto theX = independent<0, 2>(meters<>{3.0});
+    const auto theY = independent<1, 2>(meters<>{4.0});
+    const auto theDistance = square_root(theX * theX + theY * theY);
+    assert( near(primal(theDistance).value(), 5.0) );
+    assert( near(derivative<0>(theDistance, theX).value(), 0.6) );
+    assert( near(derivative<1>(theDistance, theY).value(), 0.8) );
+
+    const auto theRatio = theX / theY;
+    assert( near(derivative<0>(theRatio, theX).value(), 0.25) );
+    assert( near(derivative<1>(theRatio, theY).value(), -3.0 / 16.0) );
+    static_assert( std::is_same<decltype(derivative<0>(theRatio, theX)), decltype(1.0 / meters<>{})>::value, "" );
+    assert( near(derivative<0>(absolute(-theX), theX).value(), 1.0) );
+    }
+
+    // trigonometry, e.g. the velocity of a harmonic oscillator
+    {
+    const auto theTime = independent<0, 1>(seconds<>{0.25});
+    const auto theRate = radians<r_one, dual<double, 1>>{2.0} / seconds<>{1.0};
+    const auto thePosition = meters<>{1.5} * sine(theRate * theTime);
+    const auto theVelocity = derivative<0>(thePosition, theTime);
+    static_assert( std::is_same<decltype(theVelocity), const decltype(meters<>{} / seconds<>{})>::value, "" );
+    assert( near(theVelocity.value(), 1.5 * 2.0 * std::cos(0.5)) );
+
+    const auto theAngle = independent<0, 1>(radians<>{0.5});
+    assert( near(derivative<0>(cosine(theAngle), theAngle).value(), -std::sin(0.5)) );
+    assert( near(derivative<0>(tangent(theAngle), theAngle).value(), 1.0 / (std::cos(0.5) * std::cos(0.5))) );
+
+    const auto theRatio = independent<0, 1>(scalar<>{0.5});
+    assert( near(derivative<0>(arc_sine(theRatio), theRatio).value(), 1.0 / std::sqrt(0.75)) );
+    assert( near(derivative<0>(arc_cosine(theRatio), theRatio).value(), -1.0 / std::sqrt(0.75)) );
+    assert( near(derivative<0>(arc_tangent(theRatio), theRatio).value(), 1.0 / 1.25) );
+    }
+
+    // derivatives follow the interval of the variable
+    {
+    const auto theX = independent<0, 1>(meters<std::milli>{2000.0});
+    using area_t = multiply_units<meters<r_one, dual<double, 1>>, meters<r_one, dual<double, 1>>>;
+    const auto theSquare = units_cast<area_t>(theX * theX);
+    assert( near(primal(theSquare).value(), 4.0) );
+    const auto theSlope = derivative<0>(theSquare, theX);
+    assert( near(units_cast<meters<>>(theSlope).value(), 4.0) );
+    }
+}
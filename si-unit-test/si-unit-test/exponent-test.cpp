@@ -1,4 +1,5 @@
 #include "exponent.hpp"
+#include "units-io.hpp"
 #include "helpers.hpp"
 #include "exponent-test.hpp"
 
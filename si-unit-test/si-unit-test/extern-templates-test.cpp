@@ -0,0 +1,53 @@
+#include <sstream>
+#include <string>
+#include "helpers.hpp"
+#include "extern-templates.hpp"
+#include "extern-templates-test.hpp"
+
+// compile-time unit tests
+namespace
+{
+
+using namespace si;
+
+// the declarations do not change what the templates are
+static_assert( std::is_same<decltype(basic_string_from<char>(meters<>{})), std::string>::value, "" );
+static_assert( std::is_same<decltype(basic_string_from<char32_t>(watts<std::kilo>{})), std::u32string>::value, "" );
+
+} // end of anonymous namespace
+
+void si::run_extern_templates_tests()
+{
+    using namespace si;
+
+    // the instantiations of extern-templates.cpp are linked for each
+    // character type
+    {
+    assert_str_eq(string_from(newtons<>{}), "N");
+    assert_str_eq(string_from(meters<std::kilo>{}), "10³ m");
+    assert( wstring_from(joules<>{}) == L"J" );
+    assert( basic_string_from<char16_t>(pascals<>{}) == u"Pa" );
+    assert( basic_string_from<char32_t>(milliseconds<>{}) == U"10⁻³ s" );
+    }
+
+    // and for the streams
+    {
+    std::ostringstream theStream;
+    theStream << watts<std::kilo>{2.5};
+    assert_str_eq(theStream.str(), "2.5·10³ W");
+
+    std::wostringstream theWideStream;
+    theWideStream << seconds<>{3.0};
+    assert( theWideStream.str() == L"3 s" );
+
+    std::istringstream theInput{"12.5"};
+    newtons<> theForce{};
+    theInput >> theForce;
+    assert( theInput && theForce == newtons<>{12.5} );
+
+    std::wistringstream theWideInput{L"7"};
+    hertz<> theFrequency{};
+    theWideInput >> theFrequency;
+    assert( theWideInput && theFrequency == hertz<>{7.0} );
+    }
+}
@@ -0,0 +1,8 @@
+#pragma once
+
+namespace si
+{
+
+void run_extern_templates_tests();
+
+} // end of namespace si
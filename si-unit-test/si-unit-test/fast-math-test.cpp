@@ -0,0 +1,142 @@
+#include <cmath>
+#include <vector>
+#include "helpers.hpp"
+#include "fast-math.hpp"
+#include "fast-math-test.hpp"
+
+// compile-time unit tests
+namespace
+{
+
+using namespace si;
+
+using per_meter_t = decltype(1.0 / meters<>{});
+
+// result types
+static_assert( std::is_same<decltype(fast::sine(radians<>{})), scalar<>>::value, "" );
+static_assert( std::is_same<decltype(fast::cosine(radians<r_one, float>{})), scalar<r_one, float>>::value, "" );
+static_assert( std::is_same<decltype(fast::sine(radians<std::milli, int>{})), scalar<>>::value, "" );
+static_assert( std::is_same<decltype(fast::sincos(radians<>{}).cosine), scalar<>>::value, "" );
+static_assert( std::is_same<decltype(fast::arc_tangent2(meters<>{}, meters<std::milli>{})), radians<>>::value, "" );
+static_assert( std::is_same<decltype(fast::reciprocal_square_root(meters<>{} * meters<>{})), per_meter_t>::value, "" );
+
+// constexpr
+static_assert( fast::sine(radians<>{0.0}) == scalar<>{0.0}, "" );
+static_assert( fast::cosine(radians<>{0.0}) == scalar<>{1.0}, "" );
+static_assert( fast::sincos(radians<>{0.0}).cosine == scalar<>{1.0}, "" );
+static_assert( fast::arc_tangent2(meters<>{1.0}, meters<>{0.0}) == radians<>{1.5707963267948966}, "" );
+static_assert( fast::arc_tangent2(meters<>{0.0}, meters<>{-1.0}) == radians<>{3.141592653589793}, "" );
+static_assert( fast::reciprocal_square_root(meters<>{4.0} * meters<>{1.0}) == per_meter_t{0.5}, "" );
+static_assert( fast::reciprocal_square_root(scalar<r_one, float>{0.25f}).value() == 2.0f, "" );
+
+// the error in units of the last place of aExpected
+template< typename ValueT >
+double
+ulps
+(
+    ValueT aActual,
+    long double aExpected
+)
+{
+    const auto theExpected = static_cast<ValueT>(aExpected);
+    const auto theMagnitude = std::fabs(theExpected);
+    const auto theULP = std::nextafter(theMagnitude, std::numeric_limits<ValueT>::infinity()) - theMagnitude;
+    return static_cast<double>(std::fabs(static_cast<long double>(aActual) - aExpected) / theULP);
+}
+
+} // end of anonymous namespace
+
+void si::run_fast_math_tests()
+{
+    using namespace si;
+
+    // error bounds
+    {
+    double theSineError = 0;
+    double theCosineError = 0;
+    double theFloatError = 0;
+    for( int i = -20000; i <= 20000; ++i )
+    {
+        const double x = i * 0.00499;
+        const auto theResult = fast::sincos(radians<>{x});
+        theSineError = std::max(theSineError, ulps(theResult.sine.value(), std::sin(static_cast<long double>(x))));
+        theCosineError = std::max(theCosineError, ulps(theResult.cosine.value(), std::cos(static_cast<long double>(x))));
+        assert( fast::sine(radians<>{x}) == theResult.sine );
+        assert( fast::cosine(radians<>{x}) == theResult.cosine );
+
+        const float f = static_cast<float>(x);
+        theFloatError = std::max(theFloatError, ulps(fast::sine(radians<r_one, float>{f}).value(), std::sin(static_cast<long double>(f))));
+    }
+    assert( theSineError <= 1.5 );
+    assert( theCosineError <= 1.5 );
+    assert( theFloatError <= 1.0 );
+
+    double theLargeError = 0;
+    for( int i = -1000; i <= 1000; ++i )
+    {
+        const double x = i * 99.73;
+        theLargeError = std::max(theLargeError, ulps(fast::sine(radians<>{x}).value(), std::sin(static_cast<long double>(x))));
+    }
+    assert( theLargeError <= 2.5 );
+
+    double theAngleError = 0;
+    double theRootError = 0;
+    for( int i = -200; i <= 200; ++i )
+    {
+        for( int j = -50; j <= 50; ++j )
+        {
+            const double y = i * 0.0731;
+            const double x = j * 0.291;
+            theAngleError = std::max(theAngleError, ulps(fast::arc_tangent2(meters<>{y}, meters<>{x}).value(), std::atan2(static_cast<long double>(y), static_cast<long double>(x))));
+        }
+        const double theValue = std::ldexp(1.0 + (i + 200) * 0.0049, i);
+        theRootError = std::max(theRootError, ulps(fast::reciprocal_square_root(scalar<>{theValue}).value(), 1 / std::sqrt(static_cast<long double>(theValue))));
+    }
+    assert( theAngleError <= 2.0 );
+    assert( theRootError <= 1.5 );
+    }
+
+    // units and quadrants
+    {
+    assert( std::abs(fast::sine(radians<std::milli>{523.5987755982989}).value() - 0.5) < 1e-15 );
+    assert( std::abs(fast::cosine(radians<std::milli>{-3141.592653589793}).value() + 1.0) < 1e-15 );
+    assert( std::abs(fast::arc_tangent2(meters<>{-1.0}, meters<>{-1.0}).value() + 3 * std::atan(1.0)) < 1e-15 );
+    assert( std::abs(fast::arc_tangent2(meters<>{1.0}, meters<std::milli>{1000.0}).value() - std::atan(1.0)) < 1e-15 );
+    assert( fast::arc_tangent2(meters<>{0.0}, meters<>{0.0}) == radians<>{0.0} );
+    assert( std::abs(units_cast<per_meter_t>(fast::reciprocal_square_root(meters<std::milli>{1.0} * meters<std::milli>{4.0})).value() - 500.0) < 1e-9 );
+    }
+
+    // span variants match the scalar functions
+    {
+    std::vector<radians<>> theAngles;
+    std::vector<meters<>> theYs;
+    std::vector<meters<>> theXs;
+    std::vector<decltype(meters<>{} * meters<>{})> theAreas;
+    for( int i = 0; i < 37; ++i )
+    {
+        theAngles.push_back(radians<>{i * 0.7 - 12.0});
+        theYs.push_back(meters<>{std::sin(i * 1.3)});
+        theXs.push_back(meters<>{std::cos(i * 0.9)});
+        theAreas.push_back(meters<>{i + 0.5} * meters<>{2.0});
+    }
+
+    std::vector<scalar<>> theSines(theAngles.size());
+    std::vector<scalar<>> theCosines(theAngles.size());
+    std::vector<scalar<>> theBoth(theAngles.size());
+    std::vector<radians<>> theDirections(theYs.size());
+    std::vector<decltype(1.0 / meters<>{})> theRoots(theAreas.size());
+    fast::sine(std::span{theAngles}, std::span{theSines});
+    fast::cosine(std::span{theAngles}, std::span{theCosines});
+    fast::sincos(std::span{theAngles}, std::span{theBoth}, std::span{theCosines});
+    fast::arc_tangent2(std::span{theYs}, std::span{theXs}, std::span{theDirections});
+    fast::reciprocal_square_root(std::span{theAreas}, std::span{theRoots});
+    for( std::size_t i = 0; i < theAngles.size(); ++i )
+    {
+        assert( theSines[i] == fast::sine(theAngles[i]) );
+        assert( theBoth[i] == theSines[i] );
+        assert( theCosines[i] == fast::cosine(theAngles[i]) );
+        assert( theDirections[i] == fast::arc_tangent2(theYs[i], theXs[i]) );
+        assert( theRoots[i] == fast::reciprocal_square_root(theAreas[i]) );
+    }
+    }
+}
@@ -0,0 +1,114 @@
+#include <iostream>
+#include <vector>
+#include "helpers.hpp"
+#include "filter.hpp"
+#include "filter-test.hpp"
+
+// compile-time unit tests
+namespace
+{
+
+using namespace si;
+
+// coefficient_t
+static_assert( std::is_same<biquad_filter<volts<>>::coefficient_t, scalar<>>::value, "" );
+static_assert( std::is_same<fir_filter<pascals<r_one, float>, 3>::coefficient_t, scalar<r_one, float>>::value, "" );
+
+} // end of anonymous namespace
+
+void si::run_filter_tests()
+{
+    using namespace si;
+
+    // exponential_moving_average, fixed sample period
+    {
+    exponential_moving_average<volts<>> theAverage{milliseconds<>{100.0}, seconds<>{0.1}};
+    assert( std::abs(theAverage.weight().value() - (1.0 - std::exp(-1.0))) < 1e-15 );
+    assert( theAverage(volts<>{2.0}) == volts<>{2.0} );
+    const auto theAlpha = theAverage.weight().value();
+    assert( theAverage(volts<>{4.0}) == volts<>{2.0 + theAlpha * 2.0} );
+    assert( theAverage.value() == volts<>{2.0 + theAlpha * 2.0} );
+    }
+
+    // exponential_moving_average, irregular samples
+    {
+    exponential_moving_average<volts<>> theAverage{seconds<>{1.0}};
+    theAverage(volts<>{0.0}, seconds<>{0.0});
+    const auto theResult = theAverage(volts<>{1.0}, milliseconds<>{1000.0});
+    assert( std::abs(theResult.value() - (1.0 - std::exp(-1.0))) < 1e-15 );
+    }
+
+    // exponential_moving_average, block matches per sample
+    {
+    exponential_moving_average<pascals<>> theSingle{seconds<>{0.5}, seconds<>{0.1}};
+    exponential_moving_average<pascals<>> theBlock{seconds<>{0.5}, seconds<>{0.1}};
+    std::vector<pascals<>> theInput;
+    for( int i = 0; i < 20; ++i )
+    {
+        theInput.push_back(pascals<>{static_cast<double>(i % 7)});
+    }
+    std::vector<pascals<>> theOutput(theInput.size());
+    theBlock.process(theInput, theOutput);
+    for( std::size_t i = 0; i < theInput.size(); ++i )
+    {
+        assert( theSingle(theInput[i]) == theOutput[i] );
+    }
+    theBlock.reset();
+    assert( theBlock(pascals<>{3.0}) == pascals<>{3.0} );
+    }
+
+    // biquad_filter, block matches per sample
+    {
+    const auto theB0 = scalar<>{0.2};
+    const auto theB1 = scalar<>{0.4};
+    const auto theB2 = scalar<>{0.2};
+    const auto theA1 = scalar<>{-0.3};
+    const auto theA2 = scalar<>{0.1};
+    biquad_filter<volts<>> theSingle{theB0, theB1, theB2, theA1, theA2};
+    biquad_filter<volts<>> theBlock{theB0, theB1, theB2, theA1, theA2};
+
+    // impulse response
+    assert( theSingle(volts<>{1.0}) == volts<>{0.2} );
+    assert( theSingle(volts<>{0.0}) == volts<>{0.4 + 0.3 * 0.2} );
+    theSingle.reset();
+
+    std::vector<volts<>> theInput;
+    for( int i = 0; i < 20; ++i )
+    {
+        theInput.push_back(volts<>{static_cast<double>(i % 5) - 2.0});
+    }
+    std::vector<volts<>> theOutput(theInput.size());
+    theBlock.process(std::span{theInput}.first(7), std::span{theOutput}.first(7));
+    theBlock.process(std::span{theInput}.subspan(7), std::span{theOutput}.subspan(7));
+    for( std::size_t i = 0; i < theInput.size(); ++i )
+    {
+        assert( theSingle(theInput[i]) == theOutput[i] );
+    }
+    }
+
+    // fir_filter
+    {
+    using taps_t = std::array<scalar<>, 3>;
+    fir_filter<volts<>, 3> theSingle{taps_t{scalar<>{1.0}, scalar<>{2.0}, scalar<>{4.0}}};
+    fir_filter<volts<>, 3> theBlock{taps_t{scalar<>{1.0}, scalar<>{2.0}, scalar<>{4.0}}};
+    assert( theSingle(volts<>{1.0}) == volts<>{1.0} );
+    assert( theSingle(volts<>{0.0}) == volts<>{2.0} );
+    assert( theSingle(volts<>{0.0}) == volts<>{4.0} );
+    assert( theSingle(volts<>{0.0}) == volts<>{0.0} );
+    theSingle.reset();
+
+    std::vector<volts<>> theInput;
+    for( int i = 0; i < 20; ++i )
+    {
+        theInput.push_back(volts<>{static_cast<double>(i % 3)});
+    }
+    std::vector<volts<>> theOutput(theInput.size());
+    theBlock.process(std::span{theInput}.first(1), std::span{theOutput}.first(1));
+    theBlock.process(std::span{theInput}.subspan(1, 9), std::span{theOutput}.subspan(1, 9));
+    theBlock.process(std::span{theInput}.subspan(10), std::span{theOutput}.subspan(10));
+    for( std::size_t i = 0; i < theInput.size(); ++i )
+    {
+        assert( theSingle(theInput[i]) == theOutput[i] );
+    }
+    }
+}
@@ -0,0 +1,114 @@
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "helpers.hpp"
+#include "json.hpp"
+#include "json-test.hpp"
+
+// compile-time unit tests
+namespace
+{
+
+using namespace si;
+using namespace std::string_view_literals;
+
+static_assert( json_units_text<newtons<std::kilo>>::object_end == ",\"unit\":\"kN\"}"sv, "" );
+static_assert( json_units_text<newtons<std::kilo>>::string_end == " kN\""sv, "" );
+static_assert( json_units_text<units_t<double, r_one, none>>::string_end == "\""sv, "" );
+
+// the symbols of prefixed unit names are found by hash
+static_assert( find_unit_symbol("kN") == unit_descriptor_of<newtons<std::kilo>>(), "" );
+static_assert( find_unit_symbol("h") == unit_descriptor_of<hours<>>(), "" );
+static_assert( find_unit_symbol("m/s") == parse_unit_symbol("m/s"), "" );
+static_assert( !find_unit_symbol("kkN"), "" );
+
+// the JSON number grammar
+static_assert( json_number_length("-12.5e-3,") == 8, "" );
+static_assert( json_number_length("0123") == 1, "" );
+static_assert( json_number_length("inf") == 0, "" );
+static_assert( json_number_length("+1") == 0, "" );
+
+} // end of anonymous namespace
+
+void si::run_json_tests()
+{
+    using namespace si;
+    using Milliseconds_t = seconds<std::milli, std::int64_t>;
+
+    // write both styles
+    {
+    assert( to_json(newtons<std::kilo>{12.3}) == R"({"value":12.3,"unit":"kN"})" );
+    assert( to_json(newtons<std::kilo>{12.3}, json_style::string) == R"("12.3 kN")" );
+    assert( to_json(Milliseconds_t{-250}) == R"({"value":-250,"unit":"ms"})" );
+    assert( to_json(units_t<double, r_one, none>{0.5}, json_style::string) == R"("0.5")" );
+    assert( to_json(watts<>{std::numeric_limits<double>::infinity()}) == R"({"value":null,"unit":"W"})" );
+
+    const std::vector<seconds<>> theTimes{seconds<>{1.0}, seconds<>{0.1}};
+    assert( to_json(std::span<const seconds<>>{theTimes}) == R"([{"value":1,"unit":"s"},{"value":0.1,"unit":"s"}])" );
+    assert( to_json(std::span<const seconds<>>{theTimes}, json_style::string) == R"(["1 s","0.1 s"])" );
+    assert( to_json(std::span<const seconds<>>{}) == "[]" );
+    }
+
+    // read both styles, with members in any order and white space
+    {
+    assert( from_json<newtons<std::kilo>>(R"({"value":12.3,"unit":"kN"})") == newtons<std::kilo>{12.3} );
+    assert( from_json<newtons<std::kilo>>(" { \"unit\" : \"kN\" ,\n \"value\" : -1e3 } ") == newtons<std::kilo>{-1000.0} );
+    assert( from_json<newtons<std::kilo>>(R"("12.3 kN")") == newtons<std::kilo>{12.3} );
+    assert( from_json<newtons<std::kilo>>(R"("12.3kN")") == newtons<std::kilo>{12.3} );
+    assert( (from_json<units_t<double, r_one, none>>(R"("2.5")") == (units_t<double, r_one, none>{2.5})) );
+
+    const std::string theJson = to_json(watts<std::mega>{0.1});
+    assert( from_json<watts<std::mega>>(theJson) == watts<std::mega>{0.1} );
+    }
+
+    // other units of the quantity are converted, escaped or not
+    {
+    assert( from_json<newtons<>>(R"({"value":2,"unit":"kN"})") == newtons<>{2000.0} );
+    assert( from_json<Milliseconds_t>(R"({"value":3,"unit":"min"})") == Milliseconds_t{180000} );
+    assert( from_json<seconds<std::micro>>(R"("7 µs")") == seconds<std::micro>{7.0} );
+    assert( from_json<seconds<std::micro>>(R"("7 μs")") == seconds<std::micro>{7.0} );
+    assert( (from_json<units_t<double, r_one, divide_quantity<length, si::time>>>(R"({"value":36,"unit":"km/h"})") == (units_t<double, r_one, divide_quantity<length, si::time>>{10.0})) );
+    }
+
+    // and other text is refused
+    {
+    assert( !from_json<newtons<>>(R"({"value":2,"unit":"J"})") );
+    assert( !from_json<newtons<>>(R"({"value":2,"unit":"furlong"})") );
+    assert( !from_json<newtons<>>(R"({"value":2})") );
+    assert( !from_json<newtons<>>(R"({"value":2,"unit":"N","note":""})") );
+    assert( !from_json<newtons<>>(R"({"value":2,"value":3,"unit":"N"})") );
+    assert( !from_json<newtons<>>(R"({"value":null,"unit":"N"})") );
+    assert( !from_json<newtons<>>(R"({"value":2,"unit":"N"} x)") );
+
+    // numbers follow the JSON grammar, not std::from_chars
+    assert( !from_json<newtons<>>(R"({"value":inf,"unit":"N"})") );
+    assert( !from_json<newtons<>>(R"({"value":nan,"unit":"N"})") );
+    assert( !from_json<newtons<>>(R"({"value":007,"unit":"kN"})") );
+    assert( !from_json<newtons<>>(R"({"value":-,"unit":"N"})") );
+    assert( !from_json<newtons<>>(R"({"value":1.,"unit":"N"})") );
+    assert( !from_json<newtons<>>(R"({"value":.5,"unit":"N"})") );
+    assert( !from_json<newtons<>>(R"({"value":1e,"unit":"N"})") );
+    assert( !from_json<newtons<>>(R"("inf N")") );
+    assert( !from_json<Milliseconds_t>(R"({"value":1.5,"unit":"ms"})") );
+    assert( from_json<newtons<>>(R"({"value":0.5e+1,"unit":"N"})") == newtons<>{5.0} );
+    assert( from_json<newtons<>>(R"({"value":-0,"unit":"N"})") == newtons<>{0.0} );
+    assert( !from_json<newtons<>>(R"({"value":2,"unit":"N")") );
+    assert( !from_json<newtons<>>(R"("2 N)") );
+    assert( !from_json<newtons<>>(R"("N")") );
+    assert( !from_json<newtons<>>(R"("2 \ud83d")") );
+    assert( !from_json<Milliseconds_t>(R"({"value":2.5,"unit":"ms"})") );
+    }
+
+    // arrays
+    {
+    const auto theTimes = from_json_array<Milliseconds_t>(R"([ {"value":1,"unit":"s"}, "2 ms" ,"3 ms"])");
+    assert( theTimes && theTimes->size() == 3 );
+    assert( (*theTimes)[0] == Milliseconds_t{1000} && (*theTimes)[2] == Milliseconds_t{3} );
+    assert( from_json_array<Milliseconds_t>(" [ ] ") && from_json_array<Milliseconds_t>("[]")->empty() );
+    assert( !from_json_array<Milliseconds_t>(R"(["1 ms",])") );
+    assert( !from_json_array<Milliseconds_t>(R"(["1 ms")") );
+    assert( !from_json_array<Milliseconds_t>(R"(["1 ms", "1 m"])") );
+    }
+}
@@ -0,0 +1,112 @@
+#include <iostream>
+#include <vector>
+#include "helpers.hpp"
+#include "lookup-table.hpp"
+#include "lookup-table-test.hpp"
+
+namespace
+{
+
+inline
+bool
+is_near
+(
+    double aLHS,
+    double aRHS
+)
+{
+    return std::abs(aLHS - aRHS) < 1e-12;
+}
+
+} // end of anonymous namespace
+
+void si::run_lookup_table_tests()
+{
+    using namespace si;
+
+    const std::vector<ohms<>> theResistances{ohms<>{100.0}, ohms<>{200.0}, ohms<>{400.0}, ohms<>{500.0}};
+    const std::vector<kelvins<>> theTemperatures{kelvins<>{300.0}, kelvins<>{310.0}, kelvins<>{330.0}, kelvins<>{360.0}};
+
+    // linear, non-uniform
+    {
+    const lookup_table<ohms<>, kelvins<>> theTable{theResistances, theTemperatures};
+    assert( theTable.size() == 4 );
+    assert( theTable.method() == interpolation::linear );
+    assert( theTable(ohms<>{100.0}) == kelvins<>{300.0} );
+    assert( theTable(ohms<>{150.0}) == kelvins<>{305.0} );
+    assert( theTable(ohms<>{300.0}) == kelvins<>{320.0} );
+    assert( theTable(ohms<>{450.0}) == kelvins<>{345.0} );
+    assert( theTable(ohms<>{500.0}) == kelvins<>{360.0} );
+
+    // clamped outside the table
+    assert( theTable(ohms<>{0.0}) == kelvins<>{300.0} );
+    assert( theTable(ohms<>{1000.0}) == kelvins<>{360.0} );
+
+    // argument in other units
+    assert( theTable(ohms<std::kilo>{0.3}) == kelvins<>{320.0} );
+    assert( theTable(ohms<std::milli, long long>{150000}) == kelvins<>{305.0} );
+    }
+
+    // linear, uniform
+    {
+    const lookup_table<ohms<>, kelvins<>> theTable{ohms<>{100.0}, ohms<>{100.0}, theTemperatures};
+    assert( theTable.front() == ohms<>{100.0} );
+    assert( theTable.back() == ohms<>{400.0} );
+    assert( theTable(ohms<>{150.0}) == kelvins<>{305.0} );
+    assert( theTable(ohms<>{250.0}) == kelvins<>{320.0} );
+    assert( theTable(ohms<>{400.0}) == kelvins<>{360.0} );
+    assert( theTable(ohms<>{-5.0}) == kelvins<>{300.0} );
+    assert( theTable(ohms<>{1e9}) == kelvins<>{360.0} );
+    }
+
+    // cubic, exact for quadratics in the interior
+    {
+    std::vector<meters<>> theX;
+    std::vector<seconds<>> theY;
+    for( const auto x : {0.0, 1.0, 3.0, 4.0, 6.0} )
+    {
+        theX.push_back(meters<>{x});
+        theY.push_back(seconds<>{x * x});
+    }
+    const lookup_table<meters<>, seconds<>> theTable{theX, theY, interpolation::cubic};
+    assert( theTable(meters<>{1.0}) == seconds<>{1.0} );
+    assert( is_near(theTable(meters<>{2.0}).value(), 4.0) );
+    assert( is_near(theTable(meters<>{3.5}).value(), 12.25) );
+    }
+
+    // blocks match single lookups
+    {
+    std::vector<ohms<>> theInput;
+    for( int i = 0; i < 64; ++i )
+    {
+        theInput.push_back(ohms<>{50.0 + i * 8.0});
+    }
+    std::vector<kelvins<>> theOutput(theInput.size());
+    for( const auto theMethod : {interpolation::linear, interpolation::cubic} )
+    {
+        const lookup_table<ohms<>, kelvins<>> theTables[] =
+        {
+            {theResistances, theTemperatures, theMethod},
+            {ohms<>{100.0}, ohms<>{100.0}, theTemperatures, theMethod}
+        };
+        for( const auto& theTable : theTables )
+        {
+            theTable(theInput, theOutput);
+            for( std::size_t i = 0; i < theInput.size(); ++i )
+            {
+                assert( theOutput[i] == theTable(theInput[i]) );
+            }
+        }
+    }
+    }
+
+    // block in other units
+    {
+    const lookup_table<ohms<>, kelvins<>> theTable{theResistances, theTemperatures};
+    const std::vector<ohms<std::kilo>> theInput{ohms<std::kilo>{0.15}, ohms<std::kilo>{0.45}};
+    std::vector<kelvins<>> theOutput(theInput.size());
+    theTable(std::span{theInput}, std::span{theOutput});
+    assert( is_near(theOutput[0].value(), 305.0) );
+    assert( is_near(theOutput[1].value(), 345.0) );
+    }
+}
@@ -0,0 +1,214 @@
+#include <cmath>
+#include <iostream>
+#include "helpers.hpp"
+#include "matrix.hpp"
+#include "matrix-test.hpp"
+
+// compile-time unit tests
+namespace
+{
+
+using namespace si;
+
+using speed_t = divide_units<meters<>, seconds<>>;
+using state_t = column_vector<meters<>, speed_t>;
+using covariance_t = matrix<units_list<meters<>, speed_t>, units_list<meters<>, speed_t>>;
+using transition_t = matrix<units_list<meters<>, speed_t>, units_list<reciprocal_units<meters<>>, reciprocal_units<speed_t>>>;
+using measurement_t = column_vector<meters<>>;
+using observation_t = matrix<units_list<meters<>>, units_list<reciprocal_units<meters<>>, reciprocal_units<speed_t>>>;
+using measurement_noise_t = matrix<units_list<meters<>>, units_list<meters<>>>;
+
+// element units
+static_assert( std::is_same<covariance_t::element_t<0, 0>::quantity_t, area>::value, "" );
+static_assert( std::is_same<covariance_t::element_t<0, 1>::quantity_t, multiply_units<meters<>, speed_t>::quantity_t>::value, "" );
+static_assert( std::is_same<transition_t::element_t<0, 1>::quantity_t, si::time>::value, "" );
+static_assert( std::is_same<transition_t::element_t<1, 1>::quantity_t, none>::value, "" );
+static_assert( std::is_same<state_t::element_t<1, 0>, speed_t>::value, "" );
+
+// no per-element overhead
+static_assert( sizeof(covariance_t) == 4 * sizeof(double), "" );
+static_assert( sizeof(state_t) == 2 * sizeof(double), "" );
+
+// products and transposes are dimension checked
+static_assert( std::is_constructible<state_t, decltype(transition_t{} * state_t{})>::value, "" );
+static_assert( std::is_constructible<covariance_t, decltype(transition_t{} * covariance_t{} * transpose(transition_t{}))>::value, "" );
+static_assert( std::is_constructible<measurement_t, decltype(observation_t{} * state_t{})>::value, "" );
+static_assert( !std::is_constructible<state_t, covariance_t>::value, "" );
+static_assert( !std::is_constructible<state_t, column_vector<speed_t, meters<>>>::value, "" );
+static_assert( std::is_same<decltype(transpose(transition_t{}))::rows_t, transition_t::columns_t>::value, "" );
+
+// conversion between intervals
+static_assert( column_vector<meters<std::milli>>{column_vector<meters<>>{}}.get<0, 0>() == meters<>{0.0}, "" );
+
+// element access
+static_assert
+(
+    []()
+    {
+        covariance_t theMatrix;
+        theMatrix.set<0, 1>(multiply_units<meters<std::milli>, speed_t>{1500.0});
+        return theMatrix.get<0, 1>().value() == 1.5;
+    }(),
+    ""
+);
+
+bool
+near
+(
+    double aLHS,
+    double aRHS
+)
+{
+    return std::abs(aLHS - aRHS) < 1e-12;
+}
+
+} // end of anonymous namespace
+
+void si::run_matrix_tests()
+{
+    using namespace si;
+
+    // constant velocity Kalman filter
+    {
+    state_t x;
+    x.set<0, 0>(meters<>{10.0});
+    x.set<1, 0>(speed_t{2.0});
+
+    covariance_t P;
+    P.value(0, 0) = 4.0;
+    P.value(0, 1) = P.value(1, 0) = 1.0;
+    P.value(1, 1) = 2.0;
+
+    transition_t F;
+    F.set<0, 0>(scalar<>{1.0});
+    F.set<0, 1>(milliseconds<>{100.0});
+    F.set<1, 1>(scalar<>{1.0});
+
+    covariance_t Q;
+    Q.value(0, 0) = 0.01;
+    Q.value(1, 1) = 0.1;
+
+    kalman_predict(x, P, F, Q);
+    assert( near(x.get<0, 0>().value(), 10.2) );
+    assert( (x.get<1, 0>() == speed_t{2.0}) );
+    assert( near(P.value(0, 0), 4.23) );
+    assert( near(P.value(0, 1), 1.2) );
+    assert( near(P.value(1, 0), 1.2) );
+    assert( near(P.value(1, 1), 2.1) );
+
+    observation_t H;
+    H.set<0, 0>(scalar<>{1.0});
+    measurement_noise_t R;
+    R.set<0, 0>(multiply_units<meters<>, meters<>>{0.5});
+    measurement_t z;
+    z.set<0, 0>(meters<>{11.0});
+
+    assert( kalman_update(x, P, z, H, R) );
+    const auto k0 = 4.23 / 4.73;
+    const auto k1 = 1.2 / 4.73;
+    assert( near(x.get<0, 0>().value(), 10.2 + k0 * 0.8) );
+    assert( near(x.get<1, 0>().value(), 2.0 + k1 * 0.8) );
+    assert( near(P.value(0, 0), 4.23 - k0 * 4.23) );
+    assert( near(P.value(0, 1), 1.2 - k0 * 1.2) );
+    assert( near(P.value(1, 1), 2.1 - k1 * 1.2) );
+
+    // a singular innovation covariance leaves the state unchanged
+    const auto theState = x;
+    covariance_t theZero;
+    assert( !kalman_update(x, theZero, z, H, measurement_noise_t{}) );
+    assert( x == theState );
+    }
+
+    // cholesky
+    {
+    covariance_t P;
+    P.value(0, 0) = 4.0;
+    P.value(0, 1) = P.value(1, 0) = 2.0;
+    P.value(1, 1) = 3.0;
+    const auto L = cholesky(P);
+    assert( L.has_value() );
+    assert( (L->get<0, 0>() == meters<>{2.0}) );
+    assert( (L->get<0, 1>() == meters<>{0.0}) );
+    assert( (L->get<1, 0>() == speed_t{1.0}) );
+    assert( near(L->get<1, 1>().value(), std::sqrt(2.0)) );
+    const covariance_t theProduct{*L * transpose(*L)};
+    for( std::size_t i = 0; i < 4; ++i )
+    {
+        assert( near(theProduct.data()[i], P.data()[i]) );
+    }
+
+    P.value(1, 1) = 1.0;
+    assert( !cholesky(P).has_value() );
+    }
+
+    // inverse
+    {
+    transition_t F;
+    F.value(0, 0) = 2.0;
+    F.value(0, 1) = 1.0;
+    F.value(1, 0) = 1.0;
+    F.value(1, 1) = 3.0;
+    const auto theInverse = inverse(F);
+    assert( theInverse.has_value() );
+    static_assert( std::is_same<decltype(theInverse->get<0, 1>())::quantity_t, si::time>::value, "" );
+    const auto theIdentity = F * *theInverse;
+    assert( near(theIdentity.value(0, 0), 1.0) );
+    assert( near(theIdentity.value(0, 1), 0.0) );
+    assert( near(theIdentity.value(1, 0), 0.0) );
+    assert( near(theIdentity.value(1, 1), 1.0) );
+    assert( !inverse(transition_t{}).has_value() );
+    }
+
+    // blocked multiply and transpose match the naive loops
+    {
+    using rows_t = repeat_units<meters<>, 41>;
+    using inner_t = repeat_units<seconds<>, 37>;
+    using columns_t = repeat_units<scalar<>, 70>;
+    matrix<rows_t, inner_t> A;
+    matrix<inner_t, columns_t> B;
+    for( std::size_t i = 0; i < 41 * 37; ++i )
+    {
+        A.data()[i] = static_cast<double>(i % 13) - 6.0;
+    }
+    for( std::size_t i = 0; i < 37 * 70; ++i )
+    {
+        B.data()[i] = static_cast<double>(i % 7) * 0.5;
+    }
+
+    const auto C = A * B;
+    static_assert( std::is_same<decltype(C)::element_t<0, 0>::quantity_t, multiply_units<meters<>, seconds<>, seconds<>>::quantity_t>::value, "" );
+    for( std::size_t i = 0; i < 41; ++i )
+    {
+        for( std::size_t j = 0; j < 70; ++j )
+        {
+            double theSum = 0.0;
+            for( std::size_t k = 0; k < 37; ++k )
+            {
+                theSum += A.value(i, k) * B.value(k, j);
+            }
+            assert( C.value(i, j) == theSum );
+        }
+    }
+
+    const auto T = transpose(A);
+    for( std::size_t i = 0; i < 41; ++i )
+    {
+        for( std::size_t j = 0; j < 37; ++j )
+        {
+            assert( T.value(j, i) == A.value(i, j) );
+        }
+    }
+    }
+
+    // inner products of different intervals are converted
+    {
+    matrix<units_list<scalar<>>, units_list<seconds<>, milliseconds<>>> A;
+    A.value(0, 0) = 1.0;
+    A.value(0, 1) = 500.0;
+    column_vector<meters<>, meters<>> x;
+    x.value(0, 0) = 2.0;
+    x.value(1, 0) = 4.0;
+    const auto y = A * x;
+    assert( (y.get<0, 0>() == multiply_units<seconds<>, meters<>>{4.0}) );
+    }
+}
@@ -0,0 +1,156 @@
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <compare>
+#include <iostream>
+#include <sstream>
+#include "helpers.hpp"
+#include "measurement.hpp"
+#include "measurement-test.hpp"
+
+// compile-time unit tests
+namespace
+{
+
+using namespace si;
+
+using md = measurement<double>;
+using length_t = meters<r_one, md>;
+using duration_t = seconds<r_one, md>;
+
+// measurement is a units_t value type
+static_assert( is_units_value<md>, "" );
+static_assert( is_floating_value<md>, "" );
+static_assert( sizeof(length_t) == 2 * sizeof(double), "" );
+
+// promotion
+static_assert( std::is_same<common_value_t<md, double>, md>::value, "" );
+static_assert( std::is_same<common_value_t<measurement<float>, double>, md>::value, "" );
+static_assert( std::is_same<decltype(length_t{} / duration_t{})::value_t, md>::value, "" );
+static_assert( std::is_same<decltype(length_t{} * 2.0)::value_t, md>::value, "" );
+static_assert( std::is_same<decltype(square_root(length_t{} * length_t{})), length_t>::value, "" );
+static_assert( std::is_same<decltype(sine(radians<r_one, md>{})), scalar<r_one, md>>::value, "" );
+
+// exact values convert, measurements do not lose their uncertainty
+static_assert( std::is_constructible<length_t, double>::value, "" );
+static_assert( std::is_constructible<length_t, meters<>>::value, "" );
+static_assert( !std::is_constructible<meters<>, length_t>::value, "" );
+
+// ordered by value, so units_t compares, sorts and takes std::min and std::max
+static_assert( md{1.0, 0.5} < md{2.0, 0.1}, "" );
+static_assert( length_t{md{1.0, 0.5}} < length_t{md{2.0, 0.1}}, "" );
+static_assert( length_t{md{2.0, 0.5}} >= meters<std::milli, md>{md{1500.0, 1.0}}, "" );
+static_assert( (length_t{md{1.0, 0.5}} <=> length_t{md{2.0, 0.1}}) == std::partial_ordering::less, "" );
+static_assert( std::max(length_t{md{1.0, 0.5}}, length_t{md{2.0, 0.1}}) == length_t{md{2.0, 0.1}}, "" );
+
+// constexpr
+static_assert( units_cast<meters<std::milli, md>>(length_t{md{1.0, 0.25}}).value() == md{1000.0, 250.0}, "" );
+static_assert( exponentiate<2>(length_t{md{3.0, 0.1}}).value().value() == 9.0, "" );
+
+bool
+near
+(
+    double aLHS,
+    double aRHS
+)
+{
+    return std::abs(aLHS - aRHS) < 1e-12;
+}
+
+} // end of anonymous namespace
+
+void si::run_measurement_tests()
+{
+    using namespace si;
+
+    // linearised propagation
+    {
+    const length_t theLength{md{2.0, 0.02}};
+    const duration_t theTime{md{4.0, 0.04}};
+
+    const auto theSpeed = theLength / theTime;
+    assert( near(theSpeed.value().value(), 0.5) );
+    assert( near(theSpeed.value().relative_uncertainty(), std::hypot(0.01, 0.01)) );
+
+    const auto theArea = theLength * theLength;
+    assert( near(theArea.value().uncertainty(), std::hypot(2.0 * 0.02, 2.0 * 0.02)) );
+
+    const auto theSquare = exponentiate<2>(theLength);
+    assert( near(theSquare.value().value(), 4.0) );
+    assert( near(theSquare.value().uncertainty(), 2.0 * 2.0 * 0.02) );
+
+    const auto theRoot = square_root(theSquare);
+    assert( near(theRoot.value().value(), 2.0) );
+    assert( near(theRoot.value().uncertainty(), 0.02) );
+
+    const auto theSum = theLength + meters<std::milli, md>{md{500.0, 10.0}};
+    assert( near(theSum.value().value(), 2500.0) );
+    assert( near(theSum.value().uncertainty(), std::hypot(20.0, 10.0)) );
+
+    const auto theScaled = theLength * 3.0;
+    assert( near(theScaled.value().uncertainty(), 0.06) );
+    assert( absolute(-theLength) == theLength );
+    }
+
+    // trigonometry
+    {
+    const radians<r_one, md> theAngle{md{0.5, 0.01}};
+    assert( near(sine(theAngle).value().uncertainty(), std::cos(0.5) * 0.01) );
+    assert( near(cosine(theAngle).value().uncertainty(), std::sin(0.5) * 0.01) );
+    assert( near(tangent(theAngle).value().uncertainty(), 0.01 / (std::cos(0.5) * std::cos(0.5))) );
+    const scalar<r_one, md> theRatio{md{0.5, 0.01}};
+    assert( near(arc_sine(theRatio).value().uncertainty(), 0.01 / std::sqrt(0.75)) );
+    assert( near(arc_cosine(theRatio).value().uncertainty(), 0.01 / std::sqrt(0.75)) );
+    assert( near(arc_tangent(theRatio).value().uncertainty(), 0.01 / 1.25) );
+    }
+
+    // output
+    {
+    std::ostringstream theStream;
+    theStream << md{1.5, 0.25};
+    assert( theStream.str() == "1.5 ± 0.25" );
+    }
+
+    // SoA kernels match the scalar propagation
+    {
+    measurement_array<length_t> theLengths;
+    measurement_array<duration_t> theTimes;
+    for( int i = 1; i <= 37; ++i )
+    {
+        theLengths.push_back(length_t{md{i * 0.5, 0.01 * i}});
+        theTimes.push_back(duration_t{md{10.0 - i * 0.25, 0.02}});
+    }
+
+    measurement_array<decltype(length_t{} / duration_t{})> theSpeeds;
+    divide(theLengths, theTimes, theSpeeds);
+    measurement_array<decltype(length_t{} * duration_t{})> theProducts;
+    multiply(theLengths, theTimes, theProducts);
+    measurement_array<length_t> theSums;
+    add(theLengths, theLengths, theSums);
+    measurement_array<decltype(length_t{} * length_t{})> theAreas;
+    multiply(theLengths, theLengths, theAreas);
+    measurement_array<length_t> theRoots;
+    square_root(theAreas, theRoots);
+    assert( theSpeeds.size() == 37 );
+    for( std::size_t i = 0; i < theLengths.size(); ++i )
+    {
+        const auto theSpeed = theLengths[i] / theTimes[i];
+        assert( near(theSpeeds[i].value().value(), theSpeed.value().value()) );
+        assert( near(theSpeeds[i].value().uncertainty(), theSpeed.value().uncertainty()) );
+        const auto theProduct = theLengths[i] * theTimes[i];
+        assert( near(theProducts[i].value().value(), theProduct.value().value()) );
+        assert( near(theProducts[i].value().uncertainty(), theProduct.value().uncertainty()) );
+        assert( near(theSums[i].value().uncertainty(), (theLengths[i] + theLengths[i]).value().uncertainty()) );
+        assert( near(theRoots[i].value().value(), square_root(theAreas[i]).value().value()) );
+        assert( near(theRoots[i].value().uncertainty(), square_root(theAreas[i]).value().uncertainty()) );
+    }
+    }
+
+    // sorted by value
+    {
+    std::array<length_t, 3> theLengths{length_t{md{3.0, 0.1}}, length_t{md{1.0, 0.3}}, length_t{md{2.0, 0.2}}};
+    std::sort(theLengths.begin(), theLengths.end());
+    assert( (theLengths[0] == length_t{md{1.0, 0.3}}) );
+    assert( (theLengths[2] == length_t{md{3.0, 0.1}}) );
+    }
+}
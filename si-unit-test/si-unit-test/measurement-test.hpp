@@ -0,0 +1,8 @@
+#pragma once
+
+namespace si
+{
+
+void run_measurement_tests();
+
+} // end of namespace si
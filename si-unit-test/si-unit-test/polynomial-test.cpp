@@ -0,0 +1,76 @@
+#include <iostream>
+#include <vector>
+#include "helpers.hpp"
+#include "polynomial.hpp"
+#include "polynomial-test.hpp"
+
+// compile-time unit tests
+namespace
+{
+
+using namespace si;
+
+using speed_t = divide_units<meters<>, seconds<>>;
+using acceleration_t = divide_units<speed_t, seconds<>>;
+using position_t = polynomial<seconds<>, meters<>, 2>;
+
+// coefficient_units
+static_assert( std::is_same<coefficient_units<seconds<>, meters<>, 0>::quantity_t, length>::value, "" );
+static_assert( std::is_same<coefficient_units<seconds<>, meters<>, 1>::quantity_t, speed_t::quantity_t>::value, "" );
+static_assert( std::is_same<coefficient_units<seconds<>, meters<>, 2>::quantity_t, acceleration_t::quantity_t>::value, "" );
+static_assert( std::is_same<coefficient_units<seconds<std::milli>, meters<>, 1>::interval_t, std::kilo>::value, "" );
+
+// coefficients must have the right units
+static_assert( std::is_constructible<position_t, meters<>, speed_t, acceleration_t>::value, "" );
+static_assert( std::is_constructible<position_t, meters<std::milli>, speed_t, acceleration_t>::value, "" );
+static_assert( !std::is_constructible<position_t, meters<>, meters<>, acceleration_t>::value, "" );
+static_assert( !std::is_constructible<position_t, meters<>, speed_t, speed_t>::value, "" );
+static_assert( !std::is_constructible<position_t, meters<>, speed_t>::value, "" );
+
+// coefficient
+static_assert( position_t{meters<>{1.0}, speed_t{2.0}, acceleration_t{3.0}}.coefficient<1>() == speed_t{2.0}, "" );
+static_assert( position_t::degree == 2, "" );
+
+} // end of anonymous namespace
+
+void si::run_polynomial_tests()
+{
+    using namespace si;
+
+    const position_t thePosition{meters<>{1.0}, speed_t{2.0}, acceleration_t{3.0}};
+
+    // evaluate
+    {
+    assert( thePosition(seconds<>{0.0}) == meters<>{1.0} );
+    assert( thePosition(seconds<>{2.0}) == meters<>{1.0 + 4.0 + 12.0} );
+    assert( thePosition(milliseconds<>{500.0}) == meters<>{1.0 + 1.0 + 0.75} );
+    }
+
+    // degree zero
+    {
+    const polynomial<kelvins<>, ohms<>, 0> theConstant{ohms<>{5.0}};
+    assert( theConstant(kelvins<>{300.0}) == ohms<>{5.0} );
+    }
+
+    // coefficients relative to an argument interval
+    {
+    using ms_t = milliseconds<>;
+    const polynomial<ms_t, meters<>, 1> theLine{meters<>{0.0}, coefficient_units<ms_t, meters<>, 1>{speed_t{4.0}}};
+    assert( theLine(ms_t{250.0}) == meters<>{1.0} );
+    }
+
+    // block matches single evaluations
+    {
+    std::vector<seconds<>> theTimes;
+    for( int i = 0; i < 37; ++i )
+    {
+        theTimes.push_back(seconds<>{i * 0.25 - 3.0});
+    }
+    std::vector<meters<>> thePositions(theTimes.size());
+    thePosition(theTimes, thePositions);
+    for( std::size_t i = 0; i < theTimes.size(); ++i )
+    {
+        assert( thePositions[i] == thePosition(theTimes[i]) );
+    }
+    }
+}
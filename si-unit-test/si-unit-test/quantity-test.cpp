@@ -1,6 +1,7 @@
 #include <iostream>
 #include "helpers.hpp"
 #include "quantity.hpp"
+#include "units-io.hpp"
 #include "quantity-test.hpp"
 
 // compile-time unit tests
@@ -1,6 +1,7 @@
 #include <iostream>
 #include "helpers.hpp"
 #include "ratio.hpp"
+#include "units-io.hpp"
 #include "ratio-test.hpp"
 
 // compile-time unit tests
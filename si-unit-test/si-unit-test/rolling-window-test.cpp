@@ -0,0 +1,116 @@
+#include <iostream>
+#include "helpers.hpp"
+#include "rolling-window.hpp"
+#include "rolling-window-test.hpp"
+
+// compile-time unit tests
+namespace
+{
+
+using namespace si;
+
+// rate_t
+static_assert( std::is_same<rolling_window<joules<>>::rate_t, watts<>>::value, "" );
+
+} // end of anonymous namespace
+
+void si::run_rolling_window_tests()
+{
+    using namespace si;
+
+    // span given as std::chrono::duration
+    {
+    rolling_window<watts<>, milliseconds<>> theWindow{std::chrono::seconds{2}, 8};
+    assert( theWindow.span() == seconds<>{2.0} );
+    assert( theWindow.capacity() == 8 );
+    assert( theWindow.empty() );
+    assert( theWindow.sum() == watts<>{0.0} );
+    }
+
+    // samples older than the span are evicted
+    {
+    rolling_window<watts<>> theWindow{seconds<>{3.0}, 16};
+    theWindow.push(watts<>{4.0}, seconds<>{0.0});
+    theWindow.push(watts<>{1.0}, seconds<>{1.0});
+    theWindow.push(watts<>{7.0}, seconds<>{2.0});
+    assert( theWindow.size() == 3 );
+    assert( theWindow.sum() == watts<>{12.0} );
+    assert( theWindow.mean() == watts<>{4.0} );
+    assert( theWindow.minimum() == watts<>{1.0} );
+    assert( theWindow.maximum() == watts<>{7.0} );
+
+    theWindow.push(watts<>{2.0}, seconds<>{3.0});
+    assert( theWindow.size() == 3 );
+    assert( theWindow.oldest() == watts<>{1.0} );
+    assert( theWindow.newest() == watts<>{2.0} );
+    assert( theWindow.sum() == watts<>{10.0} );
+
+    theWindow.push(watts<>{3.0}, seconds<>{4.5});
+    assert( theWindow.size() == 3 );
+    assert( theWindow.minimum() == watts<>{2.0} );
+    assert( theWindow.maximum() == watts<>{7.0} );
+
+    theWindow.expire(seconds<>{7.0});
+    assert( theWindow.size() == 1 );
+    assert( theWindow.mean() == watts<>{3.0} );
+
+    theWindow.expire(seconds<>{7.5});
+    assert( theWindow.empty() );
+    assert( theWindow.sum() == watts<>{0.0} );
+    }
+
+    // the oldest sample is evicted when the window is full
+    {
+    using int_meters = meters<r_one, int>;
+    rolling_window<int_meters> theWindow{seconds<>{100.0}, 3};
+    const int theValues[] = {5, 3, 8, 6, 9, 1, 4};
+    const int theMinimums[] = {5, 3, 3, 3, 6, 1, 1};
+    const int theMaximums[] = {5, 5, 8, 8, 9, 9, 9};
+    for( int i = 0; i < 7; ++i )
+    {
+        theWindow.push(int_meters{theValues[i]}, seconds<>{static_cast<double>(i)});
+        assert( theWindow.size() == static_cast<std::size_t>(std::min(i + 1, 3)) );
+        assert( theWindow.minimum() == int_meters{theMinimums[i]} );
+        assert( theWindow.maximum() == int_meters{theMaximums[i]} );
+    }
+    assert( theWindow.sum() == int_meters{14} );
+    }
+
+    // an emptied window sums to exactly zero
+    {
+    rolling_window<watts<>> theWindow{seconds<>{1.0}, 8};
+    theWindow.push(watts<>{0.1}, seconds<>{0.0});
+    theWindow.push(watts<>{0.2}, seconds<>{0.0});
+    theWindow.push(watts<>{0.3}, seconds<>{0.0});
+    theWindow.expire(seconds<>{2.0});
+    assert( theWindow.empty() );
+    assert( theWindow.sum() == watts<>{0.0} );
+    }
+
+    // the sum does not drift over a long run of pushes and evictions
+    {
+    const auto theValue = [](int i) {return 0.1 * (i % 7) + (i % 3 == 0 ? 1e6 : 0.0) + 1e-3 * (i % 11);};
+    rolling_window<watts<>> theWindow{seconds<>{1e9}, 10};
+    for( int i = 0; i < 1000000; ++i )
+    {
+        theWindow.push(watts<>{theValue(i)}, seconds<>{static_cast<double>(i)});
+    }
+    double theSum = 0.0;
+    for( int i = 1000000 - 10; i < 1000000; ++i )
+    {
+        theSum += theValue(i);
+    }
+    assert( std::abs(theWindow.sum().value() - theSum) < 1e-8 );
+    }
+
+    // rate of a cumulative counter
+    {
+    rolling_window<joules<>> theWindow{seconds<>{10.0}, 4};
+    theWindow.push(joules<>{100.0}, seconds<>{1.0});
+    theWindow.push(joules<>{120.0}, seconds<>{2.0});
+    theWindow.push(joules<>{160.0}, seconds<>{5.0});
+    assert( theWindow.rate() == watts<>{15.0} );
+    theWindow.clear();
+    assert( theWindow.empty() );
+    }
+}
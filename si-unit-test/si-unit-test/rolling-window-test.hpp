@@ -0,0 +1,8 @@
+#pragma once
+
+namespace si
+{
+
+void run_rolling_window_tests();
+
+} // end of namespace si
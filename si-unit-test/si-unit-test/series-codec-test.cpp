@@ -0,0 +1,168 @@
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <vector>
+#include "helpers.hpp"
+#include "series-codec.hpp"
+#include "series-codec-test.hpp"
+
+// compile-time unit tests
+namespace
+{
+
+using namespace si;
+
+static_assert( zigzag_encode(0) == 0, "" );
+static_assert( zigzag_encode(static_cast<std::uint64_t>(-1)) == 1, "" );
+static_assert( zigzag_encode(1) == 2, "" );
+static_assert( zigzag_decode(zigzag_encode(static_cast<std::uint64_t>(-1234567))) == static_cast<std::uint64_t>(-1234567), "" );
+static_assert( zigzag_decode(zigzag_encode(std::uint64_t{1} << 63)) == std::uint64_t{1} << 63, "" );
+
+static_assert( std::is_same<series_bits_t<float>, std::uint32_t>::value, "" );
+static_assert( std::is_same<series_bits_t<double>, std::uint64_t>::value, "" );
+static_assert( std::is_same<series_bits_t<std::int32_t>, std::uint64_t>::value, "" );
+
+} // end of anonymous namespace
+
+void si::run_series_codec_tests()
+{
+    using namespace si;
+    using Times_t = seconds<std::nano, std::int64_t>;
+
+    // bit fields straddle words
+    {
+    series_bit_writer theWriter;
+    theWriter.write(0b101, 3);
+    theWriter.write(0x0123456789abcdef, 64);
+    theWriter.write(0x7f, 7);
+    const auto theWords = theWriter.words();
+    assert( theWords.size() == 2 );
+    std::vector<std::byte> theBytes(16);
+    put_wire_field(theBytes, 0, theWords[0]);
+    put_wire_field(theBytes, 8, theWords[1]);
+    series_bit_reader theReader{theBytes};
+    assert( theReader.read(3) == 0b101 );
+    assert( theReader.read(64) == 0x0123456789abcdef );
+    assert( theReader.read(7) == 0x7f );
+    assert( theReader.good() );
+    assert( theReader.read(64) == 0 );
+    assert( !theReader.good() );
+    }
+
+    // regular timestamps take about a bit each, and jitter a few more
+    {
+    series_encoder<Times_t> theRegular;
+    series_encoder<Times_t> theEncoder;
+    std::vector<Times_t> theTimes;
+    for( std::int64_t i = 0; i < 10000; ++i )
+    {
+        theRegular.push(Times_t{1700000000000000000 + i * 1000000});
+        theTimes.push_back(Times_t{1700000000000000000 + i * 1000000 + (i % 10 == 0 ? (i % 7) * 100 : 0)});
+    }
+    assert( theRegular.finish().size() < theRegular.size() * 2 / 8 );
+    theEncoder.push(std::span<const Times_t>{theTimes});
+    assert( theEncoder.size() == theTimes.size() );
+    const auto theBlock = theEncoder.finish();
+    assert( theBlock.size() < theTimes.size() * sizeof(Times_t) / 8 );
+    assert( series_count(theBlock) == theTimes.size() );
+    assert( decode_series<Times_t>(theBlock) == theTimes );
+    }
+
+    // slowly varying readings, repeated and changing in few bits
+    {
+    series_encoder<watts<std::kilo>> theEncoder;
+    std::vector<watts<std::kilo>> thePower;
+    for( int i = 0; i < 10000; ++i )
+    {
+        thePower.push_back(watts<std::kilo>{12.5 + (i / 50) * 0.25});
+    }
+    thePower.push_back(watts<std::kilo>{-0.0});
+    thePower.push_back(watts<std::kilo>{std::numeric_limits<double>::infinity()});
+    thePower.push_back(watts<std::kilo>{std::numeric_limits<double>::denorm_min()});
+    theEncoder.push(std::span<const watts<std::kilo>>{thePower});
+    const auto theBlock = theEncoder.finish();
+    assert( theBlock.size() < thePower.size() * sizeof(double) / 8 );
+
+    const auto theDecoded = decode_series<watts<std::kilo>>(theBlock);
+    assert( theDecoded );
+    assert( theDecoded->size() == thePower.size() );
+    for( std::size_t i = 0; i < thePower.size(); ++i )
+    {
+        assert( std::bit_cast<std::uint64_t>((*theDecoded)[i].value()) == std::bit_cast<std::uint64_t>(thePower[i].value()) );
+    }
+    }
+
+    // extreme deltas wrap, and floats of all widths of change round trip
+    {
+    using Counts_t = joules<r_one, std::int32_t>;
+    const std::vector<Counts_t> theCounts =
+    {
+        Counts_t{std::numeric_limits<std::int32_t>::min()},
+        Counts_t{std::numeric_limits<std::int32_t>::max()},
+        Counts_t{0},
+        Counts_t{-1},
+        Counts_t{std::numeric_limits<std::int32_t>::min()},
+        Counts_t{64},
+        Counts_t{-64}
+    };
+    series_encoder<Counts_t> theEncoder;
+    theEncoder.push(std::span<const Counts_t>{theCounts});
+    assert( decode_series<Counts_t>(theEncoder.finish()) == theCounts );
+
+    series_encoder<meters<r_one, float>> theFloatEncoder;
+    std::vector<meters<r_one, float>> theLengths;
+    float theLength = 1.0f;
+    for( int i = 0; i < 1000; ++i )
+    {
+        theLength = theLength * 1.37f + static_cast<float>(i % 3);
+        theLength = theLength > 1e30f ? -1e-30f : theLength;
+        theLengths.push_back(meters<r_one, float>{theLength});
+    }
+    theFloatEncoder.push(std::span<const meters<r_one, float>>{theLengths});
+    assert( (decode_series<meters<r_one, float>>(theFloatEncoder.finish()) == theLengths) );
+    }
+
+    // decoding into another interval converts, in reads of any size
+    {
+    series_encoder<Times_t> theEncoder;
+    for( std::int64_t i = 0; i < 1000; ++i )
+    {
+        theEncoder.push(Times_t{i * 1500000});
+    }
+    const auto theBlock = theEncoder.finish();
+
+    using Milliseconds_t = seconds<std::milli, std::int64_t>;
+    auto theDecoder = series_decoder<Milliseconds_t>::open(theBlock);
+    assert( theDecoder );
+    std::vector<Milliseconds_t> theTimes(1000);
+    assert( theDecoder->read(std::span{theTimes}.first(7)) == 7 );
+    assert( theDecoder->remaining() == 993 );
+    assert( theDecoder->read(std::span{theTimes}.subspan(7)) == 993 );
+    assert( theDecoder->good() );
+    for( std::int64_t i = 0; i < 1000; ++i )
+    {
+        assert( theTimes[i] == (units_cast<Milliseconds_t>(Times_t{i * 1500000})) );
+    }
+
+    const auto theDoubles = decode_series<seconds<std::micro, std::int64_t>>(theBlock);
+    assert( theDoubles && (*theDoubles)[999] == (seconds<std::micro, std::int64_t>{1498500}) );
+    }
+
+    // blocks of other units, value types or lengths are refused
+    {
+    series_encoder<Times_t> theEncoder;
+    for( std::int64_t i = 0; i < 100; ++i )
+    {
+        theEncoder.push(Times_t{i * i});
+    }
+    auto theBlock = theEncoder.finish();
+    assert( (!decode_series<meters<std::nano, std::int64_t>>(theBlock)) );
+    assert( (!decode_series<seconds<std::nano, double>>(theBlock)) );
+    assert( !decode_series<Times_t>(std::span{theBlock}.first(theBlock.size() - 8)) );
+    assert( !series_count(std::span{theBlock}.first(40)) );
+
+    // a count beyond the bits is caught while decoding
+    put_wire_field(theBlock, 32, 120);
+    assert( !decode_series<Times_t>(theBlock) );
+    }
+}
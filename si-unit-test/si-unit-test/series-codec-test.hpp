@@ -0,0 +1,8 @@
+#pragma once
+
+namespace si
+{
+
+void run_series_codec_tests();
+
+} // end of namespace si
@@ -0,0 +1,106 @@
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <vector>
+#include "helpers.hpp"
+#include "sharded-accumulator.hpp"
+#include "sharded-accumulator-test.hpp"
+
+// compile-time unit tests
+namespace
+{
+
+using namespace si;
+
+static_assert( std::is_same<sharded_accumulator<joules<>>::snapshot_t, accumulator_snapshot<joules<>>>::value, "" );
+
+} // end of anonymous namespace
+
+void si::run_sharded_accumulator_tests()
+{
+    using namespace si;
+
+    // a single thread
+    {
+    sharded_accumulator<seconds<std::milli>> theLatency;
+    auto theTotals = theLatency.snapshot();
+    assert( theTotals.count == 0 );
+    assert( theTotals.sum == seconds<std::milli>{0.0} );
+    assert( theTotals.minimum == seconds<std::milli>::max() );
+
+    theLatency.add(seconds<std::milli>{4.0});
+    theLatency.add(seconds<>{0.002});
+    theLatency.add(seconds<std::micro>{9000.0});
+    theTotals = theLatency.snapshot();
+    assert( theTotals.count == 3 );
+    assert( theTotals.sum == seconds<std::milli>{15.0} );
+    assert( theTotals.minimum == seconds<std::milli>{2.0} );
+    assert( theTotals.maximum == seconds<std::milli>{9.0} );
+    assert( theLatency.slot_count() == 1 );
+    }
+
+    // many threads, with snapshots taken while they add
+    {
+    using Joules_t = joules<r_one, std::int64_t>;
+    constexpr int theThreadCount = 8;
+    constexpr int theAddCount = 50000;
+    sharded_accumulator<Joules_t> theEnergy;
+    std::atomic<bool> isDone{false};
+    std::thread theCollector([&]
+    {
+        std::uint64_t thePrevious = 0;
+        while( !isDone.load() )
+        {
+            // each add is of 1 J, so a consistent read has sum == count
+            const auto theTotals = theEnergy.snapshot();
+            assert( theTotals.sum.value() == static_cast<std::int64_t>(theTotals.count) );
+            assert( theTotals.count >= thePrevious );
+            thePrevious = theTotals.count;
+        }
+    });
+
+    for( int theRound = 0; theRound < 2; ++theRound )
+    {
+        std::vector<std::thread> theThreads;
+        for( int i = 0; i < theThreadCount; ++i )
+        {
+            theThreads.emplace_back([&]
+            {
+                for( int j = 0; j < theAddCount; ++j )
+                {
+                    theEnergy.add(Joules_t{1});
+                }
+            });
+        }
+        for( auto& theThread : theThreads )
+        {
+            theThread.join();
+        }
+    }
+    isDone = true;
+    theCollector.join();
+
+    // the second round took the slots given back by the first
+    const auto theTotals = theEnergy.snapshot();
+    assert( theTotals.count == 2 * theThreadCount * theAddCount );
+    assert( theTotals.sum == (Joules_t{2 * theThreadCount * theAddCount}) );
+    assert( theTotals.minimum == Joules_t{1} );
+    assert( theTotals.maximum == Joules_t{1} );
+    assert( theEnergy.slot_count() <= 2 * theThreadCount );
+    }
+
+    // the accumulator may be destroyed before the threads that added exit
+    {
+    auto theAccumulator = std::make_unique<sharded_accumulator<joules<>>>();
+    std::thread theThread([&]
+    {
+        theAccumulator->add(joules<>{1.0});
+        theAccumulator.reset();
+        sharded_accumulator<joules<>> theNext;
+        theNext.add(joules<>{2.0});
+        assert( theNext.snapshot().sum == joules<>{2.0} );
+    });
+    theThread.join();
+    }
+}
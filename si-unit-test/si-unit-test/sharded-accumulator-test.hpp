@@ -0,0 +1,8 @@
+#pragma once
+
+namespace si
+{
+
+void run_sharded_accumulator_tests();
+
+} // end of namespace si
@@ -1,7 +1,31 @@
 #include "units-test.hpp"
+#include "units-core-test.hpp"
 #include "quantity-test.hpp"
 #include "ratio-test.hpp"
 #include "exponent-test.hpp"
+#include "calculus-test.hpp"
+#include "rolling-window-test.hpp"
+#include "filter-test.hpp"
+#include "lookup-table-test.hpp"
+#include "polynomial-test.hpp"
+#include "vec-test.hpp"
+#include "matrix-test.hpp"
+#include "complex-test.hpp"
+#include "measurement-test.hpp"
+#include "dual-test.hpp"
+#include "fast-math-test.hpp"
+#include "constexpr-math-test.hpp"
+#include "binary-angle-test.hpp"
+#include "angle-wrap-test.hpp"
+#include "atomic-units-test.hpp"
+#include "sharded-accumulator-test.hpp"
+#include "wire-format-test.hpp"
+#include "column-file-test.hpp"
+#include "series-codec-test.hpp"
+#include "unit-symbol-test.hpp"
+#include "csv-test.hpp"
+#include "json-test.hpp"
+#include "extern-templates-test.hpp"
 
 int main(int argc, const char * argv[])
 {
@@ -10,7 +34,31 @@ int main(int argc, const char * argv[])
     run_ratio_tests();
     run_quantity_tests();
     run_units_tests();
+    run_units_core_tests();
     run_exponent_tests();
+    run_constexpr_math_tests();
+    run_calculus_tests();
+    run_rolling_window_tests();
+    run_filter_tests();
+    run_lookup_table_tests();
+    run_polynomial_tests();
+    run_vec_tests();
+    run_matrix_tests();
+    run_complex_tests();
+    run_measurement_tests();
+    run_dual_tests();
+    run_fast_math_tests();
+    run_binary_angle_tests();
+    run_angle_wrap_tests();
+    run_atomic_units_tests();
+    run_sharded_accumulator_tests();
+    run_wire_format_tests();
+    run_column_file_tests();
+    run_series_codec_tests();
+    run_unit_symbol_tests();
+    run_csv_tests();
+    run_json_tests();
+    run_extern_templates_tests();
 
     return 0;
 }
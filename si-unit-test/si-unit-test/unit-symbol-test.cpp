@@ -0,0 +1,74 @@
+#include <string_view>
+#include "helpers.hpp"
+#include "unit-symbol.hpp"
+#include "unit-symbol-test.hpp"
+
+// compile-time unit tests
+namespace
+{
+
+using namespace si;
+using namespace std::string_view_literals;
+
+using Acceleration_t = units_t<double, r_one, divide_quantity<length, power_quantity<si::time, 2>>>;
+
+// symbols of their own take prefixes, or names for times
+static_assert( unit_symbol<watts<std::kilo>> == "kW"sv, "" );
+static_assert( unit_symbol<seconds<std::milli>> == "ms"sv, "" );
+static_assert( unit_symbol<seconds<std::micro>> == "µs"sv, "" );
+static_assert( unit_symbol<minutes<>> == "min"sv, "" );
+static_assert( unit_symbol<hours<>> == "h"sv, "" );
+static_assert( unit_symbol<kilograms<>> == "kg"sv, "" );
+static_assert( unit_symbol<grams<>> == "g"sv, "" );
+static_assert( unit_symbol<kilograms<std::micro>> == "mg"sv, "" );
+static_assert( unit_symbol<ohms<std::mega>> == "MΩ"sv, "" );
+static_assert( unit_symbol<units_t<double, r_one, none>> == ""sv, "" );
+
+// other quantities as string_from writes them
+static_assert( unit_symbol<Acceleration_t> == "m/s²"sv, "" );
+static_assert( unit_symbol<units_t<double, r_one, reciprocal_quantity<length>>> == "1/m"sv, "" );
+static_assert( unit_symbol<units_t<double, r_one, multiply_quantity<mass, length>>> == "kg·m"sv, "" );
+
+// intervals with no symbol
+static_assert( !has_unit_symbol<seconds<std::ratio<7>>>, "" );
+static_assert( !has_unit_symbol<units_t<double, std::kilo, Acceleration_t::quantity_t>>, "" );
+static_assert( !has_unit_symbol<units_t<double, std::milli, none>>, "" );
+
+// symbols parse as written and as typed
+static_assert( parse_unit_symbol("kW") == unit_descriptor_of<watts<std::kilo>>(), "" );
+static_assert( parse_unit_symbol(unit_symbol<Acceleration_t>) == unit_descriptor_of<Acceleration_t>(), "" );
+static_assert( parse_unit_symbol(" m/s^2 ") == unit_descriptor_of<Acceleration_t>(), "" );
+static_assert( parse_unit_symbol("m*s-2") == unit_descriptor_of<Acceleration_t>(), "" );
+static_assert( parse_unit_symbol("us") == unit_descriptor_of<seconds<std::micro>>(), "" );
+static_assert( parse_unit_symbol("μs") == unit_descriptor_of<seconds<std::micro>>(), "" );
+static_assert( parse_unit_symbol("mg") == unit_descriptor_of<kilograms<std::micro>>(), "" );
+static_assert( parse_unit_symbol("h") == unit_descriptor_of<hours<>>(), "" );
+static_assert( parse_unit_symbol("hPa") == unit_descriptor_of<pascals<std::hecto>>(), "" );
+static_assert( parse_unit_symbol("mmol") == unit_descriptor_of<moles<std::milli>>(), "" );
+static_assert( parse_unit_symbol("kW.h") == unit_descriptor_of<joules<std::ratio<3600000>>>(), "" );
+static_assert( parse_unit_symbol("km/h") == unit_descriptor_of<units_t<double, std::ratio<5, 18>, divide_quantity<length, si::time>>>(), "" );
+static_assert( parse_unit_symbol("1/s") == unit_descriptor_of<hertz<>>(), "" );
+static_assert( parse_unit_symbol("") == unit_descriptor_of<units_t<double, r_one, none>>(), "" );
+static_assert( parse_unit_symbol("1") == unit_descriptor_of<units_t<double, r_one, none>>(), "" );
+
+// and other text does not
+static_assert( !parse_unit_symbol("kkW"), "" );
+static_assert( !parse_unit_symbol("m//s"), "" );
+static_assert( !parse_unit_symbol("m/s/s"), "" );
+static_assert( !parse_unit_symbol("m/"), "" );
+static_assert( !parse_unit_symbol("kh"), "" );
+static_assert( !parse_unit_symbol("m^0"), "" );
+static_assert( !parse_unit_symbol("furlong"), "" );
+static_assert( !parse_unit_symbol("Em^9"), "" );
+
+} // end of anonymous namespace
+
+void si::run_unit_symbol_tests()
+{
+    using namespace si;
+
+    // the symbols are stored once and end with a null
+    assert( unit_symbol<watts<std::kilo>>.data() == unit_symbol<watts<std::kilo>>.data() );
+    assert( unit_symbol<watts<std::kilo>>.data()[2] == '\0' );
+    assert( unit_descriptor_of<watts<std::kilo>>().num == 1000 );
+}
@@ -0,0 +1,8 @@
+#pragma once
+
+namespace si
+{
+
+void run_unit_symbol_tests();
+
+} // end of namespace si
@@ -0,0 +1,46 @@
+#include "units-core.hpp"
+#include "helpers.hpp"
+#include "units-core-test.hpp"
+
+// compile-time unit tests, with units-core.hpp alone
+namespace
+{
+
+using namespace si;
+
+static_assert( meters<std::kilo>{2.0} + meters<>{500.0} == meters<>{2500.0}, "" );
+static_assert( meters<>{10.0} / seconds<>{2.0} == (units_t<double, r_one, divide_quantity<length, si::time>>{5.0}), "" );
+static_assert( units_cast<meters<std::milli, long long>>(meters<r_one, long long>{3}) == meters<std::milli, long long>{3000}, "" );
+static_assert( meters<>{1.0} < meters<std::kilo>{1.0}, "" );
+static_assert( seconds<r_one, int>::max().value() == std::numeric_limits<int>::max(), "" );
+
+// the interval of an intmax_t ratio at the limit does not overflow
+static_assert( !std::is_convertible<meters<std::ratio<INTMAX_MAX>>, meters<std::ratio<1, INTMAX_MAX>>>::value, "" );
+
+// the named concepts of the constraints
+static_assert( Units<meters<>> && !Units<double>, "" );
+static_assert( SameQuantity<meters<>, meters<std::kilo, int>> && !SameQuantity<meters<>, seconds<>>, "" );
+static_assert( LosslessValue<int, double> && !LosslessValue<double, int>, "" );
+static_assert( LosslessConvertible<meters<std::kilo, int>, meters<r_one, int>>, "" );
+static_assert( !LosslessConvertible<meters<r_one, int>, meters<std::kilo, int>>, "" );
+static_assert( LosslessConvertible<meters<r_one, int>, meters<std::kilo, double>>, "" );
+static_assert( !LosslessConvertible<meters<>, seconds<>>, "" );
+
+// <=> orders units_t of different intervals and value_t
+static_assert( (meters<std::kilo, int>{1} <=> meters<r_one, int>{999}) > 0, "" );
+static_assert( meters<std::milli, int>{1500} >= meters<r_one, int>{1}, "" );
+static_assert( meters<>{1.0} != meters<std::milli>{1.0}, "" );
+static_assert( !(meters<>{std::numeric_limits<double>::quiet_NaN()} <= meters<>{0.0}), "" );
+
+} // end of anonymous namespace
+
+void si::run_units_core_tests()
+{
+    using namespace si;
+
+    meters<> theLength{1.5};
+    theLength += meters<std::milli>{500.0};
+    assert( theLength == meters<>{2.0} );
+    assert( theLength * 2.0 == meters<>{4.0} );
+    assert( newtons<>{6.0} * meters<>{2.0} == joules<>{12.0} );
+}
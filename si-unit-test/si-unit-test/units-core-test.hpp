@@ -0,0 +1,8 @@
+#pragma once
+
+namespace si
+{
+
+void run_units_core_tests();
+
+} // end of namespace si
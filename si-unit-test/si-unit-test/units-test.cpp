@@ -241,6 +241,22 @@ static_assert( 1.0_H == henries<>{1}, "" );
 static_assert( 1.0_lm == lumens<>{1}, "" );
 static_assert( 1.0_lx == lux<>{1}, "" );
 
+// math functions fold during constant evaluation
+static_assert( square_root(seconds<std::mega>{4.0}) == seconds<std::kilo>{2.0}, "" );
+static_assert( square_root(meters<>{2.0} * meters<>{1.0}).value() == 1.4142135623730951, "" );
+static_assert( square_root(meters<r_one, float>{2.0f} * meters<r_one, float>{1.0f}).value() == 1.41421356f, "" );
+static_assert( sine(radians<>{0.0}) == scalar<>{0.0}, "" );
+static_assert( cosine(radians<std::milli>{0.0}) == scalar<>{1.0}, "" );
+static_assert( tangent(radians<>{0.0}) == scalar<>{0.0}, "" );
+static_assert( arc_sine(scalar<>{1.0}) == radians<>{std::numbers::pi / 2}, "" );
+static_assert( arc_cosine(scalar<>{-1.0}) == radians<>{std::numbers::pi}, "" );
+static_assert( arc_tangent(scalar<>{1.0}) == radians<>{std::numbers::pi / 4}, "" );
+
+// a derived constant, the length of a photon's wavelength at 1 eV
+constexpr auto thePhotonEnergy = joules<>{1.602176634e-19};
+constexpr auto theWavelength = h<> * c<> / thePhotonEnergy;
+static_assert( square_root(theWavelength * theWavelength) == theWavelength, "" );
+
 } // end of anonymous namespace
 
 void si::run_units_tests()
@@ -416,6 +432,12 @@ void si::run_units_tests()
     using int_meters = meters<std::ratio<1>,int>;
     assert( absolute(int_meters{-1}) == int_meters{1} );
     assert( absolute(meters<>{-1.0}) == meters<>{1.0} );
+
+    // keeps a value_t narrower than int
+    using short_meters = meters<std::ratio<1>,short>;
+    static_assert( std::is_same<decltype(absolute(short_meters{})), short_meters>::value, "" );
+    const short_meters theShort = absolute(short_meters{-3});
+    assert( theShort == short_meters{3} );
     }
 
     // floor
@@ -0,0 +1,104 @@
+#include <cmath>
+#include <iostream>
+#include <vector>
+#include "helpers.hpp"
+#include "vec.hpp"
+#include "vec-test.hpp"
+
+// compile-time unit tests
+namespace
+{
+
+using namespace si;
+
+using position_t = vec<meters<>, 3>;
+using force_t = vec<newtons<>, 3>;
+using velocity_t = vec<divide_units<meters<>, seconds<>>, 3>;
+
+// result units
+static_assert( std::is_same<decltype(dot(position_t{}, force_t{}))::quantity_t, energy>::value, "" );
+static_assert( std::is_same<decltype(cross(position_t{}, force_t{}))::component_t::quantity_t, energy>::value, "" );
+static_assert( std::is_same<decltype(norm(force_t{})), newtons<>>::value, "" );
+static_assert( std::is_same<decltype(normalize(force_t{}))::component_t, scalar<>>::value, "" );
+static_assert( std::is_same<decltype(velocity_t{} * seconds<>{})::component_t::quantity_t, length>::value, "" );
+
+// construction
+static_assert( std::is_constructible<position_t, meters<>, meters<>, meters<>>::value, "" );
+static_assert( !std::is_constructible<position_t, meters<>, meters<>>::value, "" );
+static_assert( !std::is_constructible<position_t, meters<>, meters<>, seconds<>>::value, "" );
+static_assert( vec<meters<std::milli>, 2>{vec<meters<>, 2>{meters<>{1.0}, meters<>{2.0}}}[1] == meters<>{2.0}, "" );
+
+// constexpr arithmetic
+static_assert( position_t{meters<>{1.0}, meters<>{2.0}, meters<>{3.0}} + position_t{meters<>{1.0}, meters<>{1.0}, meters<>{1.0}} == position_t{meters<>{2.0}, meters<>{3.0}, meters<>{4.0}}, "" );
+static_assert( dot(position_t{meters<>{1.0}, meters<>{2.0}, meters<>{3.0}}, force_t{newtons<>{4.0}, newtons<>{5.0}, newtons<>{6.0}}) == joules<>{32.0}, "" );
+
+} // end of anonymous namespace
+
+void si::run_vec_tests()
+{
+    using namespace si;
+
+    // torque is r × F
+    {
+    const position_t theArm{meters<>{2.0}, meters<>{0.0}, meters<>{0.0}};
+    const force_t theForce{newtons<>{0.0}, newtons<>{3.0}, newtons<>{0.0}};
+    const auto theTorque = cross(theArm, theForce);
+    assert( theTorque[0] == joules<>{0.0} );
+    assert( theTorque[1] == joules<>{0.0} );
+    assert( theTorque[2] == joules<>{6.0} );
+    assert( dot(theTorque, theArm) == dot(theTorque, theArm).zero() );
+    }
+
+    // norm and normalize
+    {
+    const vec<meters<>, 2> theVec{meters<>{3.0}, meters<>{4.0}};
+    assert( norm(theVec) == meters<>{5.0} );
+    const auto theUnit = normalize(theVec);
+    assert( std::abs(theUnit[0].value() - 0.6) < 1e-12 );
+    assert( std::abs(theUnit[1].value() - 0.8) < 1e-12 );
+    const vec<meters<std::kilo>, 2> theFar{meters<std::kilo>{3.0}, meters<std::kilo>{4.0}};
+    assert( norm(theFar) == meters<>{5000.0} );
+    }
+
+    // scaling by units
+    {
+    const velocity_t theVelocity{velocity_t::component_t{1.0}, velocity_t::component_t{2.0}, velocity_t::component_t{3.0}};
+    const auto theDisplacement = theVelocity * seconds<>{2.0};
+    assert( theDisplacement == (position_t{meters<>{2.0}, meters<>{4.0}, meters<>{6.0}}) );
+    assert( theDisplacement / 2.0 == (position_t{meters<>{1.0}, meters<>{2.0}, meters<>{3.0}}) );
+    }
+
+    // SoA kernels match the per-vec functions
+    {
+    constexpr std::size_t theCount = 37;
+    vec_array<meters<>, 3> thePositions;
+    vec_array<divide_units<meters<>, seconds<>>, 3> theVelocities;
+    vec_array<newtons<>, 3> theForces;
+    for( std::size_t i = 0; i < theCount; ++i )
+    {
+        const auto x = static_cast<double>(i);
+        thePositions.push_back(position_t{meters<>{x}, meters<>{1.0 - x}, meters<>{2.0}});
+        theVelocities.push_back(velocity_t{velocity_t::component_t{1.0}, velocity_t::component_t{x}, velocity_t::component_t{-x}});
+        theForces.push_back(force_t{newtons<>{2.0 * x}, newtons<>{0.5}, newtons<>{x - 3.0}});
+    }
+    assert( thePositions.size() == theCount );
+    assert( thePositions.component(2).size() == theCount );
+
+    std::vector<joules<>> theWork(theCount);
+    dot(thePositions, theForces, theWork);
+    vec_array<joules<>, 3> theTorques;
+    cross(thePositions, theForces, theTorques);
+    std::vector<meters<>> theDistances(theCount);
+    norm(thePositions, theDistances);
+    for( std::size_t i = 0; i < theCount; ++i )
+    {
+        assert( theWork[i] == dot(thePositions[i], theForces[i]) );
+        assert( theTorques[i] == cross(thePositions[i], theForces[i]) );
+        assert( std::abs((theDistances[i] - norm(thePositions[i])).value()) < 1e-12 );
+    }
+
+    auto theExpected = thePositions[5] + theVelocities[5] * milliseconds<>{500.0};
+    add_product(thePositions, theVelocities, milliseconds<>{500.0});
+    assert( thePositions[5] == theExpected );
+    }
+}
@@ -0,0 +1,100 @@
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+#include "helpers.hpp"
+#include "wire-format.hpp"
+#include "wire-format-test.hpp"
+
+// compile-time unit tests
+namespace
+{
+
+using namespace si;
+
+// value type codes
+static_assert( wire_value_type_of<std::int8_t>() == wire_value_type::int8, "" );
+static_assert( wire_value_type_of<std::uint16_t>() == wire_value_type::uint16, "" );
+static_assert( wire_value_type_of<std::int64_t>() == wire_value_type::int64, "" );
+static_assert( wire_value_type_of<std::uint64_t>() == wire_value_type::uint64, "" );
+static_assert( wire_value_type_of<float>() == wire_value_type::float32, "" );
+static_assert( wire_value_type_of<double>() == wire_value_type::float64, "" );
+
+// byte swaps
+static_assert( byte_swap(std::uint16_t{0x1234}) == 0x3412, "" );
+static_assert( byte_swap(std::uint32_t{0x12345678}) == 0x78563412, "" );
+static_assert( byte_swap(std::uint64_t{0x0102030405060708}) == 0x0807060504030201, "" );
+
+// the header
+constexpr auto theHeader = wire_header<meters<std::milli, float>>(3);
+static_assert( theHeader[0] == std::byte{'s'} && theHeader[3] == std::byte{'1'}, "" );
+static_assert( theHeader[4] == static_cast<std::byte>(wire_value_type::float32), "" );
+static_assert( theHeader[5] == std::byte{4}, "" );
+static_assert( theHeader[9] == std::byte{1}, "" );
+static_assert( get_wire_field(theHeader, 16) == 1 && get_wire_field(theHeader, 24) == 1000, "" );
+static_assert( get_wire_field(theHeader, 32) == 3, "" );
+static_assert( wire_header<newtons<>>(0)[8] == std::byte{1} && wire_header<newtons<>>(0)[10] == std::byte{0xfe}, "" );
+static_assert( wire_size<joules<>>(4) == 72, "" );
+static_assert( is_wire_viewable<joules<>>, "" );
+
+} // end of anonymous namespace
+
+void si::run_wire_format_tests()
+{
+    using namespace si;
+
+    // a round trip without copies on the read side
+    {
+    const std::vector<joules<std::kilo>> theEnergy{joules<std::kilo>{1.5}, joules<std::kilo>{-2.0}, joules<std::kilo>{1e300}};
+    std::vector<std::uint64_t> theStorage(wire_size<joules<std::kilo>>(theEnergy.size()) / 8);
+    const auto theBuffer = std::as_writable_bytes(std::span{theStorage});
+    assert( write_wire(std::span{theEnergy}, theBuffer) == 64 );
+
+    const auto theView = read_wire<joules<std::kilo>>(std::as_bytes(theBuffer));
+    assert( theView && theView->size() == 3 );
+    assert( (*theView)[2] == joules<std::kilo>{1e300} );
+    assert( (theView->data() == reinterpret_cast<const joules<std::kilo>*>(theBuffer.data() + wire_header_size)) );
+
+    // a different interval, quantity or value type is refused
+    assert( !read_wire<joules<>>(std::as_bytes(theBuffer)) );
+    assert( !read_wire<watts<std::kilo>>(std::as_bytes(theBuffer)) );
+    assert( (!read_wire<joules<std::kilo, float>>(std::as_bytes(theBuffer))) );
+
+    // as is a truncated or misaligned buffer
+    assert( !read_wire<joules<std::kilo>>(std::as_bytes(theBuffer).first(63)) );
+    assert( !read_wire<joules<std::kilo>>(std::as_bytes(theBuffer).first(20)) );
+    std::vector<std::uint64_t> theShifted(theStorage.size() + 1);
+    const auto theShiftedBytes = std::as_writable_bytes(std::span{theShifted}).subspan(4, theBuffer.size());
+    std::copy(theBuffer.begin(), theBuffer.end(), theShiftedBytes.begin());
+    assert( !read_wire<joules<std::kilo>>(std::as_bytes(theShiftedBytes)) );
+    }
+
+    // filled in place
+    {
+    std::vector<std::uint64_t> theStorage(wire_size<seconds<std::nano, std::int32_t>>(5) / 8 + 1);
+    const auto theBuffer = std::as_writable_bytes(std::span{theStorage});
+    auto theTimes = prepare_wire<seconds<std::nano, std::int32_t>>(theBuffer, 5);
+    for( std::size_t i = 0; i < theTimes.size(); ++i )
+    {
+        theTimes[i] = seconds<std::nano, std::int32_t>{static_cast<std::int32_t>(i * 100)};
+    }
+    const auto theView = read_wire<seconds<std::nano, std::int32_t>>(std::as_bytes(theBuffer));
+    assert( theView && theView->size() == 5 && (*theView)[4] == (seconds<std::nano, std::int32_t>{400}) );
+    }
+
+    // values in the other byte order are swapped in place once
+    {
+    using Volts_t = volts<std::milli, std::int32_t>;
+    const std::vector<Volts_t> theVolts{Volts_t{0x01020304}, Volts_t{-2}, Volts_t{77}};
+    std::vector<std::uint64_t> theStorage(wire_size<Volts_t>(theVolts.size()) / 8 + 1);
+    const auto theBuffer = std::as_writable_bytes(std::span{theStorage});
+    write_wire(std::span{theVolts}, theBuffer);
+    theBuffer[6] = static_cast<std::byte>(3 - wire_native_byte_order);
+    byte_swap_values<4>(theBuffer.subspan(wire_header_size, 12));
+
+    assert( !read_wire<Volts_t>(std::as_bytes(theBuffer)) );
+    const auto theView = read_wire<Volts_t>(theBuffer);
+    assert( theView && theView->size() == 3 );
+    assert( (*theView)[0] == Volts_t{0x01020304} && (*theView)[1] == Volts_t{-2} && (*theView)[2] == Volts_t{77} );
+    assert( read_wire<Volts_t>(std::as_bytes(theBuffer)) );
+    }
+}
@@ -0,0 +1,445 @@
+#pragma once
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <numbers>
+#include <span>
+#include <type_traits>
+
+#include "constexpr-math.hpp"
+#include "units.hpp"
+
+namespace si
+{
+
+//------------------------------------------------------------------------------
+/// aValue truncated to its leading aBits bits, for a positive aValue
+inline
+constexpr
+long double
+leading_bits
+(
+    long double aValue,
+    int aBits
+)
+{
+    long double theScale = 1;
+    while( aValue >= 2 * theScale )
+    {
+        theScale *= 2;
+    }
+    while( aValue < theScale )
+    {
+        theScale /= 2;
+    }
+    for( int i = 1; i < aBits; ++i )
+    {
+        theScale /= 2;
+    }
+    return static_cast<long double>(static_cast<std::int64_t>(aValue / theScale)) * theScale;
+}
+
+//------------------------------------------------------------------------------
+/// one turn in units of IntervalT, and the half turn. The turn is split into
+/// a high and a middle part of half the digits of ValueT and a low part, so
+/// that the products of the high and middle parts with a number of turns
+/// below 2^(digits/2) are exact, with or without fused multiply-adds.
+template< typename ValueT, typename IntervalT >
+struct angle_period
+{
+    static_assert(std::is_floating_point<ValueT>::value, "angle wrapping requires a floating point value_t");
+
+    static constexpr int split_bits = std::numeric_limits<ValueT>::digits / 2;
+    static constexpr long double exact = 2 * std::numbers::pi_v<long double> * IntervalT::den / IntervalT::num;
+    static constexpr long double exact_high = leading_bits(exact, split_bits);
+    static constexpr long double exact_middle = leading_bits(exact - exact_high, split_bits);
+
+    static constexpr ValueT turn = static_cast<ValueT>(exact);
+    static constexpr ValueT half = turn / 2;
+    static constexpr ValueT high = static_cast<ValueT>(exact_high);
+    static constexpr ValueT middle = static_cast<ValueT>(exact_middle);
+    static constexpr ValueT low = static_cast<ValueT>(exact - exact_high - exact_middle);
+    static constexpr ValueT reciprocal = static_cast<ValueT>(1 / exact);
+    static constexpr ValueT exact_turns = static_cast<ValueT>(std::uint64_t{1} << split_bits);
+};
+
+//------------------------------------------------------------------------------
+/// aValue rounded to the nearest integer, ties to even, for |aValue| below
+/// 2^(digits - 2). Adding 1.5·2^(digits - 1) rounds without a branch or a
+/// conversion to an integer, so that loops vectorize.
+template< typename ValueT >
+inline
+constexpr
+ValueT
+round_to_integer
+(
+    ValueT aValue
+)
+{
+    constexpr ValueT theShift = 3 * static_cast<ValueT>(std::uint64_t{1} << (std::numeric_limits<ValueT>::digits - 2));
+    return (aValue + theShift) - theShift;
+}
+
+//------------------------------------------------------------------------------
+/// aValue, within a turn of [-half turn, half turn) of IntervalT, wrapped into
+/// it. The corrections are selections between constants that are added,
+/// since a subtraction of a selection, or an operation under a condition,
+/// stops the loops from vectorizing.
+template< typename IntervalT, typename ValueT >
+inline
+constexpr
+ValueT
+wrap_half_turn
+(
+    ValueT aValue
+)
+{
+    using Period_t = angle_period<ValueT, IntervalT>;
+    return aValue + ((aValue >= Period_t::half ? -Period_t::turn : ValueT{0}) + (aValue < -Period_t::half ? Period_t::turn : ValueT{0}));
+}
+
+//------------------------------------------------------------------------------
+/// true if aValue is less than 2^(digits/2) turns of IntervalT from zero,
+/// where wrap_pi_near_value is exact; false for infinity and NaN
+template< typename IntervalT, typename ValueT >
+inline
+constexpr
+bool
+is_near_turns
+(
+    ValueT aValue
+)
+{
+    using Period_t = angle_period<ValueT, IntervalT>;
+    const ValueT theTurns = aValue * Period_t::reciprocal;
+    return (theTurns < 0 ? -theTurns : theTurns) < Period_t::exact_turns;
+}
+
+//------------------------------------------------------------------------------
+/// aValue wrapped into [-half turn, half turn) of IntervalT, for aValue that
+/// is_near_turns. The number of turns is removed in three parts, without a
+/// branch, so that loops vectorize.
+template< typename IntervalT, typename ValueT >
+inline
+constexpr
+ValueT
+wrap_pi_near_value
+(
+    ValueT aValue
+)
+{
+    using Period_t = angle_period<ValueT, IntervalT>;
+    const ValueT k = round_to_integer(aValue * Period_t::reciprocal);
+    const ValueT r = ((aValue - k * Period_t::high) - k * Period_t::middle) - k * Period_t::low;
+    return wrap_half_turn<IntervalT>(r);
+}
+
+//------------------------------------------------------------------------------
+/// aValue wrapped into [-half turn, half turn) of IntervalT, for any aValue.
+/// Beyond the near turns, the angle is taken from its sine and cosine in
+/// double radians, whose reduction is exact for every double.
+template< typename IntervalT, typename ValueT >
+inline
+constexpr
+ValueT
+wrap_pi_value
+(
+    ValueT aValue
+)
+{
+    if( is_near_turns<IntervalT>(aValue) )
+    {
+        return wrap_pi_near_value<IntervalT>(aValue);
+    }
+
+    constexpr double theRadians = static_cast<double>(IntervalT::num) / static_cast<double>(IntervalT::den);
+    const auto theSinCos = constexpr_sincos(static_cast<double>(aValue) * theRadians);
+    return wrap_half_turn<IntervalT>(static_cast<ValueT>(constexpr_atan2(theSinCos.sine, theSinCos.cosine) / theRadians));
+}
+
+//------------------------------------------------------------------------------
+/// aValue, wrapped into [-half turn, half turn) of IntervalT, moved into
+/// [0, one turn)
+template< typename IntervalT, typename ValueT >
+inline
+constexpr
+ValueT
+wrap_two_pi_from_pi
+(
+    ValueT aValue
+)
+{
+    using Period_t = angle_period<ValueT, IntervalT>;
+    const ValueT theWrapped = aValue + (aValue < 0 ? Period_t::turn : ValueT{0});
+
+    // a tiny negative aValue rounds up to a whole turn, which is zero
+    return theWrapped >= Period_t::turn ? ValueT{0} : theWrapped;
+}
+
+//------------------------------------------------------------------------------
+/// aValue wrapped into [0, one turn) of IntervalT
+template< typename IntervalT, typename ValueT >
+inline
+constexpr
+ValueT
+wrap_two_pi_value
+(
+    ValueT aValue
+)
+{
+    return wrap_two_pi_from_pi<IntervalT>(wrap_pi_value<IntervalT>(aValue));
+}
+
+//------------------------------------------------------------------------------
+/// true if every aValue(i), i < aCount, is_near_turns, so that a batch may
+/// take the near wrap, which vectorizes
+template< typename IntervalT, typename ValueFunctionT >
+inline
+constexpr
+bool
+all_near_turns
+(
+    std::size_t aCount,
+    ValueFunctionT aValue
+)
+{
+    // a count as wide as the values rather than a bool, so that it vectorizes
+    using Value_t = decltype(aValue(0));
+    using Count_t = std::conditional_t<sizeof(Value_t) <= sizeof(std::uint32_t), std::uint32_t, std::uint64_t>;
+    Count_t theFar = 0;
+    for( std::size_t i = 0; i < aCount; ++i )
+    {
+        theFar += is_near_turns<IntervalT>(aValue(i)) ? 0 : 1;
+    }
+    return theFar == 0;
+}
+
+//------------------------------------------------------------------------------
+/// radians of any interval wrapped into [-π, π), for any finite aRadians.
+/// Below 2^(digits/2) turns the result is within 2 ULP; beyond, it is
+/// computed in double from the sine and cosine. Infinity and NaN give NaN.
+template< typename IntervalT, typename ValueT >
+inline
+constexpr
+radians<IntervalT, ValueT>
+wrap_pi
+(
+    radians<IntervalT, ValueT> aRadians
+)
+{
+    return radians<IntervalT, ValueT>{wrap_pi_value<IntervalT>(aRadians.value())};
+}
+
+//------------------------------------------------------------------------------
+/// radians of any interval wrapped into [0, 2π), for any finite aRadians,
+/// with the precision of wrap_pi
+template< typename IntervalT, typename ValueT >
+inline
+constexpr
+radians<IntervalT, ValueT>
+wrap_two_pi
+(
+    radians<IntervalT, ValueT> aRadians
+)
+{
+    return radians<IntervalT, ValueT>{wrap_two_pi_value<IntervalT>(aRadians.value())};
+}
+
+//------------------------------------------------------------------------------
+/// the shortest signed angle from aRHS to aLHS, in [-π, π) of their common type
+template< typename IntervalT1, typename ValueT1, typename IntervalT2, typename ValueT2 >
+inline
+constexpr
+auto
+angle_diff
+(
+    radians<IntervalT1, ValueT1> aLHS,
+    radians<IntervalT2, ValueT2> aRHS
+)
+{
+    return wrap_pi(aLHS - aRHS);
+}
+
+//------------------------------------------------------------------------------
+/// aResult[i] = wrap_pi(aRadians[i])
+template< typename RadiansT >
+inline
+void
+wrap_pi
+(
+    std::span<RadiansT> aRadians,
+    std::span<std::remove_cv_t<RadiansT>> aResult
+)
+{
+    assert(aResult.size() >= aRadians.size());
+    using Radians_t = std::remove_cv_t<RadiansT>;
+    using Interval_t = typename Radians_t::interval_t;
+    if( all_near_turns<Interval_t>(aRadians.size(), [aRadians](std::size_t i) {return aRadians[i].value();}) )
+    {
+        for( std::size_t i = 0; i < aRadians.size(); ++i )
+        {
+            aResult[i] = Radians_t{wrap_pi_near_value<Interval_t>(aRadians[i].value())};
+        }
+        return;
+    }
+
+    for( std::size_t i = 0; i < aRadians.size(); ++i )
+    {
+        aResult[i] = wrap_pi(aRadians[i]);
+    }
+}
+
+//------------------------------------------------------------------------------
+/// aResult[i] = wrap_two_pi(aRadians[i])
+template< typename RadiansT >
+inline
+void
+wrap_two_pi
+(
+    std::span<RadiansT> aRadians,
+    std::span<std::remove_cv_t<RadiansT>> aResult
+)
+{
+    assert(aResult.size() >= aRadians.size());
+    using Radians_t = std::remove_cv_t<RadiansT>;
+    using Interval_t = typename Radians_t::interval_t;
+    if( all_near_turns<Interval_t>(aRadians.size(), [aRadians](std::size_t i) {return aRadians[i].value();}) )
+    {
+        for( std::size_t i = 0; i < aRadians.size(); ++i )
+        {
+            aResult[i] = Radians_t{wrap_two_pi_from_pi<Interval_t>(wrap_pi_near_value<Interval_t>(aRadians[i].value()))};
+        }
+        return;
+    }
+
+    for( std::size_t i = 0; i < aRadians.size(); ++i )
+    {
+        aResult[i] = wrap_two_pi(aRadians[i]);
+    }
+}
+
+//------------------------------------------------------------------------------
+/// aResult[i] = angle_diff(aLHS[i], aRHS[i])
+template< typename LHST, typename RHST >
+inline
+void
+angle_diff
+(
+    std::span<LHST> aLHS,
+    std::span<RHST> aRHS,
+    std::span<decltype(angle_diff(std::remove_cv_t<LHST>{}, std::remove_cv_t<RHST>{}))> aResult
+)
+{
+    assert(aLHS.size() == aRHS.size());
+    assert(aResult.size() >= aLHS.size());
+    using Result_t = decltype(angle_diff(std::remove_cv_t<LHST>{}, std::remove_cv_t<RHST>{}));
+    using Interval_t = typename Result_t::interval_t;
+    const auto theDifference = [aLHS, aRHS](std::size_t i) {return Result_t{aLHS[i] - aRHS[i]}.value();};
+    if( all_near_turns<Interval_t>(aLHS.size(), theDifference) )
+    {
+        for( std::size_t i = 0; i < aLHS.size(); ++i )
+        {
+            aResult[i] = Result_t{wrap_pi_near_value<Interval_t>(theDifference(i))};
+        }
+        return;
+    }
+
+    for( std::size_t i = 0; i < aLHS.size(); ++i )
+    {
+        aResult[i] = angle_diff(aLHS[i], aRHS[i]);
+    }
+}
+
+//------------------------------------------------------------------------------
+/// Class unwrapper removes the jumps of whole turns from a phase signal that
+/// arrives in chunks, so that each step between samples is in [-π, π). It
+/// keeps the last sample and the number of turns added between chunks.
+/// Each chunk takes two passes: the first counts the turns jumped at each
+/// sample, and vectorizes; the second is a running sum of the counts. The
+/// output is the input plus a whole number of turns, so errors do not
+/// accumulate over long signals.
+template< typename RadiansT >
+class unwrapper
+{
+public:
+
+    //--------------------------------------------------------------------------
+    /// Type aliases
+    using radians_t = RadiansT;
+    using value_t = typename RadiansT::value_t;
+    using interval_t = typename RadiansT::interval_t;
+
+    static_assert(std::is_same<typename RadiansT::quantity_t, angle>::value, "RadiansT must be an angle");
+
+    //--------------------------------------------------------------------------
+    /// unwrap the next chunk of the signal, aInput, into aOutput, which must
+    /// not overlap
+    void
+    operator()
+    (
+        std::span<const RadiansT> aInput,
+        std::span<RadiansT> aOutput
+    )
+    {
+        assert(aOutput.size() >= aInput.size());
+        assert(aInput.empty() || aOutput.data() + aInput.size() <= aInput.data() || aInput.data() + aInput.size() <= aOutput.data());
+        if( aInput.empty() )
+        {
+            return;
+        }
+
+        using Period_t = angle_period<value_t, interval_t>;
+        const auto theFirst = aInput[0].value();
+        aOutput[0] = RadiansT{round_to_integer((theFirst - (mStarted ? mPrevious : theFirst)) * Period_t::reciprocal)};
+        for( std::size_t i = 1; i < aInput.size(); ++i )
+        {
+            aOutput[i] = RadiansT{round_to_integer((aInput[i].value() - aInput[i - 1].value()) * Period_t::reciprocal)};
+        }
+
+        for( std::size_t i = 0; i < aInput.size(); ++i )
+        {
+            mTurns -= aOutput[i].value();
+            aOutput[i] = RadiansT{((aInput[i].value() + mTurns * Period_t::high) + mTurns * Period_t::middle) + mTurns * Period_t::low};
+        }
+
+        mPrevious = aInput[aInput.size() - 1].value();
+        mStarted = true;
+    }
+
+    //--------------------------------------------------------------------------
+    /// start a new signal
+    void
+    reset
+    (
+    )
+    {
+        mPrevious = value_t{};
+        mTurns = value_t{};
+        mStarted = false;
+    }
+
+private:
+
+    value_t mPrevious{};
+    value_t mTurns{};
+    bool mStarted{false};
+
+}; // end of class unwrapper
+
+//------------------------------------------------------------------------------
+/// unwrap the whole signal aInput into aOutput, which must not overlap
+template< typename RadiansT >
+inline
+void
+unwrap
+(
+    std::span<RadiansT> aInput,
+    std::span<std::remove_cv_t<RadiansT>> aOutput
+)
+{
+    unwrapper<std::remove_cv_t<RadiansT>> theUnwrapper;
+    theUnwrapper(aInput, aOutput);
+}
+
+} // end of namespace si
@@ -0,0 +1,320 @@
+#pragma once
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <type_traits>
+
+#include "units.hpp"
+
+namespace si
+{
+
+//------------------------------------------------------------------------------
+/// the size of a cache line, to which shared counters are aligned so that
+/// counters updated by different threads do not share a line. 64 bytes on
+/// x86-64 and most ARM cores; std::hardware_destructive_interference_size is
+/// not used since it may differ between translation units.
+inline constexpr std::size_t cache_line_size = 64;
+
+//------------------------------------------------------------------------------
+/// Class atomic_units is a units_t whose value is a std::atomic, for totals
+/// updated from many threads. fetch_add and fetch_sub take a units_t of any
+/// interval that converts to UnitsT without loss. They are native atomic
+/// additions for an integral value_t, and compare-exchange loops for a
+/// floating point value_t, since std::atomic<double>::fetch_add is not
+/// available in every standard library.
+template< typename UnitsT >
+class atomic_units
+{
+    static_assert(is_units_t<UnitsT>, "UnitsT must be a units_t");
+    static_assert(std::is_arithmetic<typename UnitsT::value_t>::value && !std::is_same<typename UnitsT::value_t, bool>::value, "atomic_units requires an arithmetic value_t");
+
+public:
+
+    //--------------------------------------------------------------------------
+    /// Type aliases
+    using stored_t = UnitsT;
+    using value_t = typename UnitsT::value_t;
+    using interval_t = typename UnitsT::interval_t;
+    using quantity_t = typename UnitsT::quantity_t;
+
+    //--------------------------------------------------------------------------
+    /// Static member constants
+    static constexpr bool is_always_lock_free = std::atomic<value_t>::is_always_lock_free;
+
+    //--------------------------------------------------------------------------
+    /// Initialize to zero
+    constexpr
+    atomic_units
+    (
+    ) noexcept
+    : mValue{value_t{}}
+    {
+    }
+
+    //--------------------------------------------------------------------------
+    /// Initialize to aUnits
+    constexpr
+    atomic_units
+    (
+        UnitsT aUnits
+    ) noexcept
+    : mValue{aUnits.value()}
+    {
+    }
+
+    atomic_units(const atomic_units&) = delete;
+    atomic_units& operator=(const atomic_units&) = delete;
+
+    //--------------------------------------------------------------------------
+    bool
+    is_lock_free
+    (
+    ) const noexcept
+    {
+        return mValue.is_lock_free();
+    }
+
+    //--------------------------------------------------------------------------
+    UnitsT
+    load
+    (
+        std::memory_order aOrder = std::memory_order_seq_cst
+    ) const noexcept
+    {
+        return UnitsT{mValue.load(aOrder)};
+    }
+
+    //--------------------------------------------------------------------------
+    void
+    store
+    (
+        UnitsT aUnits,
+        std::memory_order aOrder = std::memory_order_seq_cst
+    ) noexcept
+    {
+        mValue.store(aUnits.value(), aOrder);
+    }
+
+    //--------------------------------------------------------------------------
+    /// store aUnits and return the previous value
+    UnitsT
+    exchange
+    (
+        UnitsT aUnits,
+        std::memory_order aOrder = std::memory_order_seq_cst
+    ) noexcept
+    {
+        return UnitsT{mValue.exchange(aUnits.value(), aOrder)};
+    }
+
+    //--------------------------------------------------------------------------
+    /// store aDesired if the value equals aExpected, otherwise load the value
+    /// into aExpected; may fail spuriously
+    bool
+    compare_exchange_weak
+    (
+        UnitsT& aExpected,
+        UnitsT aDesired,
+        std::memory_order aOrder = std::memory_order_seq_cst
+    ) noexcept
+    {
+        value_t theExpected = aExpected.value();
+        const bool isExchanged = mValue.compare_exchange_weak(theExpected, aDesired.value(), aOrder);
+        aExpected = UnitsT{theExpected};
+        return isExchanged;
+    }
+
+    //--------------------------------------------------------------------------
+    /// store aDesired if the value equals aExpected, otherwise load the value
+    /// into aExpected
+    bool
+    compare_exchange_strong
+    (
+        UnitsT& aExpected,
+        UnitsT aDesired,
+        std::memory_order aOrder = std::memory_order_seq_cst
+    ) noexcept
+    {
+        value_t theExpected = aExpected.value();
+        const bool isExchanged = mValue.compare_exchange_strong(theExpected, aDesired.value(), aOrder);
+        aExpected = UnitsT{theExpected};
+        return isExchanged;
+    }
+
+    //--------------------------------------------------------------------------
+    /// add aUnits and return the previous value
+    template< typename ValueT2, typename IntervalT2 >
+    typename std::enable_if
+    <
+        std::is_convertible<units_t<ValueT2, IntervalT2, quantity_t>, UnitsT>::value,
+        UnitsT
+    >::type
+    fetch_add
+    (
+        units_t<ValueT2, IntervalT2, quantity_t> aUnits,
+        std::memory_order aOrder = std::memory_order_seq_cst
+    ) noexcept
+    {
+        return UnitsT{fetch_add_value(units_cast<UnitsT>(aUnits).value(), aOrder)};
+    }
+
+    //--------------------------------------------------------------------------
+    /// subtract aUnits and return the previous value
+    template< typename ValueT2, typename IntervalT2 >
+    typename std::enable_if
+    <
+        std::is_convertible<units_t<ValueT2, IntervalT2, quantity_t>, UnitsT>::value,
+        UnitsT
+    >::type
+    fetch_sub
+    (
+        units_t<ValueT2, IntervalT2, quantity_t> aUnits,
+        std::memory_order aOrder = std::memory_order_seq_cst
+    ) noexcept
+    {
+        return UnitsT{fetch_add_value(-units_cast<UnitsT>(aUnits).value(), aOrder)};
+    }
+
+    //--------------------------------------------------------------------------
+    // Operators, sequentially consistent; += and -= return the new value
+    operator UnitsT() const noexcept {return load();}
+    UnitsT operator=(UnitsT aUnits) noexcept {store(aUnits); return aUnits;}
+
+    template< typename ValueT2, typename IntervalT2 >
+    auto operator+=(units_t<ValueT2, IntervalT2, quantity_t> aUnits) noexcept -> decltype(fetch_add(aUnits)) {return fetch_add(aUnits) + units_cast<UnitsT>(aUnits);}
+
+    template< typename ValueT2, typename IntervalT2 >
+    auto operator-=(units_t<ValueT2, IntervalT2, quantity_t> aUnits) noexcept -> decltype(fetch_sub(aUnits)) {return fetch_sub(aUnits) - units_cast<UnitsT>(aUnits);}
+
+private:
+
+    //--------------------------------------------------------------------------
+    value_t
+    fetch_add_value
+    (
+        value_t aDelta,
+        std::memory_order aOrder
+    ) noexcept
+    {
+        if constexpr( std::is_integral<value_t>::value )
+        {
+            return mValue.fetch_add(aDelta, aOrder);
+        }
+        else
+        {
+            value_t theExpected = mValue.load(std::memory_order_relaxed);
+            while( !mValue.compare_exchange_weak(theExpected, theExpected + aDelta, aOrder, std::memory_order_relaxed) )
+            {
+            }
+            return theExpected;
+        }
+    }
+
+    std::atomic<value_t> mValue;
+
+}; // end of class atomic_units
+
+//------------------------------------------------------------------------------
+/// a small number for the calling thread, assigned in the order in which
+/// threads first ask for it, that picks the shard of a sharded counter
+inline
+std::size_t
+this_thread_shard_seed
+(
+) noexcept
+{
+    static std::atomic<std::size_t> theNextSeed{0};
+    thread_local const std::size_t theSeed = theNextSeed.fetch_add(1, std::memory_order_relaxed);
+    return theSeed;
+}
+
+//------------------------------------------------------------------------------
+/// Class sharded_atomic_units is a total updated from many threads that
+/// spreads the additions over ShardCount atomic_units, each on its own cache
+/// line, so that threads do not contend for one line. Each thread adds to
+/// the shard of its this_thread_shard_seed, so up to ShardCount threads
+/// never share a shard. load sums the shards; while other threads add, the
+/// sum is some value the total had between the first and last shard read.
+/// The additions are relaxed, as suits counters and metrics.
+template< typename UnitsT, std::size_t ShardCount = 64 >
+class sharded_atomic_units
+{
+    static_assert(ShardCount > 0, "ShardCount must be positive");
+
+public:
+
+    //--------------------------------------------------------------------------
+    /// Type aliases
+    using stored_t = UnitsT;
+    using value_t = typename UnitsT::value_t;
+    using quantity_t = typename UnitsT::quantity_t;
+
+    //--------------------------------------------------------------------------
+    /// Static member constants
+    static constexpr std::size_t shard_count = ShardCount;
+
+    //--------------------------------------------------------------------------
+    /// add aUnits to the shard of the calling thread
+    template< typename ValueT2, typename IntervalT2 >
+    void
+    add
+    (
+        units_t<ValueT2, IntervalT2, quantity_t> aUnits
+    ) noexcept
+    {
+        mShards[this_thread_shard_seed() % ShardCount].units.fetch_add(aUnits, std::memory_order_relaxed);
+    }
+
+    //--------------------------------------------------------------------------
+    /// subtract aUnits from the shard of the calling thread
+    template< typename ValueT2, typename IntervalT2 >
+    void
+    subtract
+    (
+        units_t<ValueT2, IntervalT2, quantity_t> aUnits
+    ) noexcept
+    {
+        mShards[this_thread_shard_seed() % ShardCount].units.fetch_sub(aUnits, std::memory_order_relaxed);
+    }
+
+    //--------------------------------------------------------------------------
+    /// the sum of the shards
+    UnitsT
+    load
+    (
+    ) const noexcept
+    {
+        auto theTotal = UnitsT::zero();
+        for( const auto& theShard : mShards )
+        {
+            theTotal += theShard.units.load(std::memory_order_relaxed);
+        }
+        return theTotal;
+    }
+
+    //--------------------------------------------------------------------------
+    /// set every shard to zero; additions made meanwhile may be lost
+    void
+    reset
+    (
+    ) noexcept
+    {
+        for( auto& theShard : mShards )
+        {
+            theShard.units.store(UnitsT::zero(), std::memory_order_relaxed);
+        }
+    }
+
+private:
+
+    struct alignas(cache_line_size) shard
+    {
+        atomic_units<UnitsT> units;
+    };
+
+    std::array<shard, ShardCount> mShards{};
+
+}; // end of class sharded_atomic_units
+
+} // end of namespace si
@@ -0,0 +1,278 @@
+#pragma once
+#include <array>
+#include <bit>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <numbers>
+#include <span>
+#include <type_traits>
+
+#include "constexpr-math.hpp"
+#include "units.hpp"
+
+namespace si
+{
+
+//------------------------------------------------------------------------------
+/// Class binary_angle is an angle in binary angle measurement (BAM), an
+/// unsigned fixed point fraction of a turn, so that 2^digits steps make one
+/// turn. Arithmetic wraps around the turn for free, and the trigonometric
+/// functions are table lookups. It converts to and from radians by
+/// units_cast.
+template< typename UIntT >
+class binary_angle
+{
+    static_assert(std::is_unsigned<UIntT>::value, "UIntT must be an unsigned integer type");
+    static_assert(std::numeric_limits<UIntT>::digits >= 8 && std::numeric_limits<UIntT>::digits <= 32, "UIntT must have 8 to 32 bits");
+
+public:
+
+    //--------------------------------------------------------------------------
+    /// Type aliases
+    using value_t = UIntT;
+
+    //--------------------------------------------------------------------------
+    /// Static member constants
+    static constexpr int digits = std::numeric_limits<UIntT>::digits;
+
+    //--------------------------------------------------------------------------
+    constexpr
+    binary_angle
+    (
+    ) = default;
+
+    //--------------------------------------------------------------------------
+    /// Initialize a binary_angle of aValue steps of 1/2^digits turn
+    explicit
+    constexpr
+    binary_angle
+    (
+        UIntT aValue
+    )
+    : mValue{aValue}
+    {
+    }
+
+    //--------------------------------------------------------------------------
+    // Accessor functions
+    constexpr value_t value() const {return mValue;}
+
+    //--------------------------------------------------------------------------
+    // Special values
+    static constexpr binary_angle zero() {return binary_angle{};}
+    static constexpr binary_angle quarter_turn() {return binary_angle{static_cast<UIntT>(UIntT{1} << (digits - 2))};}
+    static constexpr binary_angle half_turn() {return binary_angle{static_cast<UIntT>(UIntT{1} << (digits - 1))};}
+
+    //--------------------------------------------------------------------------
+    // Arithmetic functions, modulo one turn
+    constexpr binary_angle operator+() const {return *this;}
+    constexpr binary_angle operator-() const {return binary_angle{static_cast<UIntT>(0u - mValue)};}
+    constexpr binary_angle& operator+=(binary_angle rhs) {mValue = static_cast<UIntT>(mValue + rhs.mValue); return *this;}
+    constexpr binary_angle& operator-=(binary_angle rhs) {mValue = static_cast<UIntT>(mValue - rhs.mValue); return *this;}
+
+    friend constexpr binary_angle operator+(binary_angle aLHS, binary_angle aRHS) {return aLHS += aRHS;}
+    friend constexpr binary_angle operator-(binary_angle aLHS, binary_angle aRHS) {return aLHS -= aRHS;}
+    friend constexpr bool operator==(binary_angle aLHS, binary_angle aRHS) {return aLHS.mValue == aRHS.mValue;}
+    friend constexpr bool operator!=(binary_angle aLHS, binary_angle aRHS) {return aLHS.mValue != aRHS.mValue;}
+
+private:
+
+    value_t mValue{};
+
+}; // end of class binary_angle
+
+using bam8 = binary_angle<std::uint8_t>;
+using bam16 = binary_angle<std::uint16_t>;
+using bam32 = binary_angle<std::uint32_t>;
+
+template <typename aType>
+struct is_binary_angle_impl : std::false_type {};
+
+template <typename UIntT>
+struct is_binary_angle_impl<binary_angle<UIntT>> : std::true_type {};
+
+//------------------------------------------------------------------------------
+/// true if aType is a binary_angle, false otherwise
+template <typename aType>
+constexpr bool is_binary_angle = is_binary_angle_impl<typename std::decay<aType>::type>::value;
+
+//------------------------------------------------------------------------------
+/// Convert radians to a binary_angle, rounded to the nearest step and wrapped
+/// into one turn, for |aRadians| < 2^51 steps, e.g. 3·10^6 rad for bam32.
+/// Adding 1.5·2^52 rounds, and leaves the steps modulo 2^digits in the low
+/// bits, without a branch or a call to fmod.
+template< typename ToAngleT, typename ValueT, typename IntervalT >
+inline
+constexpr
+typename std::enable_if
+<
+    is_binary_angle<ToAngleT>,
+    ToAngleT
+>::type
+units_cast
+(
+    radians<IntervalT, ValueT> aRadians
+)
+{
+    constexpr double theStepsPerRadian = static_cast<double>(std::uint64_t{1} << ToAngleT::digits) / (2 * std::numbers::pi);
+    constexpr double theShift = 6755399441055744.0;
+    const double theRadians = units_cast<radians<r_one, double>>(aRadians).value();
+    const auto theBits = std::bit_cast<std::uint64_t>(theRadians * theStepsPerRadian + theShift);
+    return ToAngleT{static_cast<typename ToAngleT::value_t>(theBits)};
+}
+
+//------------------------------------------------------------------------------
+/// Convert a binary_angle to radians in [0, 2π)
+template< typename ToUnitsT, typename UIntT >
+inline
+constexpr
+typename std::enable_if
+<
+    is_units_t<ToUnitsT> && std::is_same<typename ToUnitsT::quantity_t, angle>::value,
+    ToUnitsT
+>::type
+units_cast
+(
+    binary_angle<UIntT> aAngle
+)
+{
+    constexpr double theRadiansPerStep = 2 * std::numbers::pi / static_cast<double>(std::uint64_t{1} << binary_angle<UIntT>::digits);
+    return units_cast<ToUnitsT>(radians<r_one, double>{aAngle.value() * theRadiansPerStep});
+}
+
+//------------------------------------------------------------------------------
+/// the number of bits of a binary_angle that index the sine table
+inline constexpr int binary_angle_table_bits = 12;
+
+//------------------------------------------------------------------------------
+/// the sine of every 1/2^binary_angle_table_bits turn, with the first entry
+/// repeated at the end for the interpolation, computed at compile time
+inline constexpr auto binary_angle_sine_table = []
+{
+    constexpr std::size_t theSize = std::size_t{1} << binary_angle_table_bits;
+    std::array<float, theSize + 1> theTable{};
+    for( std::size_t i = 0; i < theSize; ++i )
+    {
+        theTable[i] = static_cast<float>(constexpr_sin(2 * std::numbers::pi * static_cast<double>(i) / theSize));
+    }
+    theTable[theSize] = theTable[0];
+    return theTable;
+}();
+
+//------------------------------------------------------------------------------
+/// sine of a binary_angle, linearly interpolated in binary_angle_sine_table,
+/// within 4·10^-7
+template< typename UIntT >
+inline
+constexpr
+scalar<r_one, float>
+sine
+(
+    binary_angle<UIntT> aAngle
+)
+{
+    constexpr int theFractionBits = binary_angle<UIntT>::digits - binary_angle_table_bits;
+    if constexpr( theFractionBits > 0 )
+    {
+        constexpr float theFractionScale = 1.0f / static_cast<float>(std::uint32_t{1} << theFractionBits);
+        const std::size_t theIndex = aAngle.value() >> theFractionBits;
+        const auto theFraction = static_cast<float>(aAngle.value() & ((UIntT{1} << theFractionBits) - 1u)) * theFractionScale;
+        const float theLower = binary_angle_sine_table[theIndex];
+        const float theUpper = binary_angle_sine_table[theIndex + 1];
+        return scalar<r_one, float>{theLower + (theUpper - theLower) * theFraction};
+    }
+    else
+    {
+        return scalar<r_one, float>{binary_angle_sine_table[std::size_t{aAngle.value()} << -theFractionBits]};
+    }
+}
+
+//------------------------------------------------------------------------------
+/// cosine of a binary_angle, the sine a quarter turn ahead
+template< typename UIntT >
+inline
+constexpr
+scalar<r_one, float>
+cosine
+(
+    binary_angle<UIntT> aAngle
+)
+{
+    return sine(aAngle + binary_angle<UIntT>::quarter_turn());
+}
+
+//------------------------------------------------------------------------------
+/// aResult[i] = units_cast<binary_angle>(aRadians[i])
+template< typename RadiansT, typename UIntT >
+inline
+void
+convert
+(
+    std::span<RadiansT> aRadians,
+    std::span<binary_angle<UIntT>> aResult
+)
+{
+    assert(aResult.size() >= aRadians.size());
+    for( std::size_t i = 0; i < aRadians.size(); ++i )
+    {
+        aResult[i] = units_cast<binary_angle<UIntT>>(aRadians[i]);
+    }
+}
+
+//------------------------------------------------------------------------------
+/// aResult[i] = units_cast<RadiansT>(aAngles[i])
+template< typename AngleT, typename RadiansT, typename = std::enable_if_t<is_binary_angle<AngleT>> >
+inline
+void
+convert
+(
+    std::span<AngleT> aAngles,
+    std::span<RadiansT> aResult
+)
+{
+    assert(aResult.size() >= aAngles.size());
+    for( std::size_t i = 0; i < aAngles.size(); ++i )
+    {
+        aResult[i] = units_cast<RadiansT>(aAngles[i]);
+    }
+}
+
+//------------------------------------------------------------------------------
+/// aResult[i] = sine(aAngles[i])
+template< typename AngleT, typename = std::enable_if_t<is_binary_angle<AngleT>> >
+inline
+void
+sine
+(
+    std::span<AngleT> aAngles,
+    std::span<scalar<r_one, float>> aResult
+)
+{
+    assert(aResult.size() >= aAngles.size());
+    for( std::size_t i = 0; i < aAngles.size(); ++i )
+    {
+        aResult[i] = sine(aAngles[i]);
+    }
+}
+
+//------------------------------------------------------------------------------
+/// aResult[i] = cosine(aAngles[i])
+template< typename AngleT, typename = std::enable_if_t<is_binary_angle<AngleT>> >
+inline
+void
+cosine
+(
+    std::span<AngleT> aAngles,
+    std::span<scalar<r_one, float>> aResult
+)
+{
+    assert(aResult.size() >= aAngles.size());
+    for( std::size_t i = 0; i < aAngles.size(); ++i )
+    {
+        aResult[i] = cosine(aAngles[i]);
+    }
+}
+
+} // end of namespace si
@@ -0,0 +1,434 @@
+#pragma once
+#include <cassert>
+#include <cstddef>
+#include <optional>
+#include <span>
+#include <type_traits>
+
+#include "units.hpp"
+
+namespace si
+{
+
+//------------------------------------------------------------------------------
+/// Number of independent accumulators used by the reduction kernels.
+/// Summing into separate lanes removes the loop-carried dependency on a
+/// single accumulator so the compiler can vectorize without reassociating.
+constexpr std::size_t reduction_lanes = 4;
+
+//------------------------------------------------------------------------------
+/// the units_t type that results from integrating SamplesT over TimesT
+template< typename SamplesT, typename TimesT >
+using integral_units = multiply_units<std::remove_cv_t<SamplesT>, std::remove_cv_t<TimesT>>;
+
+//------------------------------------------------------------------------------
+/// the units_t type that results from differentiating SamplesT by TimesT
+template< typename SamplesT, typename TimesT >
+using derivative_units = divide_units<std::remove_cv_t<SamplesT>, std::remove_cv_t<TimesT>>;
+
+//------------------------------------------------------------------------------
+// twice the trapezoid integral, so that integer results are only halved once
+template< typename SamplesT, typename TimesT >
+inline
+constexpr
+typename integral_units<SamplesT, TimesT>::value_t
+integrate_trapezoid_impl
+(
+    std::span<SamplesT> aSamples,
+    std::span<TimesT> aTimes
+)
+{
+    using ResultValue_t = typename integral_units<SamplesT, TimesT>::value_t;
+
+    const auto theCount = aSamples.size();
+    ResultValue_t theSums[reduction_lanes] = {};
+    std::size_t i = 1;
+    for( ; i + reduction_lanes <= theCount; i += reduction_lanes )
+    {
+        for( std::size_t theLane = 0; theLane < reduction_lanes; ++theLane )
+        {
+            const auto j = i + theLane;
+            theSums[theLane] +=
+                static_cast<ResultValue_t>(aSamples[j].value() + aSamples[j - 1].value()) *
+                static_cast<ResultValue_t>(aTimes[j].value() - aTimes[j - 1].value());
+        }
+    }
+
+    for( ; i < theCount; ++i )
+    {
+        theSums[0] +=
+            static_cast<ResultValue_t>(aSamples[i].value() + aSamples[i - 1].value()) *
+            static_cast<ResultValue_t>(aTimes[i].value() - aTimes[i - 1].value());
+    }
+
+    ResultValue_t theSum{};
+    for( const auto theLaneSum : theSums )
+    {
+        theSum += theLaneSum;
+    }
+
+    return theSum;
+}
+
+//------------------------------------------------------------------------------
+/// Integrate samples over possibly irregular timestamps with the trapezoid rule.
+/// @param aSamples the sample values, one per timestamp
+/// @param aTimes the timestamps, same size as aSamples and non-decreasing
+/// @return the integral, or zero if there are fewer than two samples
+template< typename SamplesT, typename TimesT >
+inline
+constexpr
+integral_units<SamplesT, TimesT>
+integrate_trapezoid
+(
+    std::span<SamplesT> aSamples,
+    std::span<TimesT> aTimes
+)
+{
+    static_assert(is_units_t<SamplesT> && is_units_t<TimesT>, "samples and times must be of type si::units_t");
+    assert(aSamples.size() == aTimes.size());
+
+    using Result_t = integral_units<SamplesT, TimesT>;
+    return Result_t{integrate_trapezoid_impl(aSamples, aTimes) / 2};
+}
+
+//------------------------------------------------------------------------------
+/// Integrate samples over possibly irregular timestamps with Simpson's rule.
+/// Consecutive pairs of intervals are integrated with the non-uniform Simpson
+/// formula. When the number of intervals is odd the last interval is corrected
+/// using the parabola through the last three samples.
+/// @param aSamples the sample values, one per timestamp
+/// @param aTimes the timestamps, same size as aSamples and strictly increasing
+/// @return the integral, or zero if there are fewer than two samples
+template< typename SamplesT, typename TimesT >
+inline
+constexpr
+integral_units<SamplesT, TimesT>
+integrate_simpson
+(
+    std::span<SamplesT> aSamples,
+    std::span<TimesT> aTimes
+)
+{
+    static_assert(is_units_t<SamplesT> && is_units_t<TimesT>, "samples and times must be of type si::units_t");
+    static_assert
+    (
+        std::is_floating_point<typename integral_units<SamplesT, TimesT>::value_t>::value,
+        "si::integrate_simpson requires a floating point result"
+    );
+    assert(aSamples.size() == aTimes.size());
+
+    using Result_t = integral_units<SamplesT, TimesT>;
+    using ResultValue_t = typename Result_t::value_t;
+
+    const auto theCount = aSamples.size();
+    if( theCount < 3 )
+    {
+        return integrate_trapezoid(aSamples, aTimes);
+    }
+
+    const auto y = [aSamples](std::size_t aIndex)
+    {
+        return static_cast<ResultValue_t>(aSamples[aIndex].value());
+    };
+
+    const auto h = [aTimes](std::size_t aIndex)
+    {
+        return static_cast<ResultValue_t>(aTimes[aIndex + 1].value() - aTimes[aIndex].value());
+    };
+
+    ResultValue_t theSum{};
+    std::size_t i = 0;
+    for( ; i + 2 < theCount; i += 2 )
+    {
+        const auto h0 = h(i);
+        const auto h1 = h(i + 1);
+        const auto theSpan = h0 + h1;
+        theSum += theSpan / 6 *
+        (
+            (2 - h1 / h0) * y(i) +
+            theSpan * theSpan / (h0 * h1) * y(i + 1) +
+            (2 - h0 / h1) * y(i + 2)
+        );
+    }
+
+    if( i + 1 < theCount )
+    {
+        const auto h0 = h(i - 1);
+        const auto h1 = h(i);
+        const auto theAlpha = (2 * h1 * h1 + 3 * h0 * h1) / (6 * (h0 + h1));
+        const auto theBeta = (h1 * h1 + 3 * h0 * h1) / (6 * h0);
+        const auto theEta = h1 * h1 * h1 / (6 * h0 * (h0 + h1));
+        theSum += theAlpha * y(i + 1) + theBeta * y(i) - theEta * y(i - 1);
+    }
+
+    return Result_t{theSum};
+}
+
+//------------------------------------------------------------------------------
+/// Compute the rate of change between each pair of consecutive samples.
+/// This is the kernel that turns cumulative counters into rates.
+/// @param aSamples the sample values, one per timestamp
+/// @param aTimes the timestamps, same size as aSamples and strictly increasing
+/// @param aRates receives aSamples.size() - 1 rates, aRates[i] is the rate between sample i and i + 1
+template< typename SamplesT, typename TimesT >
+inline
+constexpr
+void
+differentiate
+(
+    std::span<SamplesT> aSamples,
+    std::span<TimesT> aTimes,
+    std::span<derivative_units<SamplesT, TimesT>> aRates
+)
+{
+    static_assert(is_units_t<SamplesT> && is_units_t<TimesT>, "samples and times must be of type si::units_t");
+    assert(aSamples.size() == aTimes.size());
+    assert(aSamples.empty() || aRates.size() + 1 >= aSamples.size());
+
+    using Result_t = derivative_units<SamplesT, TimesT>;
+    using ResultValue_t = typename Result_t::value_t;
+
+    for( std::size_t i = 1; i < aSamples.size(); ++i )
+    {
+        aRates[i - 1] = Result_t
+        {
+            static_cast<ResultValue_t>(aSamples[i].value() - aSamples[i - 1].value()) /
+            static_cast<ResultValue_t>(aTimes[i].value() - aTimes[i - 1].value())
+        };
+    }
+}
+
+//------------------------------------------------------------------------------
+/// Compute the derivative at every sample.
+/// Interior points use the second order accurate central difference for
+/// non-uniform spacing; the end points use one-sided first order differences.
+/// @param aSamples the sample values, one per timestamp, at least two
+/// @param aTimes the timestamps, same size as aSamples and strictly increasing
+/// @param aRates receives aSamples.size() derivatives
+template< typename SamplesT, typename TimesT >
+inline
+constexpr
+void
+gradient
+(
+    std::span<SamplesT> aSamples,
+    std::span<TimesT> aTimes,
+    std::span<derivative_units<SamplesT, TimesT>> aRates
+)
+{
+    static_assert(is_units_t<SamplesT> && is_units_t<TimesT>, "samples and times must be of type si::units_t");
+    static_assert
+    (
+        std::is_floating_point<typename derivative_units<SamplesT, TimesT>::value_t>::value,
+        "si::gradient requires a floating point result"
+    );
+    assert(aSamples.size() == aTimes.size());
+    assert(aSamples.size() >= 2);
+    assert(aRates.size() >= aSamples.size());
+
+    using Result_t = derivative_units<SamplesT, TimesT>;
+    using ResultValue_t = typename Result_t::value_t;
+
+    const auto theCount = aSamples.size();
+
+    const auto y = [aSamples](std::size_t aIndex)
+    {
+        return static_cast<ResultValue_t>(aSamples[aIndex].value());
+    };
+
+    const auto h = [aTimes](std::size_t aIndex)
+    {
+        return static_cast<ResultValue_t>(aTimes[aIndex + 1].value() - aTimes[aIndex].value());
+    };
+
+    aRates[0] = Result_t{(y(1) - y(0)) / h(0)};
+
+    for( std::size_t i = 1; i + 1 < theCount; ++i )
+    {
+        const auto hs = h(i - 1);
+        const auto hd = h(i);
+        aRates[i] = Result_t
+        {
+            (hs * hs * y(i + 1) + (hd * hd - hs * hs) * y(i) - hd * hd * y(i - 1)) /
+            (hs * hd * (hd + hs))
+        };
+    }
+
+    aRates[theCount - 1] = Result_t{(y(theCount - 1) - y(theCount - 2)) / h(theCount - 2)};
+}
+
+//------------------------------------------------------------------------------
+/// Class running_integral integrates an unbounded stream of samples with the
+/// trapezoid rule, carrying the last sample across chunk boundaries.
+template< typename SamplesT, typename TimesT >
+class running_integral
+{
+    static_assert(is_units_t<SamplesT> && is_units_t<TimesT>, "samples and times must be of type si::units_t");
+
+public:
+
+    //--------------------------------------------------------------------------
+    /// Type aliases
+    using samples_t = SamplesT;
+    using times_t = TimesT;
+    using result_t = integral_units<SamplesT, TimesT>;
+
+    //--------------------------------------------------------------------------
+    /// Add one sample to the integral.
+    constexpr
+    void
+    push
+    (
+        samples_t aSample,
+        times_t aTime
+    )
+    {
+        if( mHasLast )
+        {
+            mDoubledSum +=
+                static_cast<value_t>(aSample.value() + mLastSample.value()) *
+                static_cast<value_t>(aTime.value() - mLastTime.value());
+        }
+
+        mLastSample = aSample;
+        mLastTime = aTime;
+        mHasLast = true;
+    }
+
+    //--------------------------------------------------------------------------
+    /// Add a chunk of samples to the integral. The chunk may be in any units
+    /// that convert to samples_t and times_t.
+    template< typename SpanSamplesT, typename SpanTimesT >
+    constexpr
+    void
+    push
+    (
+        std::span<SpanSamplesT> aSamples,
+        std::span<SpanTimesT> aTimes
+    )
+    {
+        assert(aSamples.size() == aTimes.size());
+        if( aSamples.empty() )
+        {
+            return;
+        }
+
+        // the chunk is summed in its own units, then converted once
+        using Chunk_t = integral_units<SpanSamplesT, SpanTimesT>;
+        push(aSamples.front(), aTimes.front());
+        mDoubledSum += units_cast<result_t>(Chunk_t{integrate_trapezoid_impl(aSamples, aTimes)}).value();
+        mLastSample = aSamples.back();
+        mLastTime = aTimes.back();
+    }
+
+    //--------------------------------------------------------------------------
+    /// the integral of all samples pushed since construction or reset()
+    constexpr result_t total() const {return result_t{mDoubledSum / 2};}
+
+    //--------------------------------------------------------------------------
+    /// Discard all state.
+    constexpr void reset() {*this = running_integral{};}
+
+private:
+
+    using value_t = typename result_t::value_t;
+
+    value_t mDoubledSum{};
+    samples_t mLastSample{};
+    times_t mLastTime{};
+    bool mHasLast = false;
+
+}; // end of class running_integral
+
+//------------------------------------------------------------------------------
+/// Class running_derivative differentiates an unbounded stream of samples,
+/// carrying the last sample across chunk boundaries so that no rate is lost
+/// between chunks.
+template< typename SamplesT, typename TimesT >
+class running_derivative
+{
+    static_assert(is_units_t<SamplesT> && is_units_t<TimesT>, "samples and times must be of type si::units_t");
+
+public:
+
+    //--------------------------------------------------------------------------
+    /// Type aliases
+    using samples_t = SamplesT;
+    using times_t = TimesT;
+    using result_t = derivative_units<SamplesT, TimesT>;
+
+    //--------------------------------------------------------------------------
+    /// Add one sample.
+    /// @return the rate since the previous sample, or std::nullopt for the first sample
+    constexpr
+    std::optional<result_t>
+    push
+    (
+        samples_t aSample,
+        times_t aTime
+    )
+    {
+        std::optional<result_t> theResult;
+        if( mHasLast )
+        {
+            theResult = result_t
+            {
+                static_cast<value_t>(aSample.value() - mLastSample.value()) /
+                static_cast<value_t>(aTime.value() - mLastTime.value())
+            };
+        }
+
+        mLastSample = aSample;
+        mLastTime = aTime;
+        mHasLast = true;
+        return theResult;
+    }
+
+    //--------------------------------------------------------------------------
+    /// Add a chunk of samples.
+    /// @param aRates receives one rate per sample, or one fewer for the very first chunk
+    /// @return the number of rates written to aRates
+    template< typename SpanSamplesT, typename SpanTimesT >
+    constexpr
+    std::size_t
+    push
+    (
+        std::span<SpanSamplesT> aSamples,
+        std::span<SpanTimesT> aTimes,
+        std::span<result_t> aRates
+    )
+    {
+        assert(aSamples.size() == aTimes.size());
+        if( aSamples.empty() )
+        {
+            return 0;
+        }
+
+        std::size_t theCount = 0;
+        if( const auto theFirst = push(aSamples.front(), aTimes.front()) )
+        {
+            aRates[theCount++] = *theFirst;
+        }
+
+        differentiate(aSamples, aTimes, aRates.subspan(theCount));
+        mLastSample = aSamples.back();
+        mLastTime = aTimes.back();
+        return theCount + aSamples.size() - 1;
+    }
+
+    //--------------------------------------------------------------------------
+    /// Discard all state.
+    constexpr void reset() {*this = running_derivative{};}
+
+private:
+
+    using value_t = typename result_t::value_t;
+
+    samples_t mLastSample{};
+    times_t mLastTime{};
+    bool mHasLast = false;
+
+}; // end of class running_derivative
+
+} // end of namespace si
@@ -0,0 +1,636 @@
+#pragma once
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "units.hpp"
+#include "wire-format.hpp"
+
+namespace si
+{
+
+//------------------------------------------------------------------------------
+/// The column file format stores named columns of units_t, each a list of
+/// chunks of raw values, for large time series read through mmap:
+///
+///  - the magic "siucol01"
+///  - the chunks, each 8-byte aligned
+///  - the footer: the number of columns, then for each column the first 32
+///    bytes of its wire_header, the length of its name, its name padded to
+///    8 bytes, the number of chunks, and for each chunk its offset, number
+///    of values, and minimum and maximum value padded to 8 bytes
+///  - the offset of the footer and the magic again
+///
+/// The integers of the footer are little endian; the values, minima and
+/// maxima are in the byte order that the wire_header records.
+inline constexpr std::array<char, 8> column_file_magic{'s', 'i', 'u', 'c', 'o', 'l', '0', '1'};
+
+//------------------------------------------------------------------------------
+/// the size of the record of a chunk in the footer
+inline constexpr std::size_t column_chunk_record_size = 32;
+
+//------------------------------------------------------------------------------
+/// Class column_file_writer writes columns of units_t to a column file, one
+/// chunk at a time, and the footer when it is closed.
+class column_file_writer
+{
+public:
+
+    //--------------------------------------------------------------------------
+    /// Create or truncate the file at aPath
+    explicit
+    column_file_writer
+    (
+        const std::string& aPath
+    )
+    : mFile{aPath, std::ios::binary | std::ios::trunc}
+    {
+        write_bytes(std::as_bytes(std::span{column_file_magic}));
+    }
+
+    column_file_writer(const column_file_writer&) = delete;
+    column_file_writer& operator=(const column_file_writer&) = delete;
+
+    //--------------------------------------------------------------------------
+    ~column_file_writer
+    (
+    )
+    {
+        if( mFile.is_open() )
+        {
+            close();
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    /// true while the file is open and every write has succeeded
+    bool
+    good
+    (
+    ) const
+    {
+        return mFile.is_open() && mFile.good();
+    }
+
+    //--------------------------------------------------------------------------
+    /// append aUnits as a chunk of the column aName, which is created by its
+    /// first chunk. Every chunk of a column must have the same UnitsT.
+    template< typename UnitsT >
+    void
+    write_chunk
+    (
+        std::string_view aName,
+        std::span<const UnitsT> aUnits
+    )
+    {
+        static_assert(is_wire_viewable<UnitsT>, "UnitsT must have the layout of its value_t");
+        using Value_t = typename UnitsT::value_t;
+
+        std::array<std::byte, 32> theType;
+        const auto theHeader = wire_header<UnitsT>(0);
+        std::copy_n(theHeader.begin(), theType.size(), theType.begin());
+
+        auto theColumn = std::find_if(mColumns.begin(), mColumns.end(), [aName](const auto& aColumn) {return aColumn.name == aName;});
+        if( theColumn == mColumns.end() )
+        {
+            mColumns.push_back({std::string{aName}, theType, {}});
+            theColumn = mColumns.end() - 1;
+        }
+        assert(theColumn->type == theType);
+        if( aUnits.empty() )
+        {
+            return;
+        }
+
+        pad();
+        chunk_record theChunk{mOffset, aUnits.size(), {}, {}};
+        // NaN is not ordered, so it is left out of the statistics. A chunk of
+        // NaN alone keeps NaN bounds, which may_contain never excludes.
+        Value_t theMinimumValue = aUnits.front().value();
+        Value_t theMaximumValue = theMinimumValue;
+        for( const auto& theUnits : aUnits )
+        {
+            const Value_t theValue = theUnits.value();
+            if( theValue != theValue )
+            {
+                continue;
+            }
+
+            if( theMinimumValue != theMinimumValue || theValue < theMinimumValue )
+            {
+                theMinimumValue = theValue;
+            }
+
+            if( theMaximumValue != theMaximumValue || theMaximumValue < theValue )
+            {
+                theMaximumValue = theValue;
+            }
+        }
+
+        std::memcpy(theChunk.minimum.data(), &theMinimumValue, sizeof(Value_t));
+        std::memcpy(theChunk.maximum.data(), &theMaximumValue, sizeof(Value_t));
+        theColumn->chunks.push_back(theChunk);
+        write_bytes(std::as_bytes(aUnits));
+    }
+
+    //--------------------------------------------------------------------------
+    /// write the footer and close the file; false if a write failed
+    bool
+    close
+    (
+    )
+    {
+        pad();
+        const std::uint64_t theFooterOffset = mOffset;
+        write_field(mColumns.size());
+        for( const auto& theColumn : mColumns )
+        {
+            write_bytes(std::as_bytes(std::span{theColumn.type}));
+            write_field(theColumn.name.size());
+            write_bytes(std::as_bytes(std::span{theColumn.name.data(), theColumn.name.size()}));
+            pad();
+            write_field(theColumn.chunks.size());
+            for( const auto& theChunk : theColumn.chunks )
+            {
+                write_field(theChunk.offset);
+                write_field(theChunk.count);
+                write_bytes(std::as_bytes(std::span{theChunk.minimum}));
+                write_bytes(std::as_bytes(std::span{theChunk.maximum}));
+            }
+        }
+        write_field(theFooterOffset);
+        write_bytes(std::as_bytes(std::span{column_file_magic}));
+
+        const bool isGood = good();
+        mFile.close();
+        return isGood;
+    }
+
+private:
+
+    struct chunk_record
+    {
+        std::uint64_t offset;
+        std::uint64_t count;
+        std::array<std::byte, 8> minimum;
+        std::array<std::byte, 8> maximum;
+    };
+
+    struct column_record
+    {
+        std::string name;
+        std::array<std::byte, 32> type;
+        std::vector<chunk_record> chunks;
+    };
+
+    //--------------------------------------------------------------------------
+    void
+    write_bytes
+    (
+        std::span<const std::byte> aBytes
+    )
+    {
+        mFile.write(reinterpret_cast<const char*>(aBytes.data()), static_cast<std::streamsize>(aBytes.size()));
+        mOffset += aBytes.size();
+    }
+
+    //--------------------------------------------------------------------------
+    void
+    write_field
+    (
+        std::uint64_t aValue
+    )
+    {
+        std::array<std::byte, 8> theBytes;
+        for( std::size_t i = 0; i < theBytes.size(); ++i )
+        {
+            theBytes[i] = static_cast<std::byte>(aValue >> (8 * i));
+        }
+        write_bytes(theBytes);
+    }
+
+    //--------------------------------------------------------------------------
+    /// zeros up to the next multiple of 8 bytes
+    void
+    pad
+    (
+    )
+    {
+        constexpr std::array<std::byte, 8> theZeros{};
+        write_bytes(std::span{theZeros}.first((8 - mOffset % 8) % 8));
+    }
+
+    std::ofstream mFile;
+    std::uint64_t mOffset{0};
+    std::vector<column_record> mColumns;
+
+}; // end of class column_file_writer
+
+//------------------------------------------------------------------------------
+/// Class column_view is a column of a column file read as UnitsT. The values
+/// stay in the mapped file. When the file has the interval of UnitsT, chunk
+/// returns them in place; otherwise read_chunk converts them as units_cast
+/// does, when they are read. The minimum and maximum of each chunk let
+/// range queries skip chunks.
+template< typename UnitsT >
+class column_view
+{
+public:
+
+    //--------------------------------------------------------------------------
+    /// Type aliases
+    using value_t = typename UnitsT::value_t;
+
+    //--------------------------------------------------------------------------
+    /// the view of the chunks at aChunks in the file at aBase, stored in an
+    /// interval aRatio times that of UnitsT
+    column_view
+    (
+        const std::byte* aBase,
+        const std::byte* aChunks,
+        std::size_t aChunkCount,
+        wire_interval_ratio aRatio
+    )
+    : mBase{aBase}
+    , mChunks{aChunks}
+    , mChunkCount{aChunkCount}
+    , mRatio{aRatio}
+    {
+    }
+
+    //--------------------------------------------------------------------------
+    // Accessor functions
+    std::size_t chunk_count() const {return mChunkCount;}
+    std::size_t chunk_size(std::size_t aChunk) const {return static_cast<std::size_t>(field(aChunk, 8));}
+    bool is_native() const {return mRatio.num == 1 && mRatio.den == 1;}
+
+    //--------------------------------------------------------------------------
+    /// the number of values in all chunks
+    std::size_t
+    size
+    (
+    ) const
+    {
+        std::size_t theSize = 0;
+        for( std::size_t i = 0; i < mChunkCount; ++i )
+        {
+            theSize += chunk_size(i);
+        }
+        return theSize;
+    }
+
+    //--------------------------------------------------------------------------
+    /// the values of chunk aChunk in place; the file must have the interval
+    /// of UnitsT
+    units_span<const UnitsT>
+    chunk
+    (
+        std::size_t aChunk
+    ) const
+    {
+        assert(is_native());
+        return units_span<const UnitsT>{values(aChunk), chunk_size(aChunk)};
+    }
+
+    //--------------------------------------------------------------------------
+    /// convert the values of chunk aChunk into aResult
+    void
+    read_chunk
+    (
+        std::size_t aChunk,
+        std::span<UnitsT> aResult
+    ) const
+    {
+        const std::size_t theSize = chunk_size(aChunk);
+        assert(aResult.size() >= theSize);
+        const UnitsT* theValues = values(aChunk);
+        for( std::size_t i = 0; i < theSize; ++i )
+        {
+            aResult[i] = from_wire_value<UnitsT>(theValues[i].value(), mRatio);
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    /// the smallest value of chunk aChunk
+    UnitsT
+    chunk_minimum
+    (
+        std::size_t aChunk
+    ) const
+    {
+        return from_wire_value<UnitsT>(statistic(aChunk, 16), mRatio);
+    }
+
+    //--------------------------------------------------------------------------
+    /// the largest value of chunk aChunk
+    UnitsT
+    chunk_maximum
+    (
+        std::size_t aChunk
+    ) const
+    {
+        return from_wire_value<UnitsT>(statistic(aChunk, 24), mRatio);
+    }
+
+    //--------------------------------------------------------------------------
+    /// false if no value of chunk aChunk can be in [aLower, aUpper]
+    bool
+    may_contain
+    (
+        std::size_t aChunk,
+        UnitsT aLower,
+        UnitsT aUpper
+    ) const
+    {
+        return !(chunk_maximum(aChunk) < aLower) && !(aUpper < chunk_minimum(aChunk));
+    }
+
+private:
+
+    //--------------------------------------------------------------------------
+    std::uint64_t
+    field
+    (
+        std::size_t aChunk,
+        std::size_t aOffset
+    ) const
+    {
+        return get_wire_field(std::span{mChunks + aChunk * column_chunk_record_size, column_chunk_record_size}, aOffset);
+    }
+
+    //--------------------------------------------------------------------------
+    const UnitsT*
+    values
+    (
+        std::size_t aChunk
+    ) const
+    {
+        assert(aChunk < mChunkCount);
+        return reinterpret_cast<const UnitsT*>(mBase + field(aChunk, 0));
+    }
+
+    //--------------------------------------------------------------------------
+    value_t
+    statistic
+    (
+        std::size_t aChunk,
+        std::size_t aOffset
+    ) const
+    {
+        assert(aChunk < mChunkCount);
+        value_t theValue;
+        std::memcpy(&theValue, mChunks + aChunk * column_chunk_record_size + aOffset, sizeof(value_t));
+        return theValue;
+    }
+
+    const std::byte* mBase;
+    const std::byte* mChunks;
+    std::size_t mChunkCount;
+    wire_interval_ratio mRatio;
+
+}; // end of class column_view
+
+//------------------------------------------------------------------------------
+/// Class column_file_reader maps a column file into memory, and checks the
+/// footer once when it is opened, so that the columns are read in place
+/// with no parsing. It requires POSIX mmap.
+class column_file_reader
+{
+public:
+
+    //--------------------------------------------------------------------------
+    /// the reader of the file at aPath; std::nullopt if the file cannot be
+    /// mapped or is not a valid column file
+    static
+    std::optional<column_file_reader>
+    open
+    (
+        const std::string& aPath
+    )
+    {
+        const int theFile = ::open(aPath.c_str(), O_RDONLY);
+        if( theFile < 0 )
+        {
+            return std::nullopt;
+        }
+
+        struct stat theStatus;
+        void* theMapping = MAP_FAILED;
+        std::size_t theSize = 0;
+        if( ::fstat(theFile, &theStatus) == 0 && theStatus.st_size > 0 )
+        {
+            theSize = static_cast<std::size_t>(theStatus.st_size);
+            theMapping = ::mmap(nullptr, theSize, PROT_READ, MAP_SHARED, theFile, 0);
+        }
+        ::close(theFile);
+        if( theMapping == MAP_FAILED )
+        {
+            return std::nullopt;
+        }
+
+        column_file_reader theReader{static_cast<const std::byte*>(theMapping), theSize};
+        if( !theReader.read_footer() )
+        {
+            return std::nullopt;
+        }
+        return theReader;
+    }
+
+    //--------------------------------------------------------------------------
+    column_file_reader
+    (
+        column_file_reader&& aOther
+    ) noexcept
+    : mData{std::exchange(aOther.mData, nullptr)}
+    , mSize{std::exchange(aOther.mSize, 0)}
+    , mColumns{std::move(aOther.mColumns)}
+    {
+    }
+
+    column_file_reader& operator=(column_file_reader&&) = delete;
+
+    //--------------------------------------------------------------------------
+    ~column_file_reader
+    (
+    )
+    {
+        if( mData != nullptr )
+        {
+            ::munmap(const_cast<std::byte*>(mData), mSize);
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // Accessor functions
+    std::size_t column_count() const {return mColumns.size();}
+    std::string_view column_name(std::size_t aColumn) const {return mColumns[aColumn].name;}
+
+    //--------------------------------------------------------------------------
+    /// the column aName read as UnitsT; std::nullopt if there is no such
+    /// column, or it has another quantity, value type or byte order
+    template< typename UnitsT >
+    std::optional<column_view<UnitsT>>
+    column
+    (
+        std::string_view aName
+    ) const
+    {
+        static_assert(is_wire_viewable<UnitsT>, "UnitsT must have the layout of its value_t");
+        const auto theColumn = std::find_if(mColumns.begin(), mColumns.end(), [aName](const auto& aColumn) {return aColumn.name == aName;});
+        if( theColumn == mColumns.end() )
+        {
+            return std::nullopt;
+        }
+
+        // everything but the interval must match
+        const auto theExpected = wire_header<UnitsT>(0);
+        if( !std::equal(theExpected.begin(), theExpected.begin() + 16, theColumn->type) )
+        {
+            return std::nullopt;
+        }
+
+        const auto theRatio = wire_interval_ratio_to<UnitsT>(std::span{theColumn->type, 32});
+        if( !theRatio )
+        {
+            return std::nullopt;
+        }
+        return column_view<UnitsT>{mData, theColumn->chunks, theColumn->chunk_count, *theRatio};
+    }
+
+private:
+
+    struct column_record
+    {
+        std::string_view name;
+        const std::byte* type;
+        const std::byte* chunks;
+        std::size_t chunk_count;
+    };
+
+    //--------------------------------------------------------------------------
+    column_file_reader
+    (
+        const std::byte* aData,
+        std::size_t aSize
+    )
+    : mData{aData}
+    , mSize{aSize}
+    {
+    }
+
+    //--------------------------------------------------------------------------
+    /// check the footer, and every offset and size in it, against the file
+    bool
+    read_footer
+    (
+    )
+    {
+        const std::span<const std::byte> theFile{mData, mSize};
+        const auto theMagic = std::as_bytes(std::span{column_file_magic});
+        if( mSize < 32 ||
+            !std::equal(theMagic.begin(), theMagic.end(), theFile.begin()) ||
+            !std::equal(theMagic.begin(), theMagic.end(), theFile.end() - 8) )
+        {
+            return false;
+        }
+
+        const std::uint64_t theFooterEnd = mSize - 16;
+        std::uint64_t theOffset = get_wire_field(theFile, theFooterEnd);
+        const std::uint64_t theFooterOffset = theOffset;
+        if( theOffset % 8 != 0 || theOffset < 8 || theOffset > theFooterEnd )
+        {
+            return false;
+        }
+
+        // the next aSize bytes of the footer, or nullptr past its end
+        const auto take = [&](std::uint64_t aSize) -> const std::byte*
+        {
+            if( aSize > theFooterEnd - theOffset )
+            {
+                return nullptr;
+            }
+            const std::byte* theBytes = mData + theOffset;
+            theOffset += aSize;
+            return theBytes;
+        };
+
+        const std::byte* theCountField = take(8);
+        if( theCountField == nullptr )
+        {
+            return false;
+        }
+        const std::uint64_t theColumnCount = get_wire_field(std::span{theCountField, 8}, 0);
+        for( std::uint64_t theColumnIndex = 0; theColumnIndex < theColumnCount; ++theColumnIndex )
+        {
+            const std::byte* theType = take(32);
+            const std::byte* theNameSize = theType != nullptr ? take(8) : nullptr;
+            if( theNameSize == nullptr )
+            {
+                return false;
+            }
+            const std::uint64_t theNameLength = get_wire_field(std::span{theNameSize, 8}, 0);
+            const std::byte* theName = theNameLength <= theFooterEnd ? take((theNameLength + 7) / 8 * 8) : nullptr;
+            const std::byte* theChunkCountField = theName != nullptr ? take(8) : nullptr;
+            if( theChunkCountField == nullptr )
+            {
+                return false;
+            }
+            const std::uint64_t theChunkCount = get_wire_field(std::span{theChunkCountField, 8}, 0);
+            const std::byte* theChunks = theChunkCount <= theFooterEnd / column_chunk_record_size ? take(theChunkCount * column_chunk_record_size) : nullptr;
+            if( theChunks == nullptr )
+            {
+                return false;
+            }
+
+            // the chunks must lie between the magic and the footer, aligned
+            const auto theValueSize = static_cast<std::uint64_t>(theType[5]);
+            if( theValueSize != 1 && theValueSize != 2 && theValueSize != 4 && theValueSize != 8 )
+            {
+                return false;
+            }
+            for( std::uint64_t i = 0; i < theChunkCount; ++i )
+            {
+                const std::span<const std::byte> theRecord{theChunks + i * column_chunk_record_size, column_chunk_record_size};
+                const std::uint64_t theChunkOffset = get_wire_field(theRecord, 0);
+                const std::uint64_t theChunkSize = get_wire_field(theRecord, 8);
+                if( theChunkOffset < 8 || theChunkOffset % 8 != 0 || theChunkOffset > theFooterOffset ||
+                    theChunkSize > (theFooterOffset - theChunkOffset) / theValueSize )
+                {
+                    return false;
+                }
+            }
+
+            mColumns.push_back
+            ({
+                std::string_view{reinterpret_cast<const char*>(theName), static_cast<std::size_t>(theNameLength)},
+                theType,
+                theChunks,
+                static_cast<std::size_t>(theChunkCount)
+            });
+        }
+        return true;
+    }
+
+    const std::byte* mData;
+    std::size_t mSize;
+    std::vector<column_record> mColumns;
+
+}; // end of class column_file_reader
+
+} // end of namespace si
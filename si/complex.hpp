@@ -0,0 +1,152 @@
+#pragma once
+#include <cassert>
+#include <complex>
+#include <cstddef>
+#include <span>
+
+#include "units.hpp"
+
+namespace si
+{
+
+//------------------------------------------------------------------------------
+/// std::complex as a value_t
+template <typename ValueT>
+struct is_complex_impl<std::complex<ValueT>> : std::true_type {};
+
+template <typename ValueT>
+struct real_value_impl<std::complex<ValueT>>
+{
+    using type = ValueT;
+};
+
+template <typename... ValueT>
+struct common_value_impl<true, ValueT...>
+{
+    using type = std::complex<std::common_type_t<real_value_t<ValueT>...>>;
+};
+
+//------------------------------------------------------------------------------
+/// magnitude of a complex units_t, e.g. the amplitude of a voltage phasor
+template< typename ValueT, typename IntervalT, typename QuantityT >
+inline
+units_t<real_value_t<ValueT>, IntervalT, QuantityT>
+magnitude
+(
+    units_t<ValueT, IntervalT, QuantityT> aUnits
+)
+{
+    return units_t<real_value_t<ValueT>, IntervalT, QuantityT>{std::abs(aUnits.value())};
+}
+
+//------------------------------------------------------------------------------
+/// phase angle of a complex units_t, in (-π, π]
+template< typename ValueT, typename IntervalT, typename QuantityT >
+inline
+radians<r_one, real_value_t<ValueT>>
+phase
+(
+    units_t<ValueT, IntervalT, QuantityT> aUnits
+)
+{
+    static_assert(is_complex<ValueT>, "phase requires a std::complex value_t");
+    return radians<r_one, real_value_t<ValueT>>{std::arg(aUnits.value())};
+}
+
+//------------------------------------------------------------------------------
+/// complex conjugate of a complex units_t
+template< typename ValueT, typename IntervalT, typename QuantityT >
+inline
+constexpr
+units_t<ValueT, IntervalT, QuantityT>
+conj
+(
+    units_t<ValueT, IntervalT, QuantityT> aUnits
+)
+{
+    static_assert(is_complex<ValueT>, "conj requires a std::complex value_t");
+    return units_t<ValueT, IntervalT, QuantityT>{std::conj(aUnits.value())};
+}
+
+//------------------------------------------------------------------------------
+/// complex units_t from a magnitude and a phase angle
+template< typename ValueT, typename IntervalT, typename QuantityT, typename AngleValueT, typename AngleIntervalT >
+inline
+units_t<std::complex<ValueT>, IntervalT, QuantityT>
+polar
+(
+    units_t<ValueT, IntervalT, QuantityT> aMagnitude,
+    radians<AngleIntervalT, AngleValueT> aPhase
+)
+{
+    static_assert(std::is_floating_point<ValueT>::value, "polar requires a floating point value_t");
+    const auto thePhase = units_cast<radians<r_one, ValueT>>(aPhase).value();
+    return units_t<std::complex<ValueT>, IntervalT, QuantityT>{std::polar(aMagnitude.value(), thePhase)};
+}
+
+//------------------------------------------------------------------------------
+/// aResult[i] = aLHS[i] * aRHS[i], e.g. the voltage phasors of currents through impedances.
+/// The products are written out on the real and imaginary parts, without the
+/// NaN recovery of std::complex multiplication, so the loop vectorizes.
+template< typename LhsT, typename RhsT >
+inline
+void
+multiply
+(
+    std::span<LhsT> aLHS,
+    std::span<RhsT> aRHS,
+    std::span<multiply_units<std::remove_cv_t<LhsT>, std::remove_cv_t<RhsT>>> aResult
+)
+{
+    using Result_t = multiply_units<std::remove_cv_t<LhsT>, std::remove_cv_t<RhsT>>;
+    using Real_t = real_value_t<typename Result_t::value_t>;
+    static_assert(is_complex<typename Result_t::value_t>, "multiply requires a std::complex value_t");
+    assert(aLHS.size() == aRHS.size());
+    assert(aResult.size() >= aLHS.size());
+
+    for( std::size_t i = 0; i < aLHS.size(); ++i )
+    {
+        const auto a = aLHS[i].value();
+        const auto b = aRHS[i].value();
+        const auto ar = static_cast<Real_t>(std::real(a));
+        const auto ai = static_cast<Real_t>(std::imag(a));
+        const auto br = static_cast<Real_t>(std::real(b));
+        const auto bi = static_cast<Real_t>(std::imag(b));
+        aResult[i] = Result_t{std::complex<Real_t>{ar * br - ai * bi, ar * bi + ai * br}};
+    }
+}
+
+//------------------------------------------------------------------------------
+/// aResult[i] = aLHS[i] / aRHS[i], e.g. the impedances of voltage and current phasors.
+/// The quotients are written out on the real and imaginary parts, without the
+/// overflow scaling of std::complex division, so the loop vectorizes.
+template< typename LhsT, typename RhsT >
+inline
+void
+divide
+(
+    std::span<LhsT> aLHS,
+    std::span<RhsT> aRHS,
+    std::span<divide_units<std::remove_cv_t<LhsT>, std::remove_cv_t<RhsT>>> aResult
+)
+{
+    using Result_t = divide_units<std::remove_cv_t<LhsT>, std::remove_cv_t<RhsT>>;
+    using Real_t = real_value_t<typename Result_t::value_t>;
+    static_assert(is_complex<typename Result_t::value_t>, "divide requires a std::complex value_t");
+    assert(aLHS.size() == aRHS.size());
+    assert(aResult.size() >= aLHS.size());
+
+    for( std::size_t i = 0; i < aLHS.size(); ++i )
+    {
+        const auto a = aLHS[i].value();
+        const auto b = aRHS[i].value();
+        const auto ar = static_cast<Real_t>(std::real(a));
+        const auto ai = static_cast<Real_t>(std::imag(a));
+        const auto br = static_cast<Real_t>(std::real(b));
+        const auto bi = static_cast<Real_t>(std::imag(b));
+        const auto theScale = Real_t{1} / (br * br + bi * bi);
+        aResult[i] = Result_t{std::complex<Real_t>{(ar * br + ai * bi) * theScale, (ai * br - ar * bi) * theScale}};
+    }
+}
+
+} // end of namespace si
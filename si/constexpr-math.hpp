@@ -0,0 +1,396 @@
+#pragma once
+#include <bit>
+#include <cstdint>
+#include <limits>
+
+namespace si
+{
+
+//------------------------------------------------------------------------------
+/// The constexpr_ functions evaluate the math functions in double without
+/// calls into libm, so that they can be used in constant expressions. The
+/// units_t math functions use them during constant evaluation, and the
+/// functions of namespace fast use them at run time. They assume IEEE
+/// arithmetic, and do not survive -ffast-math.
+
+//------------------------------------------------------------------------------
+/// the sine and cosine of one argument
+struct sincos_values
+{
+    double sine;
+    double cosine;
+};
+
+//------------------------------------------------------------------------------
+/// the exact product aLHS·aRHS as the sum of a rounded product and its error,
+/// by Dekker's algorithm
+inline
+constexpr
+double
+constexpr_product_error
+(
+    double aLHS,
+    double aRHS,
+    double aProduct
+)
+{
+    constexpr double theSplitter = 134217729.0; // 2^27 + 1
+    const double theLHSScaled = theSplitter * aLHS;
+    const double theLHSHigh = theLHSScaled - (theLHSScaled - aLHS);
+    const double theLHSLow = aLHS - theLHSHigh;
+    const double theRHSScaled = theSplitter * aRHS;
+    const double theRHSHigh = theRHSScaled - (theRHSScaled - aRHS);
+    const double theRHSLow = aRHS - theRHSHigh;
+    return ((theLHSHigh * theRHSHigh - aProduct) + theLHSHigh * theRHSLow + theLHSLow * theRHSHigh) + theLHSLow * theRHSLow;
+}
+
+//------------------------------------------------------------------------------
+/// square root of aValue, correctly rounded like std::sqrt. Newton iterations
+/// from an estimate made on the bit pattern converge to within one ULP, and
+/// the exact residual then picks the nearest of the neighbours.
+inline
+constexpr
+double
+constexpr_sqrt
+(
+    double aValue
+)
+{
+    if( aValue < 0 )
+    {
+        return std::numeric_limits<double>::quiet_NaN();
+    }
+    if( !(aValue > 0) || aValue == std::numeric_limits<double>::infinity() )
+    {
+        return aValue;
+    }
+
+    // very small and very large values are scaled by 2^±600, so that the
+    // residual neither underflows nor overflows
+    constexpr double theUpScale = 4.149515568880993e+180; // 2^600
+    constexpr double theDownScale = 2.409919865102884e-181; // 2^-600
+    const bool isSmall = aValue < 3.054936363499605e-151; // 2^-500
+    const bool isLarge = aValue > 3.273390607896142e+150; // 2^500
+    const double x = isSmall ? aValue * theUpScale : (isLarge ? aValue * theDownScale : aValue);
+
+    double y = std::bit_cast<double>((std::bit_cast<std::uint64_t>(x) >> 1) + std::uint64_t{0x1ff8000000000000});
+    for( int i = 0; i < 5; ++i )
+    {
+        y = 0.5 * (y + x / y);
+    }
+
+    const double theSquare = y * y;
+    const double theResidual = (x - theSquare) - constexpr_product_error(y, y, theSquare);
+    const double theNext = std::bit_cast<double>(std::bit_cast<std::uint64_t>(y) + 1);
+    const double thePrevious = std::bit_cast<double>(std::bit_cast<std::uint64_t>(y) - 1);
+    const double theUp = theNext - y;
+    const double theDown = y - thePrevious;
+    if( theResidual > y * theUp + 0.25 * theUp * theUp )
+    {
+        y = theNext;
+    }
+    else if( theResidual < 0.25 * theDown * theDown - y * theDown )
+    {
+        y = thePrevious;
+    }
+
+    constexpr double theRootScale = 2.037035976334486e+90; // 2^300
+    return isSmall ? y / theRootScale : (isLarge ? y * theRootScale : y);
+}
+
+//------------------------------------------------------------------------------
+/// sine and cosine of aReduced in [-π/4, π/4], turned by aQuadrant quarter
+/// turns, by the minimax polynomials of fdlibm
+inline
+constexpr
+sincos_values
+constexpr_sincos_kernel
+(
+    double aReduced,
+    std::uint64_t aQuadrant
+)
+{
+    const double r = aReduced;
+    const double z = r * r;
+
+    const double theSinePolynomial = 8.33333333332248946124e-03 + z * (-1.98412698298579493134e-04 + z * (2.75573137070700676789e-06 + z * (-2.50507602534068634195e-08 + z * 1.58969099521155010221e-10)));
+    const double theSine = r + z * r * (-1.66666666666666324348e-01 + z * theSinePolynomial);
+
+    const double theCosinePolynomial = z * (4.16666666666666019037e-02 + z * (-1.38888888888741095749e-03 + z * (2.48015872894767294178e-05 + z * (-2.75573143513906633035e-07 + z * (2.08757232129817482790e-09 + z * -1.13596475577881948265e-11)))));
+    const double theHalfZ = 0.5 * z;
+    const double w = 1.0 - theHalfZ;
+    const double theCosine = w + (((1.0 - w) - theHalfZ) + z * theCosinePolynomial);
+
+    const auto theQuadrant = aQuadrant & 3;
+    const double theSwappedSine = (theQuadrant & 1) ? theCosine : theSine;
+    const double theSwappedCosine = (theQuadrant & 1) ? theSine : theCosine;
+    return sincos_values
+    {
+        (theQuadrant & 2) ? -theSwappedSine : theSwappedSine,
+        ((theQuadrant + 1) & 2) ? -theSwappedCosine : theSwappedCosine
+    };
+}
+
+//------------------------------------------------------------------------------
+/// sine and cosine of aRadians for |aRadians| < 2^19·π/2, within 1.5 ULP for
+/// |aRadians| ≤ 100 and 2.5 ULP for |aRadians| ≤ 10^5. The argument is
+/// reduced to [-π/4, π/4] by subtracting a multiple of π/2 in three parts,
+/// exact while the multiple is below 2^20, and without a branch, so that the
+/// loops of namespace fast vectorize. Larger arguments give wrong results;
+/// constexpr_sincos reduces any argument.
+inline
+constexpr
+sincos_values
+constexpr_sincos_near
+(
+    double aRadians
+)
+{
+    constexpr double theTwoOverPi = 6.36619772367581382433e-01;
+    constexpr double thePiOverTwo1 = 1.57079632673412561417e+00;
+    constexpr double thePiOverTwo2 = 6.07710050630396597660e-11;
+    constexpr double thePiOverTwo2t = 2.02226624879595063154e-21;
+
+    // adding 1.5·2^52 rounds to the nearest multiple of π/2, and leaves the
+    // quadrant in the low bits, without a conversion to an integer that
+    // would not vectorize
+    constexpr double theShift = 6755399441055744.0;
+    const double theShifted = aRadians * theTwoOverPi + theShift;
+    const double k = theShifted - theShift;
+    const double r = ((aRadians - k * thePiOverTwo1) - k * thePiOverTwo2) - k * thePiOverTwo2t;
+    return constexpr_sincos_kernel(r, std::bit_cast<std::uint64_t>(theShifted));
+}
+
+//------------------------------------------------------------------------------
+/// 2/π in 32-bit words, most significant first: 2/π = Σ w[k]·2^(-32·(k+1)).
+/// Forty words reach the bits that reduce the largest double.
+inline constexpr std::uint32_t two_over_pi_words[] =
+{
+    0xa2f9836e, 0x4e441529, 0xfc2757d1, 0xf534ddc0, 0xdb629599, 0x3c439041,
+    0xfe5163ab, 0xdebbc561, 0xb7246e3a, 0x424dd2e0, 0x06492eea, 0x09d1921c,
+    0xfe1deb1c, 0xb129a73e, 0xe88235f5, 0x2ebb4484, 0xe99c7026, 0xb45f7e41,
+    0x3991d639, 0x835339f4, 0x9c845f8b, 0xbdf9283b, 0x1ff897ff, 0xde05980f,
+    0xef2f118b, 0x5a0a6d1f, 0x6d367ecf, 0x27cb09b7, 0x4f463f66, 0x9e5fea2d,
+    0x7527bac7, 0xebe5f17b, 0x3d0739f7, 0x8a5292ea, 0x6bfb5fb1, 0x1f8d5d08,
+    0x56033046, 0xfc7b6bab, 0xf0cfbc20, 0x9af4361d
+};
+
+//------------------------------------------------------------------------------
+/// sine and cosine of any finite aRadians with |aRadians| ≥ 1, NaN for
+/// infinity and NaN. The argument is reduced by Payne and Hanek's method:
+/// with |aRadians| = m·2^e, only the 224 bits of 2/π that give m·2^e·2/π
+/// modulo 4 are multiplied by m, in exact integer arithmetic, which leaves
+/// the quadrant and enough bits of the fraction for the worst case
+/// cancellation of a double.
+inline
+constexpr
+sincos_values
+constexpr_sincos_far
+(
+    double aRadians
+)
+{
+    const auto theBits = std::bit_cast<std::uint64_t>(aRadians);
+    if( ((theBits >> 52) & 0x7ff) == 0x7ff )
+    {
+        constexpr double theNaN = std::numeric_limits<double>::quiet_NaN();
+        return sincos_values{theNaN, theNaN};
+    }
+
+    const bool isNegative = (theBits >> 63) != 0;
+    const std::uint64_t m = (theBits & 0x000fffffffffffff) | 0x0010000000000000;
+    const int e = static_cast<int>((theBits >> 52) & 0x7ff) - 1075;
+
+    // the words before k0 add multiples of 4 to m·2^e·2/π. S is the sum of
+    // m·w[k0 + t]·2^(32·(6 - t)) in 32-bit limbs, least significant first,
+    // and m·2^e·2/π = S·2^(s0 - 192).
+    const int k0 = e > 33 ? (e - 2) / 32 : 0;
+    const int s0 = e - 32 * k0 - 32;
+    constexpr int theWordCount = 7;
+    constexpr int theLimbCount = 10;
+    std::uint64_t theSums[theLimbCount + 1] = {};
+    for( int t = 0; t < theWordCount; ++t )
+    {
+        const std::uint64_t w = two_over_pi_words[k0 + t];
+        const int p = theWordCount - 1 - t;
+        const std::uint64_t theLow = (m & 0xffffffff) * w;
+        const std::uint64_t theHigh = (m >> 32) * w;
+        theSums[p] += theLow & 0xffffffff;
+        theSums[p + 1] += (theLow >> 32) + (theHigh & 0xffffffff);
+        theSums[p + 2] += theHigh >> 32;
+    }
+    std::uint32_t theLimbs[theLimbCount] = {};
+    std::uint64_t theCarry = 0;
+    for( int i = 0; i < theLimbCount; ++i )
+    {
+        theCarry += theSums[i];
+        theLimbs[i] = static_cast<std::uint32_t>(theCarry);
+        theCarry >>= 32;
+    }
+    const auto theBit = [&theLimbs](int aPosition) -> std::uint64_t
+    {
+        return aPosition < 0 ? 0 : (theLimbs[aPosition / 32] >> (aPosition % 32)) & 1;
+    };
+
+    // the quadrant is the two bits above the F fraction bits. A fraction of
+    // one half or more rounds the quadrant up and is replaced by its
+    // complement, so that the reduced argument lies in [-π/4, π/4].
+    const int F = 192 - s0;
+    std::uint64_t theQuadrant = theBit(F) + 2 * theBit(F + 1);
+    const bool isRoundedUp = theBit(F - 1) != 0;
+    for( int i = 0; i < theLimbCount; ++i )
+    {
+        const int theBase = 32 * i;
+        const std::uint32_t theMask = theBase + 32 <= F ? 0xffffffff : (theBase >= F ? 0 : (std::uint32_t{1} << (F - theBase)) - 1);
+        theLimbs[i] &= theMask;
+    }
+    if( isRoundedUp )
+    {
+        theQuadrant += 1;
+        std::uint64_t theBorrow = 1;
+        for( int i = 0; i < theLimbCount; ++i )
+        {
+            theBorrow += static_cast<std::uint32_t>(~theLimbs[i]);
+            theLimbs[i] = static_cast<std::uint32_t>(theBorrow);
+            theBorrow >>= 32;
+        }
+        for( int i = 0; i < theLimbCount; ++i )
+        {
+            const int theBase = 32 * i;
+            theLimbs[i] &= theBase + 32 <= F ? 0xffffffff : (theBase >= F ? 0 : (std::uint32_t{1} << (F - theBase)) - 1);
+        }
+    }
+
+    // the leading 128 bits of the fraction as a double-double, scaled to
+    // the fraction f of a quarter turn, and r = f·π/2
+    int h = F - 1;
+    while( h >= 0 && theBit(h) == 0 )
+    {
+        --h;
+    }
+    double r = 0.0;
+    if( h >= 0 )
+    {
+        std::uint64_t theTop = 0;
+        std::uint64_t theNext = 0;
+        for( int i = 0; i < 64; ++i )
+        {
+            theTop = (theTop << 1) | theBit(h - i);
+            theNext = (theNext << 1) | theBit(h - 64 - i);
+        }
+        constexpr double theTwoToMinus64 = 5.42101086242752217004e-20;
+        const double theScale = std::bit_cast<double>(static_cast<std::uint64_t>(1023 + h - 63 - F) << 52);
+        const double fh = static_cast<double>(theTop & ~std::uint64_t{0x7ff}) * theScale;
+        const double fl = (static_cast<double>(theTop & 0x7ff) + static_cast<double>(theNext) * theTwoToMinus64) * theScale;
+
+        constexpr double thePiOverTwo = 1.57079632679489655800e+00;
+        constexpr double thePiOverTwoLow = 6.12323399573676603587e-17;
+        const double theProduct = fh * thePiOverTwo;
+        r = theProduct + ((constexpr_product_error(fh, thePiOverTwo, theProduct) + fh * thePiOverTwoLow) + fl * thePiOverTwo);
+        r = isRoundedUp ? -r : r;
+    }
+
+    if( isNegative )
+    {
+        r = -r;
+        theQuadrant = 0 - theQuadrant;
+    }
+    return constexpr_sincos_kernel(r, theQuadrant);
+}
+
+//------------------------------------------------------------------------------
+/// sine and cosine of any aRadians, within 1.5 ULP for |aRadians| ≤ 100 by
+/// constexpr_sincos_near, and within 1 ULP beyond by constexpr_sincos_far,
+/// whose reduction is exact for every double
+inline
+constexpr
+sincos_values
+constexpr_sincos
+(
+    double aRadians
+)
+{
+    constexpr double theNearLimit = 100.0;
+    if( aRadians <= theNearLimit && aRadians >= -theNearLimit )
+    {
+        return constexpr_sincos_near(aRadians);
+    }
+    return constexpr_sincos_far(aRadians);
+}
+
+//------------------------------------------------------------------------------
+/// arc tangent of aY/aX in [-π, π], within 2 ULP. The ratio of the smaller to
+/// the larger magnitude is reduced to |t| ≤ 7/16 about 0, 1/2 or 1, and the
+/// minimax polynomial is that of fdlibm. Signed zeros are not distinguished.
+inline
+constexpr
+double
+constexpr_atan2
+(
+    double aY,
+    double aX
+)
+{
+    constexpr double thePiOverTwo = 1.57079632679489655800e+00;
+    constexpr double thePiOverTwoLow = 6.12323399573676603587e-17;
+    constexpr double thePi = 3.14159265358979311600e+00;
+    constexpr double thePiLow = 1.22464679914735317720e-16;
+
+    constexpr double theAtanHalf = 4.63647609000806093515e-01;
+    constexpr double theAtanHalfLow = 2.26987774529616870924e-17;
+    constexpr double theAtanOne = 7.85398163397448278999e-01;
+    constexpr double theAtanOneLow = 3.06161699786838301793e-17;
+
+    const double theAbsY = aY < 0 ? -aY : aY;
+    const double theAbsX = aX < 0 ? -aX : aX;
+    const bool isSteep = theAbsY > theAbsX;
+    const double theLarger = isSteep ? theAbsY : theAbsX;
+    const double theSmaller = isSteep ? theAbsX : theAbsY;
+    const double a = theSmaller / (theLarger > 0 ? theLarger : std::numeric_limits<double>::min());
+
+    // t = (a - c) / (1 + c·a) about c = 0, 1/2 or 1. Every condition selects
+    // between constants that are summed, and every floating point operation
+    // is unconditional, since either a nested selection or an operation
+    // under a condition stops the loops from vectorizing. The differences of
+    // the arc tangents are exact, so the sums are too.
+    const bool isMiddle = a >= 0.4375;
+    const bool isHigh = a >= 0.6875;
+    const double c = (isMiddle ? 0.5 : 0.0) + (isHigh ? 0.5 : 0.0);
+    const double t = (a - c) / (1.0 + c * a);
+    const double theHigh = (isMiddle ? theAtanHalf : 0.0) + (isHigh ? theAtanOne - theAtanHalf : 0.0);
+    const double theLow = (isMiddle ? theAtanHalfLow : 0.0) + (isHigh ? theAtanOneLow - theAtanHalfLow : 0.0);
+
+    const double z = t * t;
+    const double w = z * z;
+    const double s1 = z * (3.33333333333329318027e-01 + w * (1.42857142725034663711e-01 + w * (9.09088713343650656196e-02 + w * (6.66107313738753120669e-02 + w * (4.97687799461593236017e-02 + w * 1.62858201153657823623e-02)))));
+    const double s2 = w * (-1.99999999998764832476e-01 + w * (-1.11111104054623557880e-01 + w * (-7.69187620504482999495e-02 + w * (-5.83357013379057348645e-02 + w * -3.65315727442169155270e-02))));
+    double theAngle = theHigh - ((t * (s1 + s2) - theLow) - t);
+
+    // π/2 - θ and π - θ are written as base + (low + sign·θ) for the same reason
+    theAngle = (isSteep ? thePiOverTwo : 0.0) + ((isSteep ? thePiOverTwoLow : 0.0) + (isSteep ? -theAngle : theAngle));
+    theAngle = (aX < 0 ? thePi : 0.0) + ((aX < 0 ? thePiLow : 0.0) + (aX < 0 ? -theAngle : theAngle));
+    return aY < 0 ? -theAngle : theAngle;
+}
+
+//------------------------------------------------------------------------------
+// The remaining functions are built on the ones above
+inline constexpr double constexpr_sin(double aRadians) {return constexpr_sincos(aRadians).sine;}
+inline constexpr double constexpr_cos(double aRadians) {return constexpr_sincos(aRadians).cosine;}
+
+inline
+constexpr
+double
+constexpr_tan
+(
+    double aRadians
+)
+{
+    const auto theResult = constexpr_sincos(aRadians);
+    return theResult.sine / theResult.cosine;
+}
+
+inline constexpr double constexpr_atan(double aValue) {return constexpr_atan2(aValue, 1.0);}
+inline constexpr double constexpr_asin(double aValue) {return constexpr_atan2(aValue, constexpr_sqrt((1.0 - aValue) * (1.0 + aValue)));}
+inline constexpr double constexpr_acos(double aValue) {return constexpr_atan2(constexpr_sqrt((1.0 - aValue) * (1.0 + aValue)), aValue);}
+
+} // end of namespace si
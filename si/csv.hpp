@@ -0,0 +1,557 @@
+#pragma once
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "unit-symbol.hpp"
+#include "units.hpp"
+#include "wire-format.hpp"
+
+namespace si
+{
+
+//------------------------------------------------------------------------------
+/// the size of the chunks in which CSV files are read and written
+inline constexpr std::size_t csv_chunk_size = std::size_t{1} << 20;
+
+//------------------------------------------------------------------------------
+/// a column of a CSV header: the name and unit symbol of a cell such as
+/// "power [kW]" or "time (ms)", and the units of the symbol, std::nullopt if
+/// it is not a unit symbol. A cell with no symbol is dimensionless.
+struct csv_column
+{
+    std::string name;
+    std::string symbol;
+    std::optional<unit_descriptor> unit;
+};
+
+//------------------------------------------------------------------------------
+/// aString without the spaces and tabs around it
+inline
+std::string_view
+trim_csv_field
+(
+    std::string_view aString
+)
+{
+    while( !aString.empty() && (aString.front() == ' ' || aString.front() == '\t') )
+    {
+        aString.remove_prefix(1);
+    }
+    while( !aString.empty() && (aString.back() == ' ' || aString.back() == '\t') )
+    {
+        aString.remove_suffix(1);
+    }
+    return aString;
+}
+
+//------------------------------------------------------------------------------
+/// the column of the header cell aCell, which may be quoted
+inline
+csv_column
+parse_csv_column
+(
+    std::string_view aCell
+)
+{
+    aCell = trim_csv_field(aCell);
+    if( aCell.size() >= 2 && aCell.front() == '"' && aCell.back() == '"' )
+    {
+        aCell = trim_csv_field(aCell.substr(1, aCell.size() - 2));
+    }
+
+    std::string_view theName = aCell;
+    std::string_view theSymbol;
+    if( aCell.ends_with(']') || aCell.ends_with(')') )
+    {
+        const auto theOpen = aCell.find_last_of(aCell.back() == ']' ? '[' : '(');
+        if( theOpen != std::string_view::npos )
+        {
+            theName = trim_csv_field(aCell.substr(0, theOpen));
+            theSymbol = trim_csv_field(aCell.substr(theOpen + 1, aCell.size() - theOpen - 2));
+        }
+    }
+    return csv_column{std::string{theName}, std::string{theSymbol}, parse_unit_symbol(theSymbol)};
+}
+
+//------------------------------------------------------------------------------
+/// Class csv_reader reads columns of a CSV or TSV file as UnitsT, in batches
+/// of rows. The header names the columns and gives their units, as in
+/// "time (ms),power [kW]"; open binds a column to each UnitsT by name, and
+/// fails unless its units have the quantity of UnitsT. Values in another
+/// interval are converted as units_cast converts while they are read. The
+/// file is read in chunks of csv_chunk_size, the fields parsed in place with
+/// std::from_chars, and each batch handed out as a units_span per column,
+/// with no allocation per row or field. The fields of the rows must be
+/// numbers, not quoted; other columns are skipped.
+template< typename... UnitsT >
+class csv_reader
+{
+    static_assert(sizeof...(UnitsT) > 0, "csv_reader requires a column");
+    static_assert((is_units_t<UnitsT> && ...), "UnitsT must be a units_t");
+    static_assert((std::is_arithmetic<typename UnitsT::value_t>::value && ...), "csv_reader requires arithmetic value_t");
+
+public:
+
+    //--------------------------------------------------------------------------
+    /// Static member constants
+    static constexpr std::size_t column_count = sizeof...(UnitsT);
+
+    //--------------------------------------------------------------------------
+    /// Type aliases
+    template< std::size_t aColumn >
+    using units_type = std::tuple_element_t<aColumn, std::tuple<UnitsT...>>;
+
+    //--------------------------------------------------------------------------
+    /// a reader of the columns aNames of the file at aPath, in batches of up
+    /// to aBatchSize rows, with fields separated by aDelimiter, ',' for CSV
+    /// or '\t' for TSV; std::nullopt if the file cannot be read, a column
+    /// is missing or not in the units of its UnitsT, or two names are the
+    /// same column
+    static
+    std::optional<csv_reader>
+    open
+    (
+        const std::string& aPath,
+        const std::array<std::string_view, column_count>& aNames,
+        std::size_t aBatchSize = 4096,
+        char aDelimiter = ','
+    )
+    {
+        assert(aBatchSize > 0);
+        csv_reader theReader{aPath, aBatchSize, aDelimiter};
+        const auto theHeader = theReader.next_line();
+        if( !theHeader )
+        {
+            return std::nullopt;
+        }
+
+        for( std::string_view theRest = *theHeader; ; )
+        {
+            const auto theEnd = theRest.find(aDelimiter);
+            theReader.mColumns.push_back(parse_csv_column(theRest.substr(0, theEnd)));
+            if( theEnd == std::string_view::npos )
+            {
+                break;
+            }
+            theRest.remove_prefix(theEnd + 1);
+        }
+
+        theReader.mTargets.assign(theReader.mColumns.size(), column_count);
+        if( !theReader.bind(aNames, std::index_sequence_for<UnitsT...>{}) )
+        {
+            return std::nullopt;
+        }
+        return theReader;
+    }
+
+    //--------------------------------------------------------------------------
+    /// the columns of the header
+    const std::vector<csv_column>& columns() const {return mColumns;}
+
+    //--------------------------------------------------------------------------
+    /// read the next batch and return its number of rows, zero at the end of
+    /// the file. A row that is not valid ends the batch with the rows before
+    /// it and makes good false; the next call then returns zero.
+    std::size_t
+    next
+    (
+    )
+    {
+        mRows = 0;
+        while( mGood && mRows < mBatchSize )
+        {
+            const auto theLine = next_line();
+            if( !theLine )
+            {
+                break;
+            }
+            if( theLine->empty() )
+            {
+                continue;
+            }
+            if( !parse_row(*theLine) )
+            {
+                mGood = false;
+                break;
+            }
+            ++mRows;
+        }
+        return mRows;
+    }
+
+    //--------------------------------------------------------------------------
+    /// the values of the column aColumn in the last batch
+    template< std::size_t aColumn >
+    units_span<const units_type<aColumn>>
+    column
+    (
+    ) const
+    {
+        return units_span<const units_type<aColumn>>{std::get<aColumn>(mBatch).data(), mRows};
+    }
+
+    //--------------------------------------------------------------------------
+    /// false once a row was not valid or the file could not be read
+    bool good() const {return mGood;}
+
+    //--------------------------------------------------------------------------
+    /// the number of the last line read, from one for the header
+    std::size_t line() const {return mLine;}
+
+private:
+
+    //--------------------------------------------------------------------------
+    csv_reader
+    (
+        const std::string& aPath,
+        std::size_t aBatchSize,
+        char aDelimiter
+    )
+    : mFile{aPath, std::ios::binary}
+    , mBuffer(csv_chunk_size)
+    , mBatchSize{aBatchSize}
+    , mDelimiter{aDelimiter}
+    , mBatch{std::vector<UnitsT>(aBatchSize)...}
+    {
+    }
+
+    //--------------------------------------------------------------------------
+    /// bind the column named aNames[i] to each UnitsT
+    template< std::size_t... aColumn >
+    bool
+    bind
+    (
+        const std::array<std::string_view, column_count>& aNames,
+        std::index_sequence<aColumn...>
+    )
+    {
+        return (bind_column<aColumn>(aNames[aColumn]) && ...);
+    }
+
+    //--------------------------------------------------------------------------
+    template< std::size_t aColumn >
+    bool
+    bind_column
+    (
+        std::string_view aName
+    )
+    {
+        using Units_t = units_type<aColumn>;
+        const auto theColumn = std::find_if(mColumns.begin(), mColumns.end(), [aName](const auto& aCandidate) {return aCandidate.name == aName;});
+        if( theColumn == mColumns.end() || !theColumn->unit ||
+            theColumn->unit->exponents != quantity_exponents<typename Units_t::quantity_t>() )
+        {
+            return false;
+        }
+
+        // a column holds the values of one UnitsT only
+        const auto theIndex = static_cast<std::size_t>(theColumn - mColumns.begin());
+        if( mTargets[theIndex] != column_count )
+        {
+            return false;
+        }
+
+        const auto theRatio = wire_interval_ratio_to<Units_t>(theColumn->unit->num, theColumn->unit->den);
+        if( !theRatio )
+        {
+            return false;
+        }
+        mTargets[theIndex] = aColumn;
+        mRatios[aColumn] = *theRatio;
+        mParsers[aColumn] = &csv_reader::parse_field<aColumn>;
+        return true;
+    }
+
+    //--------------------------------------------------------------------------
+    /// the next line without its end, std::nullopt at the end of the file;
+    /// valid until the next call
+    std::optional<std::string_view>
+    next_line
+    (
+    )
+    {
+        for( ;; )
+        {
+            const char* theStart = mBuffer.data() + mBegin;
+            const auto* theEnd = static_cast<const char*>(std::memchr(theStart, '\n', mEnd - mBegin));
+            if( theEnd != nullptr || (mIsEnd && mBegin < mEnd) )
+            {
+                const std::size_t theLength = theEnd != nullptr ? static_cast<std::size_t>(theEnd - theStart) : mEnd - mBegin;
+                mBegin += theLength + (theEnd != nullptr ? 1 : 0);
+                ++mLine;
+                std::string_view theLine{theStart, theLength};
+                if( theLine.ends_with('\r') )
+                {
+                    theLine.remove_suffix(1);
+                }
+                return theLine;
+            }
+            if( mIsEnd )
+            {
+                return std::nullopt;
+            }
+
+            // keep the partial line and read the next chunk after it, growing
+            // the buffer for a line longer than it
+            std::memmove(mBuffer.data(), theStart, mEnd - mBegin);
+            mEnd -= mBegin;
+            mBegin = 0;
+            if( mEnd == mBuffer.size() )
+            {
+                mBuffer.resize(2 * mBuffer.size());
+            }
+            mFile.read(mBuffer.data() + mEnd, static_cast<std::streamsize>(mBuffer.size() - mEnd));
+            mEnd += static_cast<std::size_t>(mFile.gcount());
+            if( !mFile )
+            {
+                mIsEnd = true;
+                mGood = mGood && mFile.eof();
+            }
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    /// parse the fields of aLine in one pass, each number where it begins
+    bool
+    parse_row
+    (
+        std::string_view aLine
+    )
+    {
+        const char* thePosition = aLine.data();
+        const char* const theEnd = aLine.data() + aLine.size();
+        std::size_t theBound = 0;
+        for( std::size_t theField = 0; theField < mTargets.size(); ++theField )
+        {
+            const std::size_t theTarget = mTargets[theField];
+            if( theTarget != column_count )
+            {
+                thePosition = (this->*mParsers[theTarget])(thePosition, theEnd);
+                if( thePosition == nullptr )
+                {
+                    return false;
+                }
+                ++theBound;
+            }
+            else
+            {
+                const auto* theDelimiter = static_cast<const char*>(std::memchr(thePosition, mDelimiter, static_cast<std::size_t>(theEnd - thePosition)));
+                thePosition = theDelimiter != nullptr ? theDelimiter : theEnd;
+            }
+            if( thePosition == theEnd )
+            {
+                break;
+            }
+            ++thePosition;
+        }
+        return theBound == column_count;
+    }
+
+    //--------------------------------------------------------------------------
+    /// parse the field at aFirst into row mRows of the column aColumn and
+    /// return the end of the field, at the delimiter or aLast; nullptr if the
+    /// field is not a number
+    template< std::size_t aColumn >
+    const char*
+    parse_field
+    (
+        const char* aFirst,
+        const char* aLast
+    )
+    {
+        using Units_t = units_type<aColumn>;
+        using Value_t = typename Units_t::value_t;
+
+        while( aFirst != aLast && *aFirst == ' ' )
+        {
+            ++aFirst;
+        }
+        Value_t theValue{};
+        auto [thePointer, theError] = std::from_chars(aFirst, aLast, theValue);
+        while( thePointer != aLast && *thePointer == ' ' )
+        {
+            ++thePointer;
+        }
+        if( theError != std::errc{} || (thePointer != aLast && *thePointer != mDelimiter) )
+        {
+            return nullptr;
+        }
+
+        const auto theRatio = mRatios[aColumn];
+        std::get<aColumn>(mBatch)[mRows] = theRatio.num == 1 && theRatio.den == 1 ? Units_t{theValue} : from_wire_value<Units_t>(theValue, theRatio);
+        return thePointer;
+    }
+
+    std::ifstream mFile;
+    std::vector<char> mBuffer;
+    std::size_t mBegin = 0;
+    std::size_t mEnd = 0;
+    bool mIsEnd = false;
+    bool mGood = true;
+    std::size_t mLine = 0;
+    std::size_t mBatchSize;
+    char mDelimiter;
+    std::vector<csv_column> mColumns;
+    // the column of each field, column_count for a field that is skipped
+    std::vector<std::size_t> mTargets;
+    std::array<wire_interval_ratio, column_count> mRatios{};
+    std::array<const char* (csv_reader::*)(const char*, const char*), column_count> mParsers{};
+    std::tuple<std::vector<UnitsT>...> mBatch;
+    std::size_t mRows = 0;
+
+}; // end of class csv_reader
+
+//------------------------------------------------------------------------------
+/// Class csv_writer writes columns of UnitsT to a CSV or TSV file, with a
+/// header of their names and unit symbols, as in "power [kW]". The values
+/// are written with std::to_chars, in the shortest form that reads back the
+/// same, to a buffer written out in chunks of csv_chunk_size.
+template< typename... UnitsT >
+class csv_writer
+{
+    static_assert(sizeof...(UnitsT) > 0, "csv_writer requires a column");
+    static_assert((has_unit_symbol<UnitsT> && ...), "UnitsT must have a unit symbol");
+    static_assert((std::is_arithmetic<typename UnitsT::value_t>::value && ...), "csv_writer requires arithmetic value_t");
+
+public:
+
+    //--------------------------------------------------------------------------
+    /// Static member constants
+    static constexpr std::size_t column_count = sizeof...(UnitsT);
+
+    //--------------------------------------------------------------------------
+    /// Create or truncate the file at aPath and write the header of the
+    /// columns aNames, with fields separated by aDelimiter
+    csv_writer
+    (
+        const std::string& aPath,
+        const std::array<std::string_view, column_count>& aNames,
+        char aDelimiter = ','
+    )
+    : mFile{aPath, std::ios::binary | std::ios::trunc}
+    , mDelimiter{aDelimiter}
+    {
+        mBuffer.reserve(csv_chunk_size);
+        const std::array<std::string_view, column_count> theSymbols{unit_symbol<UnitsT>...};
+        for( std::size_t i = 0; i < column_count; ++i )
+        {
+            mBuffer.append(aNames[i]);
+            if( !theSymbols[i].empty() )
+            {
+                mBuffer += " [";
+                mBuffer.append(theSymbols[i]);
+                mBuffer += ']';
+            }
+            mBuffer += i + 1 < column_count ? mDelimiter : '\n';
+        }
+    }
+
+    csv_writer(const csv_writer&) = delete;
+    csv_writer& operator=(const csv_writer&) = delete;
+
+    //--------------------------------------------------------------------------
+    ~csv_writer
+    (
+    )
+    {
+        if( mFile.is_open() )
+        {
+            close();
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    /// true while the file is open and every write has succeeded
+    bool
+    good
+    (
+    ) const
+    {
+        return mFile.is_open() && mFile.good();
+    }
+
+    //--------------------------------------------------------------------------
+    /// append a row for each index of aColumns, which must have one size
+    void
+    write
+    (
+        units_span<const UnitsT>... aColumns
+    )
+    {
+        const std::size_t theRows = std::get<0>(std::tie(aColumns...)).size();
+        assert(((aColumns.size() == theRows) && ...));
+
+        // room for the longest number of each column and its delimiter
+        constexpr std::size_t theRowSize = column_count * 32;
+        for( std::size_t theRow = 0; theRow < theRows; ++theRow )
+        {
+            if( mBuffer.size() + theRowSize > csv_chunk_size )
+            {
+                flush();
+            }
+            std::size_t theColumn = 0;
+            (append_value(aColumns[theRow].value(), ++theColumn == column_count ? '\n' : mDelimiter), ...);
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    /// write the rows buffered and close the file; false if a write failed
+    bool
+    close
+    (
+    )
+    {
+        flush();
+        const bool isGood = good();
+        mFile.close();
+        return isGood;
+    }
+
+private:
+
+    //--------------------------------------------------------------------------
+    template< typename ValueT >
+    void
+    append_value
+    (
+        ValueT aValue,
+        char aEnd
+    )
+    {
+        std::array<char, 32> theChars;
+        const auto theResult = std::to_chars(theChars.data(), theChars.data() + theChars.size(), aValue);
+        assert(theResult.ec == std::errc{});
+        mBuffer.append(theChars.data(), theResult.ptr);
+        mBuffer += aEnd;
+    }
+
+    //--------------------------------------------------------------------------
+    void
+    flush
+    (
+    )
+    {
+        mFile.write(mBuffer.data(), static_cast<std::streamsize>(mBuffer.size()));
+        mBuffer.clear();
+    }
+
+    std::ofstream mFile;
+    char mDelimiter;
+    std::string mBuffer;
+
+}; // end of class csv_writer
+
+} // end of namespace si
@@ -0,0 +1,461 @@
+#pragma once
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <type_traits>
+
+#include "units.hpp"
+
+namespace si
+{
+
+//------------------------------------------------------------------------------
+/// Class dual is a dual number for forward mode automatic differentiation,
+/// a value and its derivatives with respect to LaneCount independent
+/// variables, for use as the value_t of a units_t.
+/// The derivatives are held in a std::array, and every operation updates all
+/// lanes with the same straight-line loop, which the compiler vectorizes.
+template< typename ValueT, std::size_t LaneCount >
+class dual
+{
+    static_assert(std::is_floating_point<ValueT>::value, "ValueT must be a floating point type");
+    static_assert(LaneCount > 0, "LaneCount must be positive");
+
+public:
+
+    //--------------------------------------------------------------------------
+    /// Type aliases
+    using value_type = ValueT;
+    using tangents_t = std::array<ValueT, LaneCount>;
+
+    //--------------------------------------------------------------------------
+    /// Static member constants
+    static constexpr std::size_t lane_count = LaneCount;
+
+    //--------------------------------------------------------------------------
+    constexpr
+    dual
+    (
+    ) = default;
+
+    //--------------------------------------------------------------------------
+    /// Initialize a constant, whose derivatives are zero.
+    /// An arithmetic value converts implicitly.
+    template< typename ValueT2, typename = std::enable_if_t<std::is_arithmetic<ValueT2>::value> >
+    constexpr
+    dual
+    (
+        ValueT2 aValue
+    )
+    : mValue{static_cast<ValueT>(aValue)}
+    {
+    }
+
+    //--------------------------------------------------------------------------
+    /// Initialize a dual from a value and its derivatives.
+    constexpr
+    dual
+    (
+        ValueT aValue,
+        const tangents_t& aTangents
+    )
+    : mValue{aValue}
+    , mTangents{aTangents}
+    {
+    }
+
+    //--------------------------------------------------------------------------
+    /// Initialize a dual from one of another value_type.
+    template< typename ValueT2 >
+    constexpr
+    dual
+    (
+        const dual<ValueT2, LaneCount>& aDual
+    )
+    : mValue{static_cast<ValueT>(aDual.value())}
+    {
+        for( std::size_t i = 0; i < LaneCount; ++i )
+        {
+            mTangents[i] = static_cast<ValueT>(aDual.tangent(i));
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    /// the independent variable aValue, whose derivative is one in lane Lane
+    template< std::size_t Lane >
+    static
+    constexpr
+    dual
+    variable
+    (
+        ValueT aValue
+    )
+    {
+        static_assert(Lane < LaneCount, "Lane must be less than LaneCount");
+        tangents_t theTangents{};
+        theTangents[Lane] = ValueT{1};
+        return dual{aValue, theTangents};
+    }
+
+    //--------------------------------------------------------------------------
+    // Accessor functions
+    constexpr value_type value() const {return mValue;}
+    constexpr value_type tangent(std::size_t aLane) const {return mTangents[aLane];}
+    constexpr const tangents_t& tangents() const {return mTangents;}
+
+    //--------------------------------------------------------------------------
+    /// f(x) given f(x) and f'(x), by the chain rule
+    constexpr
+    dual
+    chain
+    (
+        ValueT aValue,
+        ValueT aDerivative
+    ) const
+    {
+        dual theResult{aValue};
+        for( std::size_t i = 0; i < LaneCount; ++i )
+        {
+            theResult.mTangents[i] = aDerivative * mTangents[i];
+        }
+        return theResult;
+    }
+
+    //--------------------------------------------------------------------------
+    // Arithmetic functions
+    constexpr dual operator+() const {return *this;}
+    constexpr dual operator-() const {return chain(-mValue, ValueT{-1});}
+    constexpr dual& operator+=(const dual& rhs) {return *this = *this + rhs;}
+    constexpr dual& operator-=(const dual& rhs) {return *this = *this - rhs;}
+    constexpr dual& operator*=(const dual& rhs) {return *this = *this * rhs;}
+    constexpr dual& operator/=(const dual& rhs) {return *this = *this / rhs;}
+
+    //--------------------------------------------------------------------------
+    friend
+    constexpr
+    dual
+    operator +
+    (
+        const dual& aLHS,
+        const dual& aRHS
+    )
+    {
+        dual theResult{aLHS.mValue + aRHS.mValue};
+        for( std::size_t i = 0; i < LaneCount; ++i )
+        {
+            theResult.mTangents[i] = aLHS.mTangents[i] + aRHS.mTangents[i];
+        }
+        return theResult;
+    }
+
+    friend
+    constexpr
+    dual
+    operator -
+    (
+        const dual& aLHS,
+        const dual& aRHS
+    )
+    {
+        dual theResult{aLHS.mValue - aRHS.mValue};
+        for( std::size_t i = 0; i < LaneCount; ++i )
+        {
+            theResult.mTangents[i] = aLHS.mTangents[i] - aRHS.mTangents[i];
+        }
+        return theResult;
+    }
+
+    //--------------------------------------------------------------------------
+    // (a·b)' = a'·b + a·b'
+    friend
+    constexpr
+    dual
+    operator *
+    (
+        const dual& aLHS,
+        const dual& aRHS
+    )
+    {
+        dual theResult{aLHS.mValue * aRHS.mValue};
+        for( std::size_t i = 0; i < LaneCount; ++i )
+        {
+            theResult.mTangents[i] = aLHS.mTangents[i] * aRHS.mValue + aLHS.mValue * aRHS.mTangents[i];
+        }
+        return theResult;
+    }
+
+    //--------------------------------------------------------------------------
+    // (a/b)' = (a' - (a/b)·b') / b
+    friend
+    constexpr
+    dual
+    operator /
+    (
+        const dual& aLHS,
+        const dual& aRHS
+    )
+    {
+        const auto theReciprocal = ValueT{1} / aRHS.mValue;
+        dual theResult{aLHS.mValue * theReciprocal};
+        for( std::size_t i = 0; i < LaneCount; ++i )
+        {
+            theResult.mTangents[i] = (aLHS.mTangents[i] - theResult.mValue * aRHS.mTangents[i]) * theReciprocal;
+        }
+        return theResult;
+    }
+
+    //--------------------------------------------------------------------------
+    // Comparisons are of the values only, so that a model branches the same
+    // way whether or not it is being differentiated
+    friend constexpr bool operator==(const dual& aLHS, const dual& aRHS) {return aLHS.mValue == aRHS.mValue;}
+    friend constexpr bool operator!=(const dual& aLHS, const dual& aRHS) {return aLHS.mValue != aRHS.mValue;}
+    friend constexpr bool operator<(const dual& aLHS, const dual& aRHS) {return aLHS.mValue < aRHS.mValue;}
+    friend constexpr bool operator<=(const dual& aLHS, const dual& aRHS) {return aLHS.mValue <= aRHS.mValue;}
+    friend constexpr bool operator>(const dual& aLHS, const dual& aRHS) {return aLHS.mValue > aRHS.mValue;}
+    friend constexpr bool operator>=(const dual& aLHS, const dual& aRHS) {return aLHS.mValue >= aRHS.mValue;}
+
+private:
+
+    value_type mValue{};
+    tangents_t mTangents{};
+
+}; // end of class dual
+
+template< typename ValueT, std::size_t LaneCount >
+struct is_units_value_impl<dual<ValueT, LaneCount>> : std::true_type {};
+
+template< typename ValueT, std::size_t LaneCount >
+struct is_floating_value_impl<dual<ValueT, LaneCount>> : std::true_type {};
+
+//------------------------------------------------------------------------------
+// Derivative rules for the math functions used by the units_t helpers, found
+// by argument dependent lookup
+template< typename ValueT, std::size_t LaneCount >
+inline
+dual<ValueT, LaneCount>
+abs
+(
+    const dual<ValueT, LaneCount>& aX
+)
+{
+    return aX.value() < 0 ? -aX : aX;
+}
+
+template< typename ValueT, std::size_t LaneCount >
+inline
+dual<ValueT, LaneCount>
+sqrt
+(
+    const dual<ValueT, LaneCount>& aX
+)
+{
+    const auto theRoot = std::sqrt(aX.value());
+    return aX.chain(theRoot, ValueT{0.5} / theRoot);
+}
+
+template< typename ValueT, std::size_t LaneCount >
+inline
+dual<ValueT, LaneCount>
+sin
+(
+    const dual<ValueT, LaneCount>& aX
+)
+{
+    return aX.chain(std::sin(aX.value()), std::cos(aX.value()));
+}
+
+template< typename ValueT, std::size_t LaneCount >
+inline
+dual<ValueT, LaneCount>
+cos
+(
+    const dual<ValueT, LaneCount>& aX
+)
+{
+    return aX.chain(std::cos(aX.value()), -std::sin(aX.value()));
+}
+
+template< typename ValueT, std::size_t LaneCount >
+inline
+dual<ValueT, LaneCount>
+tan
+(
+    const dual<ValueT, LaneCount>& aX
+)
+{
+    const auto theTangent = std::tan(aX.value());
+    return aX.chain(theTangent, 1 + theTangent * theTangent);
+}
+
+template< typename ValueT, std::size_t LaneCount >
+inline
+dual<ValueT, LaneCount>
+asin
+(
+    const dual<ValueT, LaneCount>& aX
+)
+{
+    return aX.chain(std::asin(aX.value()), 1 / std::sqrt(1 - aX.value() * aX.value()));
+}
+
+template< typename ValueT, std::size_t LaneCount >
+inline
+dual<ValueT, LaneCount>
+acos
+(
+    const dual<ValueT, LaneCount>& aX
+)
+{
+    return aX.chain(std::acos(aX.value()), -1 / std::sqrt(1 - aX.value() * aX.value()));
+}
+
+template< typename ValueT, std::size_t LaneCount >
+inline
+dual<ValueT, LaneCount>
+atan
+(
+    const dual<ValueT, LaneCount>& aX
+)
+{
+    return aX.chain(std::atan(aX.value()), 1 / (1 + aX.value() * aX.value()));
+}
+
+//------------------------------------------------------------------------------
+// x^n with derivative n·x^(n-1), used by exponentiate
+template< typename ValueT, std::size_t LaneCount >
+inline
+constexpr
+dual<ValueT, LaneCount>
+value_pow
+(
+    const dual<ValueT, LaneCount>& aBase,
+    std::intmax_t aExponent
+)
+{
+    if( aExponent <= 0 )
+    {
+        return dual<ValueT, LaneCount>{1};
+    }
+
+    const auto thePrevious = value_pow(aBase.value(), aExponent - 1);
+    return aBase.chain(thePrevious * aBase.value(), static_cast<ValueT>(aExponent) * thePrevious);
+}
+
+//------------------------------------------------------------------------------
+/// the independent variable aUnits, whose derivative is one in lane Lane of LaneCount
+template< std::size_t Lane, std::size_t LaneCount, typename ValueT, typename IntervalT, typename QuantityT >
+inline
+constexpr
+units_t<dual<ValueT, LaneCount>, IntervalT, QuantityT>
+independent
+(
+    units_t<ValueT, IntervalT, QuantityT> aUnits
+)
+{
+    return units_t<dual<ValueT, LaneCount>, IntervalT, QuantityT>
+    {
+        dual<ValueT, LaneCount>::template variable<Lane>(aUnits.value())
+    };
+}
+
+//------------------------------------------------------------------------------
+/// the value of aUnits, without its derivatives
+template< typename ValueT, std::size_t LaneCount, typename IntervalT, typename QuantityT >
+inline
+constexpr
+units_t<ValueT, IntervalT, QuantityT>
+primal
+(
+    units_t<dual<ValueT, LaneCount>, IntervalT, QuantityT> aUnits
+)
+{
+    return units_t<ValueT, IntervalT, QuantityT>{aUnits.value().value()};
+}
+
+//------------------------------------------------------------------------------
+/// the value of a dimensionless result, e.g. the ratio of two lengths
+template< typename ValueT, std::size_t LaneCount >
+inline
+constexpr
+ValueT
+primal
+(
+    const dual<ValueT, LaneCount>& aDual
+)
+{
+    return aDual.value();
+}
+
+//------------------------------------------------------------------------------
+/// the derivative of aUnits with respect to the independent variable aVariable
+/// in lane Lane, e.g. the derivative of joules with respect to meters is newtons
+template
+<
+    std::size_t Lane,
+    typename ValueT,
+    std::size_t LaneCount,
+    typename IntervalT,
+    typename QuantityT,
+    typename VariableIntervalT,
+    typename VariableQuantityT
+>
+inline
+constexpr
+divide_units<units_t<ValueT, IntervalT, QuantityT>, units_t<ValueT, VariableIntervalT, VariableQuantityT>>
+derivative
+(
+    units_t<dual<ValueT, LaneCount>, IntervalT, QuantityT> aUnits,
+    units_t<dual<ValueT, LaneCount>, VariableIntervalT, VariableQuantityT> aVariable
+)
+{
+    static_assert(Lane < LaneCount, "Lane must be less than LaneCount");
+    using Result_t = divide_units<units_t<ValueT, IntervalT, QuantityT>, units_t<ValueT, VariableIntervalT, VariableQuantityT>>;
+    static_cast<void>(aVariable);
+    return Result_t{aUnits.value().tangent(Lane)};
+}
+
+//------------------------------------------------------------------------------
+/// the derivative of a dimensionless result, e.g. the ratio of two lengths,
+/// with respect to the independent variable aVariable in lane Lane
+template
+<
+    std::size_t Lane,
+    typename ValueT,
+    std::size_t LaneCount,
+    typename VariableIntervalT,
+    typename VariableQuantityT
+>
+inline
+constexpr
+divide_units<scalar<r_one, ValueT>, units_t<ValueT, VariableIntervalT, VariableQuantityT>>
+derivative
+(
+    const dual<ValueT, LaneCount>& aDual,
+    units_t<dual<ValueT, LaneCount>, VariableIntervalT, VariableQuantityT> aVariable
+)
+{
+    return derivative<Lane>(scalar<r_one, dual<ValueT, LaneCount>>{aDual}, aVariable);
+}
+
+} // end of namespace si
+
+//------------------------------------------------------------------------------
+/// Specializations of std::common_type, so that a dual and an arithmetic type
+/// or another dual promote like their values do.
+template< typename ValueT1, typename ValueT2, std::size_t LaneCount >
+struct std::common_type<si::dual<ValueT1, LaneCount>, si::dual<ValueT2, LaneCount>>
+{
+    using type = si::dual<std::common_type_t<ValueT1, ValueT2>, LaneCount>;
+};
+
+template< typename ValueT1, std::size_t LaneCount, typename ValueT2 >
+struct std::common_type<si::dual<ValueT1, LaneCount>, ValueT2>
+{
+    using type = si::dual<std::common_type_t<ValueT1, ValueT2>, LaneCount>;
+};
+
+template< typename ValueT1, typename ValueT2, std::size_t LaneCount >
+struct std::common_type<ValueT1, si::dual<ValueT2, LaneCount>>
+{
+    using type = si::dual<std::common_type_t<ValueT1, ValueT2>, LaneCount>;
+};
@@ -1,7 +1,6 @@
 #pragma once
 #include <cstdint>
 #include <ratio>
-#include <string>
 #include "constants.hpp"
 
 namespace si
@@ -119,38 +118,4 @@ template<> inline constexpr const char32_t* superscript_digit<char32_t>[digit_co
     U"\u2079"
 };
 
-template<typename CharT, std::intmax_t Exp>
-inline
-std::basic_string<CharT>
-basic_string_from
-(
-    exponent_t<Exp> aExponent
-)
-{
-    auto theExponent = aExponent.value;
-
-    std::basic_string<CharT> theSign;
-
-    if( theExponent < 0 )
-    {
-        theSign = superscript_minus<CharT>;
-        theExponent = -theExponent;
-    }
-
-    std::basic_string<CharT> theResult;
-
-    do
-    {
-        theResult = superscript_digit<CharT>[theExponent % 10] + theResult;
-        theExponent /= 10;
-    }
-    while( theExponent > 0 );
-
-    theResult = theSign + theResult;
-
-    return theResult;
-}
-
 } // end of namespace si
-
-#include "string-from.hpp"
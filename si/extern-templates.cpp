@@ -0,0 +1,5 @@
+// the explicit instantiation definitions of the templates that
+// extern-templates.hpp declares; compile and link this file once
+
+#define SI_EXTERN_TEMPLATE template
+#include "extern-templates.hpp"
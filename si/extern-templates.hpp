@@ -0,0 +1,73 @@
+#pragma once
+#include <istream>
+#include <ostream>
+#include <ratio>
+#include <string>
+
+#include "units.hpp"
+
+//------------------------------------------------------------------------------
+/// The formatting templates of the common units_t, compiled once in
+/// extern-templates.cpp. A translation unit that includes this header, and a
+/// program that links extern-templates.cpp, does not instantiate them again.
+///
+/// By default SI_EXTERN_TEMPLATE declares each one an explicit instantiation
+/// declaration, "extern template". extern-templates.cpp defines it as
+/// "template" before including this header, so that the same list is the
+/// explicit instantiation definitions.
+#ifndef SI_EXTERN_TEMPLATE
+#define SI_EXTERN_TEMPLATE extern template
+#endif
+
+/// the common units_t, each passed to aMacro with the character type aCharT
+#define SI_COMMON_UNITS(aMacro, aCharT) \
+aMacro(aCharT, si::meters<>) \
+aMacro(aCharT, si::meters<std::kilo>) \
+aMacro(aCharT, si::meters<std::milli>) \
+aMacro(aCharT, si::kilograms<>) \
+aMacro(aCharT, si::grams<>) \
+aMacro(aCharT, si::seconds<>) \
+aMacro(aCharT, si::minutes<>) \
+aMacro(aCharT, si::hours<>) \
+aMacro(aCharT, si::milliseconds<>) \
+aMacro(aCharT, si::microseconds<>) \
+aMacro(aCharT, si::nanoseconds<>) \
+aMacro(aCharT, si::amperes<>) \
+aMacro(aCharT, si::kelvins<>) \
+aMacro(aCharT, si::candelas<>) \
+aMacro(aCharT, si::moles<>) \
+aMacro(aCharT, si::radians<>) \
+aMacro(aCharT, si::steradians<>) \
+aMacro(aCharT, si::hertz<>) \
+aMacro(aCharT, si::newtons<>) \
+aMacro(aCharT, si::coulombs<>) \
+aMacro(aCharT, si::lux<>) \
+aMacro(aCharT, si::pascals<>) \
+aMacro(aCharT, si::joules<>) \
+aMacro(aCharT, si::watts<>) \
+aMacro(aCharT, si::watts<std::kilo>) \
+aMacro(aCharT, si::volts<>) \
+aMacro(aCharT, si::farads<>) \
+aMacro(aCharT, si::ohms<>) \
+aMacro(aCharT, si::siemens<>) \
+aMacro(aCharT, si::webers<>) \
+aMacro(aCharT, si::teslas<>) \
+aMacro(aCharT, si::henries<>) \
+aMacro(aCharT, si::lumens<>)
+
+/// basic_string_from of aUnitsT for aCharT
+#define SI_STRING_FROM_TEMPLATE(aCharT, aUnitsT) \
+SI_EXTERN_TEMPLATE std::basic_string<aCharT> si::basic_string_from<aCharT>(aUnitsT);
+
+/// the stream operators of aUnitsT for aCharT
+#define SI_STREAM_TEMPLATES(aCharT, aUnitsT) \
+SI_EXTERN_TEMPLATE std::basic_ostream<aCharT>& si::operator << <aCharT>(std::basic_ostream<aCharT>&, aUnitsT); \
+SI_EXTERN_TEMPLATE std::basic_istream<aCharT>& si::operator >> <aCharT>(std::basic_istream<aCharT>&, aUnitsT&);
+
+// the standard library has streams of char and wchar_t only
+SI_COMMON_UNITS(SI_STRING_FROM_TEMPLATE, char)
+SI_COMMON_UNITS(SI_STRING_FROM_TEMPLATE, wchar_t)
+SI_COMMON_UNITS(SI_STRING_FROM_TEMPLATE, char16_t)
+SI_COMMON_UNITS(SI_STRING_FROM_TEMPLATE, char32_t)
+SI_COMMON_UNITS(SI_STREAM_TEMPLATES, char)
+SI_COMMON_UNITS(SI_STREAM_TEMPLATES, wchar_t)
@@ -0,0 +1,272 @@
+#pragma once
+#include <bit>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <type_traits>
+
+#include "constexpr-math.hpp"
+#include "units.hpp"
+
+namespace si
+{
+
+//------------------------------------------------------------------------------
+/// Namespace fast has the constexpr_ approximations of the math functions
+/// for units_t, whose span variants vectorize since there are no calls into
+/// libm. They are evaluated in double, and their results are float for
+/// a float value_t and double otherwise. Call them qualified, e.g.
+/// fast::sine(x), since si::sine is also found by argument dependent lookup.
+/// They assume IEEE arithmetic, and do not survive -ffast-math.
+namespace fast
+{
+
+//------------------------------------------------------------------------------
+/// the value_t of the results of the fast functions for ValueT
+template< typename ValueT >
+using result_value_t = std::conditional_t<std::is_same<ValueT, float>::value, float, double>;
+
+//------------------------------------------------------------------------------
+/// the results of sincos
+template< typename ValueT >
+struct sincos_t
+{
+    scalar<r_one, ValueT> sine;
+    scalar<r_one, ValueT> cosine;
+};
+
+//------------------------------------------------------------------------------
+/// 1/√aValue for a positive normal aValue, by Newton iterations from an
+/// estimate made on the bit pattern
+inline
+constexpr
+double
+reciprocal_square_root_impl
+(
+    double aValue
+)
+{
+    const double theHalf = 0.5 * aValue;
+    double y = std::bit_cast<double>(std::uint64_t{0x5fe6eb50c7b537a9} - (std::bit_cast<std::uint64_t>(aValue) >> 1));
+    y = y * (1.5 - theHalf * y * y);
+    y = y * (1.5 - theHalf * y * y);
+    y = y * (1.5 - theHalf * y * y);
+    y = y * (1.5 - theHalf * y * y);
+    return y + y * (0.5 - theHalf * y * y);
+}
+
+//------------------------------------------------------------------------------
+/// sine of radians, within 1.5 ULP for |aRadians| ≤ 100 rad and 2.5 ULP
+/// for |aRadians| ≤ 10^5 rad in double, and 1 ULP in float
+template< typename ValueT, typename IntervalT >
+inline
+constexpr
+scalar<r_one, result_value_t<ValueT>>
+sine
+(
+    radians<IntervalT, ValueT> aRadians
+)
+{
+    static_assert(std::is_arithmetic<ValueT>::value, "fast::sine requires an arithmetic value_t");
+    const auto theRadians = units_cast<radians<r_one, double>>(aRadians).value();
+    return scalar<r_one, result_value_t<ValueT>>{static_cast<result_value_t<ValueT>>(constexpr_sincos_near(theRadians).sine)};
+}
+
+//------------------------------------------------------------------------------
+/// cosine of radians, within 1.5 ULP for |aRadians| ≤ 100 rad and 2.5 ULP
+/// for |aRadians| ≤ 10^5 rad in double, and 1 ULP in float
+template< typename ValueT, typename IntervalT >
+inline
+constexpr
+scalar<r_one, result_value_t<ValueT>>
+cosine
+(
+    radians<IntervalT, ValueT> aRadians
+)
+{
+    static_assert(std::is_arithmetic<ValueT>::value, "fast::cosine requires an arithmetic value_t");
+    const auto theRadians = units_cast<radians<r_one, double>>(aRadians).value();
+    return scalar<r_one, result_value_t<ValueT>>{static_cast<result_value_t<ValueT>>(constexpr_sincos_near(theRadians).cosine)};
+}
+
+//------------------------------------------------------------------------------
+/// sine and cosine of radians from one argument reduction, within the bounds
+/// of sine and cosine
+template< typename ValueT, typename IntervalT >
+inline
+constexpr
+sincos_t<result_value_t<ValueT>>
+sincos
+(
+    radians<IntervalT, ValueT> aRadians
+)
+{
+    static_assert(std::is_arithmetic<ValueT>::value, "fast::sincos requires an arithmetic value_t");
+    using Result_t = result_value_t<ValueT>;
+    const auto theRadians = units_cast<radians<r_one, double>>(aRadians).value();
+    const auto theResult = constexpr_sincos_near(theRadians);
+    return sincos_t<Result_t>
+    {
+        scalar<r_one, Result_t>{static_cast<Result_t>(theResult.sine)},
+        scalar<r_one, Result_t>{static_cast<Result_t>(theResult.cosine)}
+    };
+}
+
+//------------------------------------------------------------------------------
+/// angle of the vector (aX, aY) of any one quantity, within 2 ULP in double
+/// and 1 ULP in float
+template
+<
+    typename ValueT1,
+    typename IntervalT1,
+    typename ValueT2,
+    typename IntervalT2,
+    typename QuantityT
+>
+inline
+constexpr
+radians<r_one, result_value_t<common_value_t<ValueT1, ValueT2>>>
+arc_tangent2
+(
+    units_t<ValueT1, IntervalT1, QuantityT> aY,
+    units_t<ValueT2, IntervalT2, QuantityT> aX
+)
+{
+    static_assert(std::is_arithmetic<common_value_t<ValueT1, ValueT2>>::value, "fast::arc_tangent2 requires an arithmetic value_t");
+    using Result_t = result_value_t<common_value_t<ValueT1, ValueT2>>;
+    using Common_t = units_t<double, IntervalT1, QuantityT>;
+    const auto theY = units_cast<Common_t>(aY).value();
+    const auto theX = units_cast<Common_t>(aX).value();
+    return radians<r_one, Result_t>{static_cast<Result_t>(constexpr_atan2(theY, theX))};
+}
+
+//------------------------------------------------------------------------------
+/// the result type of reciprocal_square_root
+template< typename ValueT, typename IntervalT, typename QuantityT >
+using reciprocal_sqrt_result_t = divide_units
+<
+    scalar<r_one, result_value_t<ValueT>>,
+    sqrt_result_t<result_value_t<ValueT>, IntervalT, QuantityT, std::ratio<1,10000000000000>>
+>;
+
+//------------------------------------------------------------------------------
+/// 1/√aUnits for positive normal values, within 1.5 ULP in double and 1 ULP
+/// in float, e.g. to normalize a vector by its squared norm
+template< typename ValueT, typename IntervalT, typename QuantityT >
+inline
+constexpr
+reciprocal_sqrt_result_t<ValueT, IntervalT, QuantityT>
+reciprocal_square_root
+(
+    units_t<ValueT, IntervalT, QuantityT> aUnits
+)
+{
+    static_assert(std::is_arithmetic<ValueT>::value, "fast::reciprocal_square_root requires an arithmetic value_t");
+    using Result_t = reciprocal_sqrt_result_t<ValueT, IntervalT, QuantityT>;
+    using Value_t = typename Result_t::value_t;
+    return Result_t{static_cast<Value_t>(reciprocal_square_root_impl(static_cast<double>(aUnits.value())))};
+}
+
+//------------------------------------------------------------------------------
+/// aResult[i] = fast::sine(aRadians[i])
+template< typename RadiansT >
+inline
+void
+sine
+(
+    std::span<RadiansT> aRadians,
+    std::span<decltype(fast::sine(std::remove_cv_t<RadiansT>{}))> aResult
+)
+{
+    assert(aResult.size() >= aRadians.size());
+    for( std::size_t i = 0; i < aRadians.size(); ++i )
+    {
+        aResult[i] = fast::sine(aRadians[i]);
+    }
+}
+
+//------------------------------------------------------------------------------
+/// aResult[i] = fast::cosine(aRadians[i])
+template< typename RadiansT >
+inline
+void
+cosine
+(
+    std::span<RadiansT> aRadians,
+    std::span<decltype(fast::cosine(std::remove_cv_t<RadiansT>{}))> aResult
+)
+{
+    assert(aResult.size() >= aRadians.size());
+    for( std::size_t i = 0; i < aRadians.size(); ++i )
+    {
+        aResult[i] = fast::cosine(aRadians[i]);
+    }
+}
+
+//------------------------------------------------------------------------------
+/// aSines[i], aCosines[i] = fast::sincos(aRadians[i])
+template< typename RadiansT >
+inline
+void
+sincos
+(
+    std::span<RadiansT> aRadians,
+    std::span<decltype(fast::sine(std::remove_cv_t<RadiansT>{}))> aSines,
+    std::span<decltype(fast::sine(std::remove_cv_t<RadiansT>{}))> aCosines
+)
+{
+    assert(aSines.size() >= aRadians.size());
+    assert(aCosines.size() >= aRadians.size());
+    using Sine_t = decltype(fast::sine(std::remove_cv_t<RadiansT>{}));
+    for( std::size_t i = 0; i < aRadians.size(); ++i )
+    {
+        // assigned through the values, since copies of the whole sincos_t
+        // stop the loop from vectorizing
+        const auto theResult = fast::sincos(aRadians[i]);
+        aSines[i] = Sine_t{theResult.sine.value()};
+        aCosines[i] = Sine_t{theResult.cosine.value()};
+    }
+}
+
+//------------------------------------------------------------------------------
+/// aResult[i] = fast::arc_tangent2(aY[i], aX[i])
+template< typename YT, typename XT >
+inline
+void
+arc_tangent2
+(
+    std::span<YT> aY,
+    std::span<XT> aX,
+    std::span<decltype(fast::arc_tangent2(std::remove_cv_t<YT>{}, std::remove_cv_t<XT>{}))> aResult
+)
+{
+    assert(aY.size() == aX.size());
+    assert(aResult.size() >= aY.size());
+    for( std::size_t i = 0; i < aY.size(); ++i )
+    {
+        aResult[i] = fast::arc_tangent2(aY[i], aX[i]);
+    }
+}
+
+//------------------------------------------------------------------------------
+/// aResult[i] = fast::reciprocal_square_root(aUnits[i])
+template< typename UnitsT >
+inline
+void
+reciprocal_square_root
+(
+    std::span<UnitsT> aUnits,
+    std::span<decltype(fast::reciprocal_square_root(std::remove_cv_t<UnitsT>{}))> aResult
+)
+{
+    assert(aResult.size() >= aUnits.size());
+    for( std::size_t i = 0; i < aUnits.size(); ++i )
+    {
+        aResult[i] = fast::reciprocal_square_root(aUnits[i]);
+    }
+}
+
+} // end of namespace fast
+
+} // end of namespace si
@@ -0,0 +1,379 @@
+#pragma once
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <span>
+
+#include "units.hpp"
+
+namespace si
+{
+
+//------------------------------------------------------------------------------
+/// Class exponential_moving_average smooths a stream of UnitsT samples with a
+/// first order low pass filter whose time constant is given as a time units_t.
+template< typename UnitsT >
+class exponential_moving_average
+{
+    static_assert(is_units_t<UnitsT>, "UnitsT must be of type si::units_t");
+    static_assert(std::is_floating_point<typename UnitsT::value_t>::value, "UnitsT must have a floating point value_t");
+
+public:
+
+    //--------------------------------------------------------------------------
+    /// Type aliases
+    using samples_t = UnitsT;
+    using value_t = typename UnitsT::value_t;
+    using coefficient_t = scalar<r_one, value_t>;
+    using times_t = seconds<r_one, value_t>;
+
+    //--------------------------------------------------------------------------
+    /// Initialize a filter for samples that arrive at irregular times.
+    /// Use operator()(sample, elapsed) to filter.
+    /// @param aTimeConstant the time for the step response to reach 1 - 1/e
+    template< typename IntervalT, typename ValueT >
+    constexpr
+    explicit
+    exponential_moving_average
+    (
+        seconds<IntervalT, ValueT> aTimeConstant
+    )
+    : mTimeConstant{aTimeConstant}
+    {
+    }
+
+    //--------------------------------------------------------------------------
+    /// Initialize a filter for samples that arrive at a fixed period.
+    /// @param aTimeConstant the time for the step response to reach 1 - 1/e
+    /// @param aSamplePeriod the time between samples
+    template< typename IntervalT1, typename ValueT1, typename IntervalT2, typename ValueT2 >
+    exponential_moving_average
+    (
+        seconds<IntervalT1, ValueT1> aTimeConstant,
+        seconds<IntervalT2, ValueT2> aSamplePeriod
+    )
+    : mTimeConstant{aTimeConstant}
+    , mAlpha{alpha(aSamplePeriod)}
+    {
+    }
+
+    //--------------------------------------------------------------------------
+    /// the weight of each new sample for the fixed sample period
+    constexpr coefficient_t weight() const {return mAlpha;}
+
+    //--------------------------------------------------------------------------
+    /// the current filter output
+    constexpr samples_t value() const {return mOutput;}
+
+    //--------------------------------------------------------------------------
+    /// Filter one sample taken one sample period after the previous one.
+    /// The first sample initializes the output.
+    constexpr
+    samples_t
+    operator()
+    (
+        samples_t aSample
+    )
+    {
+        return update(aSample, mAlpha.value());
+    }
+
+    //--------------------------------------------------------------------------
+    /// Filter one sample taken aElapsed after the previous one.
+    template< typename IntervalT, typename ValueT >
+    samples_t
+    operator()
+    (
+        samples_t aSample,
+        seconds<IntervalT, ValueT> aElapsed
+    )
+    {
+        return update(aSample, alpha(aElapsed).value());
+    }
+
+    //--------------------------------------------------------------------------
+    /// Filter a block of samples taken at the fixed sample period.
+    /// aOutput may be the same span as aInput.
+    constexpr
+    void
+    process
+    (
+        std::span<const samples_t> aInput,
+        std::span<samples_t> aOutput
+    )
+    {
+        assert(aOutput.size() >= aInput.size());
+        if( aInput.empty() )
+        {
+            return;
+        }
+
+        const auto theAlpha = mAlpha.value();
+        auto theOutput = mPrimed ? mOutput.value() : aInput[0].value();
+        for( std::size_t i = 0; i < aInput.size(); ++i )
+        {
+            theOutput += theAlpha * (aInput[i].value() - theOutput);
+            aOutput[i] = samples_t{theOutput};
+        }
+
+        mOutput = samples_t{theOutput};
+        mPrimed = true;
+    }
+
+    //--------------------------------------------------------------------------
+    /// Forget all previous samples.
+    constexpr void reset() {mPrimed = false; mOutput = samples_t::zero();}
+
+private:
+
+    template< typename IntervalT, typename ValueT >
+    coefficient_t
+    alpha
+    (
+        seconds<IntervalT, ValueT> aElapsed
+    ) const
+    {
+        return coefficient_t{1 - std::exp(-static_cast<value_t>(aElapsed / mTimeConstant))};
+    }
+
+    constexpr
+    samples_t
+    update
+    (
+        samples_t aSample,
+        value_t aAlpha
+    )
+    {
+        if( mPrimed )
+        {
+            mOutput = samples_t{mOutput.value() + aAlpha * (aSample.value() - mOutput.value())};
+        }
+        else
+        {
+            mOutput = aSample;
+            mPrimed = true;
+        }
+
+        return mOutput;
+    }
+
+    times_t mTimeConstant;
+    coefficient_t mAlpha = coefficient_t{1};
+    samples_t mOutput = samples_t::zero();
+    bool mPrimed = false;
+
+}; // end of class exponential_moving_average
+
+//------------------------------------------------------------------------------
+/// Class biquad_filter is a second order IIR filter in transposed direct form II:
+/// y[n] = b0·x[n] + b1·x[n-1] + b2·x[n-2] - a1·y[n-1] - a2·y[n-2]
+template< typename UnitsT >
+class biquad_filter
+{
+    static_assert(is_units_t<UnitsT>, "UnitsT must be of type si::units_t");
+    static_assert(std::is_floating_point<typename UnitsT::value_t>::value, "UnitsT must have a floating point value_t");
+
+public:
+
+    //--------------------------------------------------------------------------
+    /// Type aliases
+    using samples_t = UnitsT;
+    using value_t = typename UnitsT::value_t;
+    using coefficient_t = scalar<r_one, value_t>;
+
+    //--------------------------------------------------------------------------
+    /// Initialize a filter from coefficients normalized so that a0 == 1.
+    constexpr
+    biquad_filter
+    (
+        coefficient_t aB0,
+        coefficient_t aB1,
+        coefficient_t aB2,
+        coefficient_t aA1,
+        coefficient_t aA2
+    )
+    : mB0{aB0.value()}
+    , mB1{aB1.value()}
+    , mB2{aB2.value()}
+    , mA1{aA1.value()}
+    , mA2{aA2.value()}
+    {
+    }
+
+    //--------------------------------------------------------------------------
+    /// Filter one sample.
+    constexpr
+    samples_t
+    operator()
+    (
+        samples_t aSample
+    )
+    {
+        const auto x = aSample.value();
+        const auto y = mB0 * x + mZ1;
+        mZ1 = mB1 * x - mA1 * y + mZ2;
+        mZ2 = mB2 * x - mA2 * y;
+        return samples_t{y};
+    }
+
+    //--------------------------------------------------------------------------
+    /// Filter a block of samples.
+    /// aOutput may be the same span as aInput.
+    constexpr
+    void
+    process
+    (
+        std::span<const samples_t> aInput,
+        std::span<samples_t> aOutput
+    )
+    {
+        assert(aOutput.size() >= aInput.size());
+
+        // keep the state in locals so that it stays in registers
+        auto theZ1 = mZ1;
+        auto theZ2 = mZ2;
+        for( std::size_t i = 0; i < aInput.size(); ++i )
+        {
+            const auto x = aInput[i].value();
+            const auto y = mB0 * x + theZ1;
+            theZ1 = mB1 * x - mA1 * y + theZ2;
+            theZ2 = mB2 * x - mA2 * y;
+            aOutput[i] = samples_t{y};
+        }
+
+        mZ1 = theZ1;
+        mZ2 = theZ2;
+    }
+
+    //--------------------------------------------------------------------------
+    /// Forget all previous samples.
+    constexpr void reset() {mZ1 = mZ2 = value_t{};}
+
+private:
+
+    value_t mB0;
+    value_t mB1;
+    value_t mB2;
+    value_t mA1;
+    value_t mA2;
+    value_t mZ1{};
+    value_t mZ2{};
+
+}; // end of class biquad_filter
+
+//------------------------------------------------------------------------------
+/// Class fir_filter is a finite impulse response filter with TapCount taps:
+/// y[n] = taps[0]·x[n] + taps[1]·x[n-1] + ... + taps[TapCount-1]·x[n-TapCount+1]
+template< typename UnitsT, std::size_t TapCount >
+class fir_filter
+{
+    static_assert(is_units_t<UnitsT>, "UnitsT must be of type si::units_t");
+    static_assert(std::is_floating_point<typename UnitsT::value_t>::value, "UnitsT must have a floating point value_t");
+    static_assert(TapCount > 0, "TapCount must be positive");
+
+public:
+
+    //--------------------------------------------------------------------------
+    /// Type aliases
+    using samples_t = UnitsT;
+    using value_t = typename UnitsT::value_t;
+    using coefficient_t = scalar<r_one, value_t>;
+
+    //--------------------------------------------------------------------------
+    /// Initialize a filter from its taps, aTaps[0] weighs the newest sample.
+    constexpr
+    explicit
+    fir_filter
+    (
+        const std::array<coefficient_t, TapCount>& aTaps
+    )
+    {
+        // stored oldest first so that the history window and the taps line up
+        for( std::size_t i = 0; i < TapCount; ++i )
+        {
+            mTaps[i] = aTaps[TapCount - 1 - i].value();
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    /// Filter one sample.
+    constexpr
+    samples_t
+    operator()
+    (
+        samples_t aSample
+    )
+    {
+        // every sample is written twice so that the last TapCount samples are
+        // always contiguous, newest first, from mHistory[mPosition]
+        mPosition = mPosition == 0 ? TapCount - 1 : mPosition - 1;
+        mHistory[mPosition] = mHistory[mPosition + TapCount] = aSample.value();
+
+        const value_t* const theWindow = &mHistory[mPosition];
+        value_t theSum{};
+        for( std::size_t k = 0; k < TapCount; ++k )
+        {
+            theSum += mTaps[TapCount - 1 - k] * theWindow[k];
+        }
+
+        return samples_t{theSum};
+    }
+
+    //--------------------------------------------------------------------------
+    /// Filter a block of samples.
+    /// The output for each sample is a dot product of contiguous ranges,
+    /// which the compiler vectorizes. aOutput must not overlap aInput.
+    constexpr
+    void
+    process
+    (
+        std::span<const samples_t> aInput,
+        std::span<samples_t> aOutput
+    )
+    {
+        assert(aOutput.size() >= aInput.size());
+
+        const auto theCount = aInput.size();
+        const auto theHistoryCount = std::min(theCount, TapCount - 1);
+
+        // outputs that depend on samples from before this block
+        for( std::size_t i = 0; i < theHistoryCount; ++i )
+        {
+            aOutput[i] = (*this)(aInput[i]);
+        }
+
+        // outputs that depend only on this block
+        for( std::size_t i = theHistoryCount; i < theCount; ++i )
+        {
+            const samples_t* const theWindow = &aInput[i + 1 - TapCount];
+            value_t theSum{};
+            for( std::size_t k = 0; k < TapCount; ++k )
+            {
+                theSum += mTaps[k] * theWindow[k].value();
+            }
+            aOutput[i] = samples_t{theSum};
+        }
+
+        // bring the history up to date
+        for( std::size_t i = std::max(theHistoryCount, theCount - theHistoryCount); i < theCount; ++i )
+        {
+            mPosition = mPosition == 0 ? TapCount - 1 : mPosition - 1;
+            mHistory[mPosition] = mHistory[mPosition + TapCount] = aInput[i].value();
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    /// Forget all previous samples.
+    constexpr void reset() {mHistory = {}; mPosition = 0;}
+
+private:
+
+    std::array<value_t, TapCount> mTaps{};
+    std::array<value_t, 2 * TapCount> mHistory{};
+    std::size_t mPosition = 0;
+
+}; // end of class fir_filter
+
+} // end of namespace si
@@ -0,0 +1,565 @@
+#pragma once
+#include <array>
+#include <charconv>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+#include "unit-symbol.hpp"
+#include "units.hpp"
+#include "wire-format.hpp"
+
+namespace si
+{
+
+//------------------------------------------------------------------------------
+/// the JSON forms of a units_t: an object such as {"value":12.3,"unit":"kN"},
+/// or a string of the value and its unit symbol such as "12.3 kN"
+enum class json_style
+{
+    object,
+    string
+};
+
+//------------------------------------------------------------------------------
+/// the characters of aParts joined, of total length aSize
+template< std::size_t aSize >
+constexpr
+std::array<char, aSize>
+join_json_text
+(
+    std::initializer_list<std::string_view> aParts
+)
+{
+    std::array<char, aSize> theText{};
+    std::size_t theSize = 0;
+    for( const auto thePart : aParts )
+    {
+        for( const char theChar : thePart )
+        {
+            theText[theSize++] = theChar;
+        }
+    }
+    return theText;
+}
+
+//------------------------------------------------------------------------------
+/// the JSON text that follows the value of UnitsT, built once at compile time
+template< typename UnitsT >
+struct json_units_text
+{
+    static constexpr std::string_view symbol = unit_symbol<UnitsT>;
+    static constexpr std::string_view object_begin = "{\"value\":";
+
+    // ,"unit":"kN"}
+    static constexpr std::array object_end_chars = join_json_text<symbol.size() + 11>({",\"unit\":\"", symbol, "\"}"});
+    static constexpr std::string_view object_end{object_end_chars.data(), object_end_chars.size()};
+
+    // the space and symbol, if any, and the closing quote
+    static constexpr std::array string_end_chars = join_json_text<symbol.size() + (symbol.empty() ? 1 : 2)>({symbol.empty() ? "" : " ", symbol, "\""});
+    static constexpr std::string_view string_end{string_end_chars.data(), string_end_chars.size()};
+};
+
+//------------------------------------------------------------------------------
+/// append the JSON form of aUnits to aJson, its value written with
+/// std::to_chars in the shortest form that reads back the same. The value of
+/// an object is null if it is not finite.
+template< typename UnitsT >
+inline
+void
+append_json
+(
+    std::string& aJson,
+    UnitsT aUnits,
+    json_style aStyle = json_style::object
+)
+{
+    static_assert(std::is_arithmetic<typename UnitsT::value_t>::value, "append_json requires an arithmetic value_t");
+    using Text_t = json_units_text<UnitsT>;
+
+    aJson += aStyle == json_style::object ? Text_t::object_begin : "\"";
+    if( aStyle == json_style::object && !std::isfinite(static_cast<double>(aUnits.value())) )
+    {
+        aJson += "null";
+    }
+    else
+    {
+        std::array<char, 32> theChars;
+        const auto theResult = std::to_chars(theChars.data(), theChars.data() + theChars.size(), aUnits.value());
+        aJson.append(theChars.data(), theResult.ptr);
+    }
+    aJson += aStyle == json_style::object ? Text_t::object_end : Text_t::string_end;
+}
+
+//------------------------------------------------------------------------------
+/// append the JSON array of the forms of aUnits to aJson
+template< typename UnitsT >
+inline
+void
+append_json
+(
+    std::string& aJson,
+    std::span<const UnitsT> aUnits,
+    json_style aStyle = json_style::object
+)
+{
+    aJson += '[';
+    for( std::size_t i = 0; i < aUnits.size(); ++i )
+    {
+        if( i > 0 )
+        {
+            aJson += ',';
+        }
+        append_json(aJson, aUnits[i], aStyle);
+    }
+    aJson += ']';
+}
+
+//------------------------------------------------------------------------------
+/// the JSON form of aUnits
+template< typename UnitsT >
+inline
+std::string
+to_json
+(
+    UnitsT aUnits,
+    json_style aStyle = json_style::object
+)
+{
+    std::string theJson;
+    append_json(theJson, aUnits, aStyle);
+    return theJson;
+}
+
+//------------------------------------------------------------------------------
+/// the JSON array of the forms of aUnits
+template< typename UnitsT >
+inline
+std::string
+to_json
+(
+    std::span<const UnitsT> aUnits,
+    json_style aStyle = json_style::object
+)
+{
+    std::string theJson;
+    theJson.reserve(aUnits.size() * (json_units_text<UnitsT>::object_end.size() + 24));
+    append_json(theJson, aUnits, aStyle);
+    return theJson;
+}
+
+//------------------------------------------------------------------------------
+/// remove the JSON white space at the front of aJson
+inline
+void
+skip_json_space
+(
+    std::string_view& aJson
+)
+{
+    while( !aJson.empty() && (aJson[0] == ' ' || aJson[0] == '\t' || aJson[0] == '\n' || aJson[0] == '\r') )
+    {
+        aJson.remove_prefix(1);
+    }
+}
+
+//------------------------------------------------------------------------------
+/// remove the character aChar, and the white space before it, from the front
+/// of aJson; false if aJson does not begin with it
+inline
+bool
+skip_json_char
+(
+    std::string_view& aJson,
+    char aChar
+)
+{
+    skip_json_space(aJson);
+    if( aJson.empty() || aJson[0] != aChar )
+    {
+        return false;
+    }
+    aJson.remove_prefix(1);
+    return true;
+}
+
+//------------------------------------------------------------------------------
+/// read the JSON string at the front of aJson, with its escapes, into
+/// aBuffer and return its characters; std::nullopt if it is not a string or
+/// does not fit. A string with no escapes is returned in place.
+template< std::size_t aSize >
+inline
+std::optional<std::string_view>
+read_json_string
+(
+    std::string_view& aJson,
+    std::array<char, aSize>& aBuffer
+)
+{
+    if( !skip_json_char(aJson, '"') )
+    {
+        return std::nullopt;
+    }
+    const auto theEnd = aJson.find_first_of("\"\\");
+    if( theEnd != std::string_view::npos && aJson[theEnd] == '"' )
+    {
+        const auto theString = aJson.substr(0, theEnd);
+        aJson.remove_prefix(theEnd + 1);
+        return theString;
+    }
+
+    std::size_t theSize = 0;
+    const auto theAppend = [&aBuffer, &theSize](char aChar)
+    {
+        if( theSize == aSize )
+        {
+            return false;
+        }
+        aBuffer[theSize++] = aChar;
+        return true;
+    };
+    for( ;; )
+    {
+        if( aJson.empty() )
+        {
+            return std::nullopt;
+        }
+        const char theChar = aJson[0];
+        aJson.remove_prefix(1);
+        if( theChar == '"' )
+        {
+            return std::string_view{aBuffer.data(), theSize};
+        }
+        if( theChar != '\\' )
+        {
+            if( !theAppend(theChar) )
+            {
+                return std::nullopt;
+            }
+            continue;
+        }
+
+        if( aJson.empty() )
+        {
+            return std::nullopt;
+        }
+        const char theEscape = aJson[0];
+        aJson.remove_prefix(1);
+        if( theEscape == '"' || theEscape == '\\' || theEscape == '/' )
+        {
+            if( !theAppend(theEscape) )
+            {
+                return std::nullopt;
+            }
+            continue;
+        }
+
+        // a code point of the basic multilingual plane, as UTF-8; units
+        // need no surrogate pairs
+        unsigned theCode = 0;
+        if( theEscape != 'u' || aJson.size() < 4 ||
+            std::from_chars(aJson.data(), aJson.data() + 4, theCode, 16).ptr != aJson.data() + 4 ||
+            (theCode >= 0xd800 && theCode < 0xe000) )
+        {
+            return std::nullopt;
+        }
+        aJson.remove_prefix(4);
+        const bool isAppended = theCode < 0x80 ? theAppend(static_cast<char>(theCode)) :
+            theCode < 0x800 ?
+                theAppend(static_cast<char>(0xc0 | theCode >> 6)) &&
+                theAppend(static_cast<char>(0x80 | (theCode & 0x3f))) :
+                theAppend(static_cast<char>(0xe0 | theCode >> 12)) &&
+                theAppend(static_cast<char>(0x80 | (theCode >> 6 & 0x3f))) &&
+                theAppend(static_cast<char>(0x80 | (theCode & 0x3f)));
+        if( !isAppended )
+        {
+            return std::nullopt;
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+/// the interval of the unit symbol aSymbol over that of UnitsT; std::nullopt
+/// if it is not a unit symbol of the quantity of UnitsT. The symbol of UnitsT
+/// itself is recognized by one comparison, other unit names by
+/// find_unit_symbol's hash lookup.
+template< typename UnitsT >
+inline
+std::optional<wire_interval_ratio>
+json_unit_ratio
+(
+    std::string_view aSymbol
+)
+{
+    if( aSymbol == unit_symbol<UnitsT> )
+    {
+        return wire_interval_ratio{1, 1};
+    }
+
+    const auto theUnit = find_unit_symbol(aSymbol);
+    if( !theUnit || theUnit->exponents != quantity_exponents<typename UnitsT::quantity_t>() )
+    {
+        return std::nullopt;
+    }
+    return wire_interval_ratio_to<UnitsT>(theUnit->num, theUnit->den);
+}
+
+//------------------------------------------------------------------------------
+/// the length of the JSON number at the front of aJson: an optional minus,
+/// an integer part with no leading zero, then an optional fraction and
+/// exponent; 0 if aJson does not begin with one. std::from_chars also reads
+/// inf, nan and leading zeros, which JSON does not allow.
+inline
+constexpr
+std::size_t
+json_number_length
+(
+    std::string_view aJson
+)
+{
+    const auto isDigit = [aJson](std::size_t aIndex)
+    {
+        return aIndex < aJson.size() && aJson[aIndex] >= '0' && aJson[aIndex] <= '9';
+    };
+    const auto isChar = [aJson](std::size_t aIndex, char aChar)
+    {
+        return aIndex < aJson.size() && aJson[aIndex] == aChar;
+    };
+
+    std::size_t i = isChar(0, '-') ? 1 : 0;
+    if( !isDigit(i) )
+    {
+        return 0;
+    }
+    if( isChar(i, '0') )
+    {
+        ++i;
+    }
+    else
+    {
+        while( isDigit(i) )
+        {
+            ++i;
+        }
+    }
+
+    if( isChar(i, '.') )
+    {
+        if( !isDigit(++i) )
+        {
+            return 0;
+        }
+        while( isDigit(i) )
+        {
+            ++i;
+        }
+    }
+
+    if( isChar(i, 'e') || isChar(i, 'E') )
+    {
+        ++i;
+        if( isChar(i, '+') || isChar(i, '-') )
+        {
+            ++i;
+        }
+        if( !isDigit(i) )
+        {
+            return 0;
+        }
+        while( isDigit(i) )
+        {
+            ++i;
+        }
+    }
+
+    return i;
+}
+
+//------------------------------------------------------------------------------
+/// read aValue from the JSON number at the front of aJson with
+/// std::from_chars; false if there is none, or it is not a ValueT
+template< typename ValueT >
+inline
+bool
+read_json_number
+(
+    std::string_view& aJson,
+    ValueT& aValue
+)
+{
+    skip_json_space(aJson);
+    const auto theLength = json_number_length(aJson);
+    if( theLength == 0 )
+    {
+        return false;
+    }
+
+    const auto theEnd = aJson.data() + theLength;
+    const auto [thePointer, theError] = std::from_chars(aJson.data(), theEnd, aValue);
+    if( theError != std::errc{} || thePointer != theEnd )
+    {
+        return false;
+    }
+    aJson.remove_prefix(theLength);
+    return true;
+}
+
+//------------------------------------------------------------------------------
+/// read the JSON form of a units_t, in either style, from the front of aJson
+/// as UnitsT. The unit may be any unit symbol of the quantity of UnitsT, as
+/// find_unit_symbol reads it; a value in another interval is converted as
+/// units_cast converts. std::nullopt if the JSON is not valid, has other
+/// members, or has a null value, or the unit is not of the quantity of
+/// UnitsT. aJson is left after the form.
+template< typename UnitsT >
+inline
+std::optional<UnitsT>
+read_json
+(
+    std::string_view& aJson
+)
+{
+    static_assert(std::is_arithmetic<typename UnitsT::value_t>::value, "read_json requires an arithmetic value_t");
+    using Value_t = typename UnitsT::value_t;
+
+    Value_t theValue{};
+    std::optional<wire_interval_ratio> theRatio;
+    std::array<char, 64> theBuffer;
+    skip_json_space(aJson);
+    if( aJson.starts_with('"') )
+    {
+        const auto theString = read_json_string(aJson, theBuffer);
+        if( !theString )
+        {
+            return std::nullopt;
+        }
+        std::string_view theRest = *theString;
+        if( !read_json_number(theRest, theValue) )
+        {
+            return std::nullopt;
+        }
+        skip_json_space(theRest);
+        theRatio = json_unit_ratio<UnitsT>(theRest);
+    }
+    else
+    {
+        if( !skip_json_char(aJson, '{') )
+        {
+            return std::nullopt;
+        }
+        bool hasValue = false;
+        bool hasUnit = false;
+        do
+        {
+            std::array<char, 8> theKeyBuffer;
+            const auto theKey = read_json_string(aJson, theKeyBuffer);
+            if( !theKey || !skip_json_char(aJson, ':') )
+            {
+                return std::nullopt;
+            }
+            if( *theKey == "value" && !hasValue )
+            {
+                hasValue = read_json_number(aJson, theValue);
+                if( !hasValue )
+                {
+                    return std::nullopt;
+                }
+            }
+            else if( *theKey == "unit" && !hasUnit )
+            {
+                const auto theSymbol = read_json_string(aJson, theBuffer);
+                hasUnit = theSymbol.has_value();
+                theRatio = theSymbol ? json_unit_ratio<UnitsT>(*theSymbol) : std::nullopt;
+            }
+            else
+            {
+                return std::nullopt;
+            }
+        }
+        while( skip_json_char(aJson, ',') );
+
+        if( !skip_json_char(aJson, '}') || !hasValue || !hasUnit )
+        {
+            return std::nullopt;
+        }
+    }
+
+    if( !theRatio )
+    {
+        return std::nullopt;
+    }
+    return theRatio->num == 1 && theRatio->den == 1 ? UnitsT{theValue} : from_wire_value<UnitsT>(theValue, *theRatio);
+}
+
+//------------------------------------------------------------------------------
+/// the units_t of the JSON text aJson, in either style, as UnitsT;
+/// std::nullopt if it is not one units_t of the quantity of UnitsT
+template< typename UnitsT >
+inline
+std::optional<UnitsT>
+from_json
+(
+    std::string_view aJson
+)
+{
+    const auto theUnits = read_json<UnitsT>(aJson);
+    skip_json_space(aJson);
+    if( !aJson.empty() )
+    {
+        return std::nullopt;
+    }
+    return theUnits;
+}
+
+//------------------------------------------------------------------------------
+/// the units_t of the JSON array aJson, each in either style, as UnitsT;
+/// std::nullopt if it is not an array of units_t of the quantity of UnitsT
+template< typename UnitsT >
+inline
+std::optional<std::vector<UnitsT>>
+from_json_array
+(
+    std::string_view aJson
+)
+{
+    if( !skip_json_char(aJson, '[') )
+    {
+        return std::nullopt;
+    }
+
+    std::vector<UnitsT> theResult;
+    skip_json_space(aJson);
+    if( !aJson.starts_with(']') )
+    {
+        do
+        {
+            const auto theUnits = read_json<UnitsT>(aJson);
+            if( !theUnits )
+            {
+                return std::nullopt;
+            }
+            theResult.push_back(*theUnits);
+        }
+        while( skip_json_char(aJson, ',') );
+    }
+
+    if( !skip_json_char(aJson, ']') )
+    {
+        return std::nullopt;
+    }
+    skip_json_space(aJson);
+    if( !aJson.empty() )
+    {
+        return std::nullopt;
+    }
+    return theResult;
+}
+
+} // end of namespace si
@@ -0,0 +1,316 @@
+#pragma once
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <span>
+#include <vector>
+
+#include "units.hpp"
+
+namespace si
+{
+
+//------------------------------------------------------------------------------
+/// Interpolation methods supported by lookup_table
+enum class interpolation
+{
+    linear, // piecewise linear
+    cubic   // piecewise cubic Hermite with slopes from neighbouring points
+};
+
+//------------------------------------------------------------------------------
+/// Class lookup_table maps XUnitsT to YUnitsT by interpolating a table of points.
+/// Tables with uniformly spaced x are indexed in O(1); other tables are searched
+/// with a branchless binary search. Arguments outside the table are clamped to
+/// the first or last point.
+template< typename XUnitsT, typename YUnitsT >
+class lookup_table
+{
+    static_assert(is_units_t<XUnitsT> && is_units_t<YUnitsT>, "XUnitsT and YUnitsT must be of type si::units_t");
+    static_assert
+    (
+        std::is_floating_point<typename XUnitsT::value_t>::value &&
+        std::is_floating_point<typename YUnitsT::value_t>::value,
+        "XUnitsT and YUnitsT must have a floating point value_t"
+    );
+
+public:
+
+    //--------------------------------------------------------------------------
+    /// Type aliases
+    using x_t = XUnitsT;
+    using y_t = YUnitsT;
+
+    //--------------------------------------------------------------------------
+    /// Initialize a table with arbitrarily spaced points.
+    /// @param aX strictly increasing x values, at least two
+    /// @param aY the y value at each x value
+    lookup_table
+    (
+        std::span<const x_t> aX,
+        std::span<const y_t> aY,
+        interpolation aInterpolation = interpolation::linear
+    )
+    : mInterpolation{aInterpolation}
+    , mX(aX.size())
+    , mY(aY.size())
+    {
+        assert(aX.size() == aY.size());
+        assert(aX.size() >= 2);
+        for( std::size_t i = 0; i < aX.size(); ++i )
+        {
+            mX[i] = aX[i].value();
+            mY[i] = aY[i].value();
+        }
+        initialize();
+    }
+
+    //--------------------------------------------------------------------------
+    /// Initialize a table with uniformly spaced points.
+    /// @param aFirst the x value of aY[0]
+    /// @param aStep the positive distance between consecutive x values
+    /// @param aY the y values, at least two
+    lookup_table
+    (
+        x_t aFirst,
+        x_t aStep,
+        std::span<const y_t> aY,
+        interpolation aInterpolation = interpolation::linear
+    )
+    : mInterpolation{aInterpolation}
+    , mX(aY.size())
+    , mY(aY.size())
+    , mUniform{true}
+    , mFirst{aFirst.value()}
+    , mInverseStep{1 / aStep.value()}
+    {
+        assert(aY.size() >= 2);
+        assert(aStep > x_t::zero());
+        for( std::size_t i = 0; i < aY.size(); ++i )
+        {
+            mX[i] = aFirst.value() + static_cast<x_value_t>(i) * aStep.value();
+            mY[i] = aY[i].value();
+        }
+        initialize();
+    }
+
+    //--------------------------------------------------------------------------
+    /// Look up one value.
+    y_t
+    operator()
+    (
+        x_t aX
+    ) const
+    {
+        const auto theX = aX.value();
+        return y_t{mInterpolation == interpolation::linear ? linear(theX, index(theX)) : cubic(theX, index(theX))};
+    }
+
+    //--------------------------------------------------------------------------
+    /// Look up one value given in other units of the same quantity.
+    /// The conversion factor is computed at compile time by units_cast.
+    template< typename ValueT, typename IntervalT >
+    y_t
+    operator()
+    (
+        units_t<ValueT, IntervalT, typename x_t::quantity_t> aX
+    ) const
+    {
+        return (*this)(units_cast<x_t>(aX));
+    }
+
+    //--------------------------------------------------------------------------
+    /// Look up a block of values.
+    void
+    operator()
+    (
+        std::span<const x_t> aX,
+        std::span<y_t> aY
+    ) const
+    {
+        evaluate(aX, aY);
+    }
+
+    //--------------------------------------------------------------------------
+    /// Look up a block of values given in other units of the same quantity.
+    template< typename ValueT, typename IntervalT >
+    void
+    operator()
+    (
+        std::span<const units_t<ValueT, IntervalT, typename x_t::quantity_t>> aX,
+        std::span<y_t> aY
+    ) const
+    {
+        evaluate(aX, aY);
+    }
+
+    //--------------------------------------------------------------------------
+    // Accessor functions
+    std::size_t size() const {return mX.size();}
+    x_t front() const {return x_t{mX.front()};}
+    x_t back() const {return x_t{mX.back()};}
+    interpolation method() const {return mInterpolation;}
+
+private:
+
+    using x_value_t = typename x_t::value_t;
+    using y_value_t = typename y_t::value_t;
+
+    //--------------------------------------------------------------------------
+    // The method and grid tests are hoisted out of the loop so that each
+    // loop body is straight-line code.
+    template< typename ValueT, typename IntervalT >
+    void
+    evaluate
+    (
+        std::span<const units_t<ValueT, IntervalT, typename x_t::quantity_t>> aX,
+        std::span<y_t> aY
+    ) const
+    {
+        assert(aY.size() >= aX.size());
+        if( mInterpolation == interpolation::linear )
+        {
+            if( mUniform )
+            {
+                evaluate_with(aX, aY, [this](x_value_t x){return linear(x, uniform_index(x));});
+            }
+            else
+            {
+                evaluate_with(aX, aY, [this](x_value_t x){return linear(x, search_index(x));});
+            }
+        }
+        else
+        {
+            if( mUniform )
+            {
+                evaluate_with(aX, aY, [this](x_value_t x){return cubic(x, uniform_index(x));});
+            }
+            else
+            {
+                evaluate_with(aX, aY, [this](x_value_t x){return cubic(x, search_index(x));});
+            }
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // Compute the slopes used by cubic interpolation.
+    void
+    initialize
+    (
+    )
+    {
+        const auto theCount = mX.size();
+        mSlopes.resize(theCount);
+        mSlopes[0] = (mY[1] - mY[0]) / (mX[1] - mX[0]);
+        for( std::size_t i = 1; i + 1 < theCount; ++i )
+        {
+            const auto hs = mX[i] - mX[i - 1];
+            const auto hd = mX[i + 1] - mX[i];
+            mSlopes[i] = (hs * hs * mY[i + 1] + (hd * hd - hs * hs) * mY[i] - hd * hd * mY[i - 1]) / (hs * hd * (hd + hs));
+        }
+        mSlopes[theCount - 1] = (mY[theCount - 1] - mY[theCount - 2]) / (mX[theCount - 1] - mX[theCount - 2]);
+    }
+
+    //--------------------------------------------------------------------------
+    // the index of the interval containing aX, clamped to [0, size() - 2]
+    std::size_t
+    index
+    (
+        x_value_t aX
+    ) const
+    {
+        return mUniform ? uniform_index(aX) : search_index(aX);
+    }
+
+    std::size_t
+    uniform_index
+    (
+        x_value_t aX
+    ) const
+    {
+        const auto theLast = static_cast<x_value_t>(mX.size() - 2);
+        const auto thePosition = (aX - mFirst) * mInverseStep;
+        return static_cast<std::size_t>(std::min(std::max(thePosition, x_value_t{}), theLast));
+    }
+
+    std::size_t
+    search_index
+    (
+        x_value_t aX
+    ) const
+    {
+        // the conditional select compiles to a conditional move, there is no
+        // data-dependent branch for the predictor to miss
+        const x_value_t* theBase = mX.data();
+        std::size_t theCount = mX.size() - 1;
+        while( theCount > 1 )
+        {
+            const auto theHalf = theCount / 2;
+            theBase = (theBase[theHalf] <= aX) ? theBase + theHalf : theBase;
+            theCount -= theHalf;
+        }
+        return static_cast<std::size_t>(theBase - mX.data());
+    }
+
+    y_value_t
+    linear
+    (
+        x_value_t aX,
+        std::size_t aIndex
+    ) const
+    {
+        const auto x0 = mX[aIndex];
+        const auto x1 = mX[aIndex + 1];
+        const auto t = std::min(std::max((aX - x0) / (x1 - x0), x_value_t{}), x_value_t{1});
+        return mY[aIndex] + static_cast<y_value_t>(t) * (mY[aIndex + 1] - mY[aIndex]);
+    }
+
+    y_value_t
+    cubic
+    (
+        x_value_t aX,
+        std::size_t aIndex
+    ) const
+    {
+        const auto x0 = mX[aIndex];
+        const auto h = mX[aIndex + 1] - x0;
+        const auto t = static_cast<y_value_t>(std::min(std::max((aX - x0) / h, x_value_t{}), x_value_t{1}));
+        const auto t2 = t * t;
+        const auto t3 = t2 * t;
+        const auto h00 = 2 * t3 - 3 * t2 + 1;
+        const auto h10 = t3 - 2 * t2 + t;
+        const auto h01 = -2 * t3 + 3 * t2;
+        const auto h11 = t3 - t2;
+        return
+            h00 * mY[aIndex] +
+            h10 * static_cast<y_value_t>(h) * mSlopes[aIndex] +
+            h01 * mY[aIndex + 1] +
+            h11 * static_cast<y_value_t>(h) * mSlopes[aIndex + 1];
+    }
+
+    template< typename ValueT, typename IntervalT, typename FunctionT >
+    void
+    evaluate_with
+    (
+        std::span<const units_t<ValueT, IntervalT, typename x_t::quantity_t>> aX,
+        std::span<y_t> aY,
+        FunctionT aFunction
+    ) const
+    {
+        for( std::size_t i = 0; i < aX.size(); ++i )
+        {
+            aY[i] = y_t{aFunction(units_cast<x_t>(aX[i]).value())};
+        }
+    }
+
+    interpolation mInterpolation;
+    std::vector<x_value_t> mX;
+    std::vector<y_value_t> mY;
+    std::vector<y_value_t> mSlopes;
+    bool mUniform = false;
+    x_value_t mFirst{};
+    x_value_t mInverseStep{};
+
+}; // end of class lookup_table
+
+} // end of namespace si
@@ -0,0 +1,628 @@
+#pragma once
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <optional>
+#include <span>
+#include <tuple>
+#include <utility>
+
+#include "units.hpp"
+
+namespace si
+{
+
+//------------------------------------------------------------------------------
+/// the number of rows and columns in a block of the cache-blocked kernels
+constexpr std::size_t matrix_block_size = 32;
+
+//------------------------------------------------------------------------------
+/// A compile-time list of units_t types, one per row or column of a matrix.
+template< typename... UnitsT >
+struct units_list
+{
+    static_assert((is_units_t<UnitsT> && ...), "UnitsT must be of type si::units_t");
+    static constexpr std::size_t size = sizeof...(UnitsT);
+};
+
+template< std::size_t Index, typename ListT >
+struct units_list_element_impl;
+
+template< std::size_t Index, typename... UnitsT >
+struct units_list_element_impl<Index, units_list<UnitsT...>>
+{
+    using type = std::tuple_element_t<Index, std::tuple<UnitsT...>>;
+};
+
+//------------------------------------------------------------------------------
+/// the units_t at Index in ListT
+template< std::size_t Index, typename ListT >
+using units_list_element = typename units_list_element_impl<Index, ListT>::type;
+
+template< typename ListT >
+struct reciprocal_units_list_impl;
+
+template< typename... UnitsT >
+struct reciprocal_units_list_impl<units_list<UnitsT...>>
+{
+    using type = units_list<reciprocal_units<UnitsT>...>;
+};
+
+//------------------------------------------------------------------------------
+/// the list of the reciprocals of each units_t in ListT
+template< typename ListT >
+using reciprocal_units_list = typename reciprocal_units_list_impl<ListT>::type;
+
+template< typename ListT, typename FactorT >
+struct multiply_units_list_impl;
+
+template< typename... UnitsT, typename FactorT >
+struct multiply_units_list_impl<units_list<UnitsT...>, FactorT>
+{
+    using type = units_list<multiply_units<UnitsT, FactorT>...>;
+};
+
+//------------------------------------------------------------------------------
+/// the list of each units_t in ListT multiplied by FactorT
+template< typename ListT, typename FactorT >
+using multiply_units_list = typename multiply_units_list_impl<ListT, FactorT>::type;
+
+template< typename UnitsT, typename IndicesT >
+struct repeat_units_impl;
+
+template< typename UnitsT, std::size_t... Indices >
+struct repeat_units_impl<UnitsT, std::index_sequence<Indices...>>
+{
+    template< std::size_t >
+    using units_of = UnitsT;
+
+    using type = units_list<units_of<Indices>...>;
+};
+
+//------------------------------------------------------------------------------
+/// a list of Count copies of UnitsT
+template< typename UnitsT, std::size_t Count >
+using repeat_units = typename repeat_units_impl<UnitsT, std::make_index_sequence<Count>>::type;
+
+//------------------------------------------------------------------------------
+// the value of the ratio between the intervals of two units_t
+template< typename ValueT, typename FromUnitsT, typename ToUnitsT >
+constexpr ValueT interval_scale_v = static_cast<ValueT>
+(
+    static_cast<long double>(std::ratio_divide<typename FromUnitsT::interval_t, typename ToUnitsT::interval_t>::num) /
+    static_cast<long double>(std::ratio_divide<typename FromUnitsT::interval_t, typename ToUnitsT::interval_t>::den)
+);
+
+template< typename RowUnitsT, typename ColumnUnitsT >
+class matrix;
+
+template< typename FromT, typename ToT, typename = std::make_index_sequence<FromT::row_count * FromT::column_count> >
+struct same_element_quantities;
+
+template< typename FromT, typename ToT, typename = std::make_index_sequence<FromT::row_count * FromT::column_count> >
+struct element_scales;
+
+//------------------------------------------------------------------------------
+/// Class matrix is a matrix whose element at row i and column j has the units
+/// of RowUnitsT[i] × ColumnUnitsT[j], e.g. a covariance matrix of a state
+/// of units u has both RowUnitsT and ColumnUnitsT equal to u, and element
+/// units u[i]·u[j]. Elements are stored row-major as a contiguous array of
+/// value_t, each in the units of its element type, so a matrix is exactly
+/// the size of the array and every dimension check is made at compile time.
+template< typename... RowUnitsT, typename... ColumnUnitsT >
+class matrix<units_list<RowUnitsT...>, units_list<ColumnUnitsT...>>
+{
+    static_assert(sizeof...(RowUnitsT) > 0 && sizeof...(ColumnUnitsT) > 0, "a matrix must have at least one row and one column");
+
+public:
+
+    //--------------------------------------------------------------------------
+    /// Type aliases
+    using rows_t = units_list<RowUnitsT...>;
+    using columns_t = units_list<ColumnUnitsT...>;
+    using value_t = std::common_type_t<typename RowUnitsT::value_t..., typename ColumnUnitsT::value_t...>;
+
+    /// the units_t of the element at row Row and column Column
+    template< std::size_t Row, std::size_t Column >
+    using element_t = units_t
+    <
+        value_t,
+        typename multiply_units<units_list_element<Row, rows_t>, units_list_element<Column, columns_t>>::interval_t,
+        typename multiply_units<units_list_element<Row, rows_t>, units_list_element<Column, columns_t>>::quantity_t
+    >;
+
+    //--------------------------------------------------------------------------
+    /// Static member constants
+    static constexpr std::size_t row_count = sizeof...(RowUnitsT);
+    static constexpr std::size_t column_count = sizeof...(ColumnUnitsT);
+
+    //--------------------------------------------------------------------------
+    /// Initialize a matrix of zeros.
+    constexpr
+    matrix
+    (
+    ) = default;
+
+    //--------------------------------------------------------------------------
+    /// Initialize a matrix from another matrix whose elements have the same
+    /// quantities. Elements of a different interval are converted by a factor
+    /// computed at compile time.
+    template
+    <
+        typename RowUnitsT2,
+        typename ColumnUnitsT2,
+        typename = std::enable_if_t<!std::is_same<matrix<RowUnitsT2, ColumnUnitsT2>, matrix>::value>,
+        typename = std::enable_if_t<matrix<RowUnitsT2, ColumnUnitsT2>::row_count == row_count>,
+        typename = std::enable_if_t<matrix<RowUnitsT2, ColumnUnitsT2>::column_count == column_count>,
+        typename = std::enable_if_t<same_element_quantities<matrix<RowUnitsT2, ColumnUnitsT2>, matrix>::value>
+    >
+    constexpr
+    matrix
+    (
+        const matrix<RowUnitsT2, ColumnUnitsT2>& aMatrix
+    )
+    {
+        constexpr auto theScales = element_scales<matrix<RowUnitsT2, ColumnUnitsT2>, matrix>::value;
+        for( std::size_t i = 0; i < size; ++i )
+        {
+            mValues[i] = static_cast<value_t>(aMatrix.data()[i]) * theScales[i];
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // Special values
+    static constexpr matrix zero() {return matrix{};}
+
+    //--------------------------------------------------------------------------
+    /// the element at row Row and column Column
+    template< std::size_t Row, std::size_t Column >
+    constexpr
+    element_t<Row, Column>
+    get
+    (
+    ) const
+    {
+        static_assert(Row < row_count && Column < column_count, "element index out of range");
+        return element_t<Row, Column>{mValues[Row * column_count + Column]};
+    }
+
+    //--------------------------------------------------------------------------
+    /// Set the element at row Row and column Column.
+    /// aElement may be of any units_t convertible to element_t<Row, Column>.
+    template< std::size_t Row, std::size_t Column >
+    constexpr
+    void
+    set
+    (
+        element_t<Row, Column> aElement
+    )
+    {
+        static_assert(Row < row_count && Column < column_count, "element index out of range");
+        mValues[Row * column_count + Column] = aElement.value();
+    }
+
+    //--------------------------------------------------------------------------
+    // Accessor functions for the raw values, each in the units of its element
+    constexpr value_t value(std::size_t aRow, std::size_t aColumn) const {return mValues[aRow * column_count + aColumn];}
+    constexpr value_t& value(std::size_t aRow, std::size_t aColumn) {return mValues[aRow * column_count + aColumn];}
+    constexpr std::span<const value_t> data() const {return mValues;}
+    constexpr std::span<value_t> data() {return mValues;}
+
+    //--------------------------------------------------------------------------
+    // Arithmetic functions
+    constexpr matrix& operator+=(const matrix& rhs) {for( std::size_t i = 0; i < size; ++i ) mValues[i] += rhs.mValues[i]; return *this;}
+    constexpr matrix& operator-=(const matrix& rhs) {for( std::size_t i = 0; i < size; ++i ) mValues[i] -= rhs.mValues[i]; return *this;}
+
+private:
+
+    static constexpr std::size_t size = row_count * column_count;
+
+    std::array<value_t, size> mValues{};
+
+}; // end of class matrix
+
+//------------------------------------------------------------------------------
+// true if every element of FromT has the quantity of the element of ToT
+template< typename FromT, typename ToT, std::size_t... Indices >
+struct same_element_quantities<FromT, ToT, std::index_sequence<Indices...>>
+{
+    static constexpr std::size_t columns = FromT::column_count;
+    static constexpr bool value =
+    (
+        std::is_same
+        <
+            typename FromT::template element_t<Indices / columns, Indices % columns>::quantity_t,
+            typename ToT::template element_t<Indices / columns, Indices % columns>::quantity_t
+        >::value && ...
+    );
+};
+
+//------------------------------------------------------------------------------
+// the factors converting each raw value of FromT to the interval of the
+// corresponding element of ToT
+template< typename FromT, typename ToT, std::size_t... Indices >
+struct element_scales<FromT, ToT, std::index_sequence<Indices...>>
+{
+    static constexpr std::size_t columns = FromT::column_count;
+    static constexpr std::array<typename ToT::value_t, sizeof...(Indices)> value
+    {
+        interval_scale_v
+        <
+            typename ToT::value_t,
+            typename FromT::template element_t<Indices / columns, Indices % columns>,
+            typename ToT::template element_t<Indices / columns, Indices % columns>
+        >...
+    };
+};
+
+//------------------------------------------------------------------------------
+/// a matrix of one column holding a state of mixed units, e.g.
+/// column_vector<meters<>, divide_units<meters<>, seconds<>>>
+template< typename... UnitsT >
+using column_vector = matrix
+<
+    units_list<UnitsT...>,
+    units_list<scalar<r_one, std::common_type_t<typename UnitsT::value_t...>>>
+>;
+
+//------------------------------------------------------------------------------
+// matrix == matrix
+template< typename RowUnitsT, typename ColumnUnitsT >
+inline
+constexpr
+bool
+operator ==
+(
+    const matrix<RowUnitsT, ColumnUnitsT>& aLHS,
+    const matrix<RowUnitsT, ColumnUnitsT>& aRHS
+)
+{
+    return std::equal(aLHS.data().begin(), aLHS.data().end(), aRHS.data().begin());
+}
+
+//------------------------------------------------------------------------------
+// matrix != matrix
+template< typename RowUnitsT, typename ColumnUnitsT >
+inline
+constexpr
+bool
+operator !=
+(
+    const matrix<RowUnitsT, ColumnUnitsT>& aLHS,
+    const matrix<RowUnitsT, ColumnUnitsT>& aRHS
+)
+{
+    return !(aLHS == aRHS);
+}
+
+//------------------------------------------------------------------------------
+// matrix + matrix, the result has the units of aLHS
+template
+<
+    typename RowUnitsT1,
+    typename ColumnUnitsT1,
+    typename RowUnitsT2,
+    typename ColumnUnitsT2,
+    typename = std::enable_if_t<std::is_constructible<matrix<RowUnitsT1, ColumnUnitsT1>, matrix<RowUnitsT2, ColumnUnitsT2>>::value>
+>
+inline
+constexpr
+matrix<RowUnitsT1, ColumnUnitsT1>
+operator +
+(
+    const matrix<RowUnitsT1, ColumnUnitsT1>& aLHS,
+    const matrix<RowUnitsT2, ColumnUnitsT2>& aRHS
+)
+{
+    auto theResult = aLHS;
+    theResult += matrix<RowUnitsT1, ColumnUnitsT1>{aRHS};
+    return theResult;
+}
+
+//------------------------------------------------------------------------------
+// matrix - matrix, the result has the units of aLHS
+template
+<
+    typename RowUnitsT1,
+    typename ColumnUnitsT1,
+    typename RowUnitsT2,
+    typename ColumnUnitsT2,
+    typename = std::enable_if_t<std::is_constructible<matrix<RowUnitsT1, ColumnUnitsT1>, matrix<RowUnitsT2, ColumnUnitsT2>>::value>
+>
+inline
+constexpr
+matrix<RowUnitsT1, ColumnUnitsT1>
+operator -
+(
+    const matrix<RowUnitsT1, ColumnUnitsT1>& aLHS,
+    const matrix<RowUnitsT2, ColumnUnitsT2>& aRHS
+)
+{
+    auto theResult = aLHS;
+    theResult -= matrix<RowUnitsT1, ColumnUnitsT1>{aRHS};
+    return theResult;
+}
+
+//------------------------------------------------------------------------------
+/// matrix product. The products of the columns of aLHS and the rows of aRHS
+/// must all have the same quantity, which is folded into the rows of the
+/// result. Inner products of different intervals are converted by factors
+/// computed at compile time.
+template< typename RowUnitsT, typename... InnerUnitsT1, typename... InnerUnitsT2, typename ColumnUnitsT >
+inline
+constexpr
+auto
+operator *
+(
+    const matrix<RowUnitsT, units_list<InnerUnitsT1...>>& aLHS,
+    const matrix<units_list<InnerUnitsT2...>, ColumnUnitsT>& aRHS
+)
+{
+    static_assert(sizeof...(InnerUnitsT1) == sizeof...(InnerUnitsT2), "the columns of aLHS must match the rows of aRHS");
+
+    using Inner_t = multiply_units<units_list_element<0, units_list<InnerUnitsT1...>>, units_list_element<0, units_list<InnerUnitsT2...>>>;
+    static_assert
+    (
+        (std::is_same<typename multiply_units<InnerUnitsT1, InnerUnitsT2>::quantity_t, typename Inner_t::quantity_t>::value && ...),
+        "the products of the columns of aLHS and the rows of aRHS must all have the same quantity"
+    );
+
+    using Result_t = matrix<multiply_units_list<RowUnitsT, Inner_t>, ColumnUnitsT>;
+    using Value_t = typename Result_t::value_t;
+    constexpr std::size_t theRows = Result_t::row_count;
+    constexpr std::size_t theColumns = Result_t::column_count;
+    constexpr std::size_t theInner = sizeof...(InnerUnitsT1);
+    constexpr std::array<Value_t, theInner> theScales{interval_scale_v<Value_t, multiply_units<InnerUnitsT1, InnerUnitsT2>, Inner_t>...};
+
+    // i-k-j order, so that the innermost loop runs along contiguous rows of
+    // aRHS and the result and vectorizes; the i and k loops are blocked so
+    // that a block of aRHS stays in cache while the rows of aLHS pass over it
+    Result_t theResult;
+    const auto a = aLHS.data();
+    const auto b = aRHS.data();
+    const auto c = theResult.data();
+    for( std::size_t i0 = 0; i0 < theRows; i0 += matrix_block_size )
+    {
+        const auto i1 = std::min(i0 + matrix_block_size, theRows);
+        for( std::size_t k0 = 0; k0 < theInner; k0 += matrix_block_size )
+        {
+            const auto k1 = std::min(k0 + matrix_block_size, theInner);
+            for( std::size_t i = i0; i < i1; ++i )
+            {
+                for( std::size_t k = k0; k < k1; ++k )
+                {
+                    const auto theFactor = static_cast<Value_t>(a[i * theInner + k]) * theScales[k];
+                    for( std::size_t j = 0; j < theColumns; ++j )
+                    {
+                        c[i * theColumns + j] += theFactor * static_cast<Value_t>(b[k * theColumns + j]);
+                    }
+                }
+            }
+        }
+    }
+    return theResult;
+}
+
+//------------------------------------------------------------------------------
+/// matrix transpose
+template< typename RowUnitsT, typename ColumnUnitsT >
+inline
+constexpr
+matrix<ColumnUnitsT, RowUnitsT>
+transpose
+(
+    const matrix<RowUnitsT, ColumnUnitsT>& aMatrix
+)
+{
+    constexpr std::size_t theRows = RowUnitsT::size;
+    constexpr std::size_t theColumns = ColumnUnitsT::size;
+
+    // copy block by block so that both the reads and the writes of a block
+    // stay within a few cache lines
+    matrix<ColumnUnitsT, RowUnitsT> theResult;
+    const auto a = aMatrix.data();
+    const auto t = theResult.data();
+    for( std::size_t i0 = 0; i0 < theRows; i0 += matrix_block_size )
+    {
+        const auto i1 = std::min(i0 + matrix_block_size, theRows);
+        for( std::size_t j0 = 0; j0 < theColumns; j0 += matrix_block_size )
+        {
+            const auto j1 = std::min(j0 + matrix_block_size, theColumns);
+            for( std::size_t i = i0; i < i1; ++i )
+            {
+                for( std::size_t j = j0; j < j1; ++j )
+                {
+                    t[j * theRows + i] = a[i * theColumns + j];
+                }
+            }
+        }
+    }
+    return theResult;
+}
+
+//------------------------------------------------------------------------------
+/// Cholesky factor L of a symmetric positive definite matrix P, such that
+/// P = L·transpose(L). Row i of L has the units of UnitsT[i], its columns are
+/// scalars. Returns std::nullopt if P is not positive definite.
+template< typename... UnitsT >
+inline
+std::optional<matrix<units_list<UnitsT...>, repeat_units<scalar<r_one, typename matrix<units_list<UnitsT...>, units_list<UnitsT...>>::value_t>, sizeof...(UnitsT)>>>
+cholesky
+(
+    const matrix<units_list<UnitsT...>, units_list<UnitsT...>>& aMatrix
+)
+{
+    using Value_t = typename matrix<units_list<UnitsT...>, units_list<UnitsT...>>::value_t;
+    static_assert(std::is_floating_point<Value_t>::value, "cholesky requires a floating point value_t");
+
+    constexpr std::size_t n = sizeof...(UnitsT);
+    matrix<units_list<UnitsT...>, repeat_units<scalar<r_one, Value_t>, n>> theResult;
+    const auto p = aMatrix.data();
+    const auto l = theResult.data();
+
+    // Cholesky–Banachiewicz, row by row; the inner products run along
+    // contiguous prefixes of two rows of L and vectorize
+    for( std::size_t i = 0; i < n; ++i )
+    {
+        for( std::size_t j = 0; j <= i; ++j )
+        {
+            Value_t theSum{};
+            for( std::size_t k = 0; k < j; ++k )
+            {
+                theSum += l[i * n + k] * l[j * n + k];
+            }
+
+            const auto theValue = p[i * n + j] - theSum;
+            if( i == j )
+            {
+                if( !(theValue > Value_t{}) )
+                {
+                    return std::nullopt;
+                }
+                l[i * n + i] = std::sqrt(theValue);
+            }
+            else
+            {
+                l[i * n + j] = theValue / l[j * n + j];
+            }
+        }
+    }
+    return theResult;
+}
+
+//------------------------------------------------------------------------------
+/// matrix inverse by Gauss-Jordan elimination with partial pivoting.
+/// Element (i, j) of the inverse has the units 1 / (ColumnUnitsT[i] × RowUnitsT[j]).
+/// Returns std::nullopt if aMatrix is singular.
+template< typename... RowUnitsT, typename... ColumnUnitsT >
+inline
+std::optional<matrix<reciprocal_units_list<units_list<ColumnUnitsT...>>, reciprocal_units_list<units_list<RowUnitsT...>>>>
+inverse
+(
+    const matrix<units_list<RowUnitsT...>, units_list<ColumnUnitsT...>>& aMatrix
+)
+{
+    static_assert(sizeof...(RowUnitsT) == sizeof...(ColumnUnitsT), "only a square matrix has an inverse");
+
+    using Result_t = matrix<reciprocal_units_list<units_list<ColumnUnitsT...>>, reciprocal_units_list<units_list<RowUnitsT...>>>;
+    using Value_t = typename Result_t::value_t;
+    static_assert(std::is_floating_point<Value_t>::value, "inverse requires a floating point value_t");
+
+    // the raw values of the inverse are the inverse of the raw values, the
+    // units only relabel the rows and columns
+    constexpr std::size_t n = sizeof...(RowUnitsT);
+    std::array<Value_t, n * n> a;
+    std::copy(aMatrix.data().begin(), aMatrix.data().end(), a.begin());
+
+    Result_t theResult;
+    const auto r = theResult.data();
+    for( std::size_t i = 0; i < n; ++i )
+    {
+        r[i * n + i] = Value_t{1};
+    }
+
+    for( std::size_t c = 0; c < n; ++c )
+    {
+        std::size_t thePivot = c;
+        for( std::size_t i = c + 1; i < n; ++i )
+        {
+            if( std::abs(a[i * n + c]) > std::abs(a[thePivot * n + c]) )
+            {
+                thePivot = i;
+            }
+        }
+
+        if( a[thePivot * n + c] == Value_t{} )
+        {
+            return std::nullopt;
+        }
+
+        if( thePivot != c )
+        {
+            std::swap_ranges(&a[c * n], &a[c * n] + n, &a[thePivot * n]);
+            std::swap_ranges(&r[c * n], &r[c * n] + n, &r[thePivot * n]);
+        }
+
+        const auto theReciprocal = Value_t{1} / a[c * n + c];
+        for( std::size_t j = 0; j < n; ++j )
+        {
+            a[c * n + j] *= theReciprocal;
+            r[c * n + j] *= theReciprocal;
+        }
+
+        for( std::size_t i = 0; i < n; ++i )
+        {
+            const auto theFactor = a[i * n + c];
+            if( i == c || theFactor == Value_t{} )
+            {
+                continue;
+            }
+            for( std::size_t j = 0; j < n; ++j )
+            {
+                a[i * n + j] -= theFactor * a[c * n + j];
+                r[i * n + j] -= theFactor * r[c * n + j];
+            }
+        }
+    }
+    return theResult;
+}
+
+//------------------------------------------------------------------------------
+/// Kalman filter prediction step:
+///     x = F·x
+///     P = F·P·transpose(F) + Q
+/// Every product and sum is dimension checked at compile time; a transition
+/// or noise matrix of the wrong units does not compile.
+template< typename StateT, typename CovarianceT, typename TransitionT, typename ProcessNoiseT >
+inline
+void
+kalman_predict
+(
+    StateT& aState,
+    CovarianceT& aCovariance,
+    const TransitionT& aTransition,
+    const ProcessNoiseT& aProcessNoise
+)
+{
+    aState = StateT{aTransition * aState};
+    aCovariance = CovarianceT{aTransition * aCovariance * transpose(aTransition) + aProcessNoise};
+}
+
+//------------------------------------------------------------------------------
+/// Kalman filter update step for a measurement z with observation matrix H
+/// and measurement noise R:
+///     y = z - H·x
+///     S = H·P·transpose(H) + R
+///     K = P·transpose(H)·inverse(S)
+///     x = x + K·y
+///     P = P - K·H·P
+/// Returns false, leaving x and P unchanged, if S is singular.
+template< typename StateT, typename CovarianceT, typename MeasurementT, typename ObservationT, typename MeasurementNoiseT >
+inline
+bool
+kalman_update
+(
+    StateT& aState,
+    CovarianceT& aCovariance,
+    const MeasurementT& aMeasurement,
+    const ObservationT& aObservation,
+    const MeasurementNoiseT& aMeasurementNoise
+)
+{
+    const auto theInnovation = aMeasurement - aObservation * aState;
+    const auto theCrossCovariance = aCovariance * transpose(aObservation);
+    const auto theInnovationCovariance = aObservation * theCrossCovariance + aMeasurementNoise;
+    const auto theInverse = inverse(theInnovationCovariance);
+    if( !theInverse )
+    {
+        return false;
+    }
+
+    const auto theGain = theCrossCovariance * *theInverse;
+    aState = aState + theGain * theInnovation;
+    aCovariance = aCovariance - theGain * (aObservation * aCovariance);
+    return true;
+}
+
+} // end of namespace si
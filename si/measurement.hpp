@@ -0,0 +1,569 @@
+#pragma once
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+#include "units.hpp"
+
+namespace si
+{
+
+//------------------------------------------------------------------------------
+/// Class measurement is a value with a standard uncertainty, for use as the
+/// value_t of a units_t, e.g. meters<r_one, measurement<double>>.
+/// Arithmetic and the math functions propagate the uncertainty to first
+/// order, treating the operands as uncorrelated.
+template< typename ValueT >
+class measurement
+{
+    static_assert(std::is_floating_point<ValueT>::value, "ValueT must be a floating point type");
+
+public:
+
+    //--------------------------------------------------------------------------
+    /// Type aliases
+    using value_type = ValueT;
+
+    //--------------------------------------------------------------------------
+    constexpr
+    measurement
+    (
+    ) = default;
+
+    //--------------------------------------------------------------------------
+    /// Initialize a measurement. An exact value converts implicitly.
+    /// @param aValue the measured value
+    /// @param aUncertainty the standard uncertainty, one standard deviation
+    template< typename ValueT2, typename = std::enable_if_t<std::is_arithmetic<ValueT2>::value> >
+    constexpr
+    measurement
+    (
+        ValueT2 aValue,
+        ValueT aUncertainty = ValueT{}
+    )
+    : mValue{static_cast<ValueT>(aValue)}
+    , mUncertainty{aUncertainty}
+    {
+    }
+
+    //--------------------------------------------------------------------------
+    /// Initialize a measurement from one of another value_type.
+    template< typename ValueT2 >
+    constexpr
+    measurement
+    (
+        measurement<ValueT2> aMeasurement
+    )
+    : mValue{static_cast<ValueT>(aMeasurement.value())}
+    , mUncertainty{static_cast<ValueT>(aMeasurement.uncertainty())}
+    {
+    }
+
+    //--------------------------------------------------------------------------
+    // Accessor functions
+    constexpr value_type value() const {return mValue;}
+    constexpr value_type uncertainty() const {return mUncertainty;}
+    constexpr value_type relative_uncertainty() const {return mUncertainty / (mValue < 0 ? -mValue : mValue);}
+
+    //--------------------------------------------------------------------------
+    // Arithmetic functions
+    constexpr measurement operator+() const {return *this;}
+    constexpr measurement operator-() const {return measurement{-mValue, mUncertainty};}
+    constexpr measurement& operator+=(measurement rhs) {return *this = *this + rhs;}
+    constexpr measurement& operator-=(measurement rhs) {return *this = *this - rhs;}
+    constexpr measurement& operator*=(measurement rhs) {return *this = *this * rhs;}
+    constexpr measurement& operator/=(measurement rhs) {return *this = *this / rhs;}
+
+    //--------------------------------------------------------------------------
+    // sqrt(x² + y²); constant when either is zero, as for exact operands
+    static
+    constexpr
+    ValueT
+    quadrature
+    (
+        ValueT aX,
+        ValueT aY
+    )
+    {
+        if( aX == ValueT{} || aY == ValueT{} )
+        {
+            const auto theSum = aX + aY;
+            return theSum < 0 ? -theSum : theSum;
+        }
+        return std::hypot(aX, aY);
+    }
+
+    //--------------------------------------------------------------------------
+    // a ± b
+    friend
+    constexpr
+    measurement
+    operator +
+    (
+        measurement aLHS,
+        measurement aRHS
+    )
+    {
+        return measurement{aLHS.mValue + aRHS.mValue, quadrature(aLHS.mUncertainty, aRHS.mUncertainty)};
+    }
+
+    friend
+    constexpr
+    measurement
+    operator -
+    (
+        measurement aLHS,
+        measurement aRHS
+    )
+    {
+        return measurement{aLHS.mValue - aRHS.mValue, quadrature(aLHS.mUncertainty, aRHS.mUncertainty)};
+    }
+
+    //--------------------------------------------------------------------------
+    // a·b: σ² = (b·σa)² + (a·σb)²
+    friend
+    constexpr
+    measurement
+    operator *
+    (
+        measurement aLHS,
+        measurement aRHS
+    )
+    {
+        return measurement
+        {
+            aLHS.mValue * aRHS.mValue,
+            quadrature(aRHS.mValue * aLHS.mUncertainty, aLHS.mValue * aRHS.mUncertainty)
+        };
+    }
+
+    //--------------------------------------------------------------------------
+    // a/b: σ² = (σa/b)² + (a·σb/b²)²
+    friend
+    constexpr
+    measurement
+    operator /
+    (
+        measurement aLHS,
+        measurement aRHS
+    )
+    {
+        const auto theQuotient = aLHS.mValue / aRHS.mValue;
+        return measurement
+        {
+            theQuotient,
+            quadrature(aLHS.mUncertainty, theQuotient * aRHS.mUncertainty) / (aRHS.mValue < 0 ? -aRHS.mValue : aRHS.mValue)
+        };
+    }
+
+    //--------------------------------------------------------------------------
+    // Two measurements are equal if both their values and their uncertainties are.
+    friend constexpr bool operator==(measurement aLHS, measurement aRHS) {return aLHS.mValue == aRHS.mValue && aLHS.mUncertainty == aRHS.mUncertainty;}
+    friend constexpr bool operator!=(measurement aLHS, measurement aRHS) {return !(aLHS == aRHS);}
+
+    //--------------------------------------------------------------------------
+    // Measurements are ordered by their values, as dual is by its primal; the
+    // uncertainty takes no part.
+    friend constexpr bool operator<(measurement aLHS, measurement aRHS) {return aLHS.mValue < aRHS.mValue;}
+    friend constexpr bool operator<=(measurement aLHS, measurement aRHS) {return aLHS.mValue <= aRHS.mValue;}
+    friend constexpr bool operator>(measurement aLHS, measurement aRHS) {return aLHS.mValue > aRHS.mValue;}
+    friend constexpr bool operator>=(measurement aLHS, measurement aRHS) {return aLHS.mValue >= aRHS.mValue;}
+
+private:
+
+    value_type mValue{};
+    value_type mUncertainty{};
+
+}; // end of class measurement
+
+template< typename ValueT >
+struct is_units_value_impl<measurement<ValueT>> : std::true_type {};
+
+template< typename ValueT >
+struct is_floating_value_impl<measurement<ValueT>> : std::true_type {};
+
+//------------------------------------------------------------------------------
+// f(x) with uncertainty |f'(x)|·σ
+template< typename ValueT, typename DerivativeT >
+inline
+measurement<ValueT>
+propagate
+(
+    ValueT aValue,
+    DerivativeT aDerivative,
+    measurement<ValueT> aArgument
+)
+{
+    return measurement<ValueT>{aValue, std::abs(aDerivative) * aArgument.uncertainty()};
+}
+
+//------------------------------------------------------------------------------
+// Math functions found by argument dependent lookup from the units_t helpers
+template< typename ValueT >
+inline
+measurement<ValueT>
+abs
+(
+    measurement<ValueT> aX
+)
+{
+    return measurement<ValueT>{std::abs(aX.value()), aX.uncertainty()};
+}
+
+template< typename ValueT >
+inline
+measurement<ValueT>
+sqrt
+(
+    measurement<ValueT> aX
+)
+{
+    const auto theRoot = std::sqrt(aX.value());
+    return propagate(theRoot, ValueT{0.5} / theRoot, aX);
+}
+
+template< typename ValueT >
+inline
+measurement<ValueT>
+sin
+(
+    measurement<ValueT> aX
+)
+{
+    return propagate(std::sin(aX.value()), std::cos(aX.value()), aX);
+}
+
+template< typename ValueT >
+inline
+measurement<ValueT>
+cos
+(
+    measurement<ValueT> aX
+)
+{
+    return propagate(std::cos(aX.value()), std::sin(aX.value()), aX);
+}
+
+template< typename ValueT >
+inline
+measurement<ValueT>
+tan
+(
+    measurement<ValueT> aX
+)
+{
+    const auto theTangent = std::tan(aX.value());
+    return propagate(theTangent, 1 + theTangent * theTangent, aX);
+}
+
+template< typename ValueT >
+inline
+measurement<ValueT>
+asin
+(
+    measurement<ValueT> aX
+)
+{
+    return propagate(std::asin(aX.value()), 1 / std::sqrt(1 - aX.value() * aX.value()), aX);
+}
+
+template< typename ValueT >
+inline
+measurement<ValueT>
+acos
+(
+    measurement<ValueT> aX
+)
+{
+    return propagate(std::acos(aX.value()), 1 / std::sqrt(1 - aX.value() * aX.value()), aX);
+}
+
+template< typename ValueT >
+inline
+measurement<ValueT>
+atan
+(
+    measurement<ValueT> aX
+)
+{
+    return propagate(std::atan(aX.value()), 1 / (1 + aX.value() * aX.value()), aX);
+}
+
+//------------------------------------------------------------------------------
+// x^n with uncertainty |n·x^(n-1)|·σ, used by exponentiate; multiplying x by
+// itself would treat the factors as uncorrelated
+template< typename ValueT >
+inline
+constexpr
+measurement<ValueT>
+value_pow
+(
+    measurement<ValueT> aBase,
+    std::intmax_t aExponent
+)
+{
+    if( aExponent == 0 )
+    {
+        return measurement<ValueT>{1};
+    }
+
+    const auto thePrevious = value_pow(aBase.value(), aExponent - 1);
+    const auto theDerivative = static_cast<ValueT>(aExponent) * thePrevious;
+    return measurement<ValueT>
+    {
+        thePrevious * aBase.value(),
+        (theDerivative < 0 ? -theDerivative : theDerivative) * aBase.uncertainty()
+    };
+}
+
+//------------------------------------------------------------------------------
+template< typename ValueT >
+inline
+std::ostream&
+operator <<
+(
+    std::ostream& aStream,
+    measurement<ValueT> aMeasurement
+)
+{
+    return aStream << aMeasurement.value() << " ± " << aMeasurement.uncertainty();
+}
+
+//------------------------------------------------------------------------------
+/// Class measurement_array stores a sequence of units_t with a measurement
+/// value_t as structure of arrays, the values in one contiguous array and the
+/// uncertainties in another, so that the propagation kernels vectorize.
+template< typename UnitsT >
+class measurement_array
+{
+    static_assert(is_units_t<UnitsT>, "UnitsT must be of type si::units_t");
+
+public:
+
+    //--------------------------------------------------------------------------
+    /// Type aliases
+    using units_type = UnitsT;
+    using value_t = typename UnitsT::value_t;
+    using real_t = typename value_t::value_type;
+
+    //--------------------------------------------------------------------------
+    /// Initialize an array of aCount exact zeros.
+    explicit
+    measurement_array
+    (
+        std::size_t aCount = 0
+    )
+    : mValues(aCount)
+    , mUncertainties(aCount)
+    {
+    }
+
+    //--------------------------------------------------------------------------
+    // Accessor functions
+    std::size_t size() const {return mValues.size();}
+    bool empty() const {return mValues.empty();}
+
+    //--------------------------------------------------------------------------
+    /// the values, in the units of UnitsT
+    std::span<real_t> values() {return mValues;}
+    std::span<const real_t> values() const {return mValues;}
+
+    //--------------------------------------------------------------------------
+    /// the standard uncertainties, in the units of UnitsT
+    std::span<real_t> uncertainties() {return mUncertainties;}
+    std::span<const real_t> uncertainties() const {return mUncertainties;}
+
+    //--------------------------------------------------------------------------
+    /// gather the element at aIndex
+    UnitsT
+    operator[]
+    (
+        std::size_t aIndex
+    ) const
+    {
+        return UnitsT{value_t{mValues[aIndex], mUncertainties[aIndex]}};
+    }
+
+    //--------------------------------------------------------------------------
+    /// scatter aUnits to aIndex
+    void
+    set
+    (
+        std::size_t aIndex,
+        UnitsT aUnits
+    )
+    {
+        mValues[aIndex] = aUnits.value().value();
+        mUncertainties[aIndex] = aUnits.value().uncertainty();
+    }
+
+    //--------------------------------------------------------------------------
+    void
+    push_back
+    (
+        UnitsT aUnits
+    )
+    {
+        mValues.push_back(aUnits.value().value());
+        mUncertainties.push_back(aUnits.value().uncertainty());
+    }
+
+    //--------------------------------------------------------------------------
+    void
+    resize
+    (
+        std::size_t aCount
+    )
+    {
+        mValues.resize(aCount);
+        mUncertainties.resize(aCount);
+    }
+
+private:
+
+    std::vector<real_t> mValues;
+    std::vector<real_t> mUncertainties;
+
+}; // end of class measurement_array
+
+//------------------------------------------------------------------------------
+/// aResult[i] = aLHS[i] * aRHS[i]
+template< typename UnitsT1, typename UnitsT2 >
+inline
+void
+multiply
+(
+    const measurement_array<UnitsT1>& aLHS,
+    const measurement_array<UnitsT2>& aRHS,
+    measurement_array<multiply_units<UnitsT1, UnitsT2>>& aResult
+)
+{
+    assert(aLHS.size() == aRHS.size());
+    aResult.resize(aLHS.size());
+
+    const auto a = aLHS.values();
+    const auto sa = aLHS.uncertainties();
+    const auto b = aRHS.values();
+    const auto sb = aRHS.uncertainties();
+    const auto r = aResult.values();
+    const auto sr = aResult.uncertainties();
+    for( std::size_t i = 0; i < a.size(); ++i )
+    {
+        const auto x = b[i] * sa[i];
+        const auto y = a[i] * sb[i];
+        r[i] = a[i] * b[i];
+        sr[i] = std::sqrt(x * x + y * y);
+    }
+}
+
+//------------------------------------------------------------------------------
+/// aResult[i] = aLHS[i] / aRHS[i]
+template< typename UnitsT1, typename UnitsT2 >
+inline
+void
+divide
+(
+    const measurement_array<UnitsT1>& aLHS,
+    const measurement_array<UnitsT2>& aRHS,
+    measurement_array<divide_units<UnitsT1, UnitsT2>>& aResult
+)
+{
+    assert(aLHS.size() == aRHS.size());
+    aResult.resize(aLHS.size());
+
+    const auto a = aLHS.values();
+    const auto sa = aLHS.uncertainties();
+    const auto b = aRHS.values();
+    const auto sb = aRHS.uncertainties();
+    const auto r = aResult.values();
+    const auto sr = aResult.uncertainties();
+    for( std::size_t i = 0; i < a.size(); ++i )
+    {
+        const auto theReciprocal = 1 / b[i];
+        const auto q = a[i] * theReciprocal;
+        const auto y = q * sb[i];
+        r[i] = q;
+        sr[i] = std::sqrt(sa[i] * sa[i] + y * y) * std::abs(theReciprocal);
+    }
+}
+
+//------------------------------------------------------------------------------
+/// aResult[i] = aLHS[i] + aRHS[i]
+template< typename UnitsT >
+inline
+void
+add
+(
+    const measurement_array<UnitsT>& aLHS,
+    const measurement_array<UnitsT>& aRHS,
+    measurement_array<UnitsT>& aResult
+)
+{
+    assert(aLHS.size() == aRHS.size());
+    aResult.resize(aLHS.size());
+
+    const auto a = aLHS.values();
+    const auto sa = aLHS.uncertainties();
+    const auto b = aRHS.values();
+    const auto sb = aRHS.uncertainties();
+    const auto r = aResult.values();
+    const auto sr = aResult.uncertainties();
+    for( std::size_t i = 0; i < a.size(); ++i )
+    {
+        r[i] = a[i] + b[i];
+        sr[i] = std::sqrt(sa[i] * sa[i] + sb[i] * sb[i]);
+    }
+}
+
+//------------------------------------------------------------------------------
+/// aResult[i] = square_root(aUnits[i])
+template< typename UnitsT >
+inline
+void
+square_root
+(
+    const measurement_array<UnitsT>& aUnits,
+    measurement_array<decltype(square_root(UnitsT{}))>& aResult
+)
+{
+    aResult.resize(aUnits.size());
+
+    const auto a = aUnits.values();
+    const auto sa = aUnits.uncertainties();
+    const auto r = aResult.values();
+    const auto sr = aResult.uncertainties();
+    for( std::size_t i = 0; i < a.size(); ++i )
+    {
+        const auto theRoot = std::sqrt(a[i]);
+        r[i] = theRoot;
+        sr[i] = sa[i] / (2 * theRoot);
+    }
+}
+
+} // end of namespace si
+
+//------------------------------------------------------------------------------
+/// Specializations of std::common_type, so that a measurement and an
+/// arithmetic type or another measurement promote like their values do.
+template< typename ValueT1, typename ValueT2 >
+struct std::common_type<si::measurement<ValueT1>, si::measurement<ValueT2>>
+{
+    using type = si::measurement<std::common_type_t<ValueT1, ValueT2>>;
+};
+
+template< typename ValueT1, typename ValueT2 >
+struct std::common_type<si::measurement<ValueT1>, ValueT2>
+{
+    using type = si::measurement<std::common_type_t<ValueT1, ValueT2>>;
+};
+
+template< typename ValueT1, typename ValueT2 >
+struct std::common_type<ValueT1, si::measurement<ValueT2>>
+{
+    using type = si::measurement<std::common_type_t<ValueT1, ValueT2>>;
+};
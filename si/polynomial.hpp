@@ -0,0 +1,155 @@
+#pragma once
+#include <array>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <span>
+#include <utility>
+
+#include "units.hpp"
+
+namespace si
+{
+
+//------------------------------------------------------------------------------
+/// a * b + c, fused when the target has a fast fused multiply-add
+template< typename ValueT >
+inline
+ValueT
+multiply_add
+(
+    ValueT aA,
+    ValueT aB,
+    ValueT aC
+)
+{
+#if defined(FP_FAST_FMA)
+    return std::fma(aA, aB, aC);
+#else
+    return aA * aB + aC;
+#endif
+}
+
+//------------------------------------------------------------------------------
+/// the units_t type of the coefficient of x^Power in a polynomial mapping
+/// XUnitsT to YUnitsT
+template< typename XUnitsT, typename YUnitsT, std::size_t Power >
+using coefficient_units = divide_units<YUnitsT, power_units<XUnitsT, Power>>;
+
+template< typename XUnitsT, typename YUnitsT, std::size_t Degree, typename = std::make_index_sequence<Degree + 1> >
+class polynomial;
+
+//------------------------------------------------------------------------------
+/// Class polynomial evaluates p(x) = a0 + a1·x + ... + aN·x^N, where each
+/// coefficient ai has the units of YUnitsT / XUnitsT^i. The constructor only
+/// accepts coefficients of those units, so a wrongly dimensioned coefficient
+/// does not compile.
+template< typename XUnitsT, typename YUnitsT, std::size_t Degree, std::size_t... Powers >
+class polynomial<XUnitsT, YUnitsT, Degree, std::index_sequence<Powers...>>
+{
+    static_assert(is_units_t<XUnitsT> && is_units_t<YUnitsT>, "XUnitsT and YUnitsT must be of type si::units_t");
+    static_assert(std::is_floating_point<typename YUnitsT::value_t>::value, "YUnitsT must have a floating point value_t");
+
+public:
+
+    //--------------------------------------------------------------------------
+    /// Type aliases
+    using x_t = XUnitsT;
+    using y_t = YUnitsT;
+
+    template< std::size_t Power >
+    using coefficient_t = coefficient_units<XUnitsT, YUnitsT, Power>;
+
+    //--------------------------------------------------------------------------
+    /// Static member constants
+    static constexpr std::size_t degree = Degree;
+
+    //--------------------------------------------------------------------------
+    /// Initialize a polynomial from its coefficients, lowest power first.
+    /// Each coefficient may be given in any units_t convertible to coefficient_t<i>.
+    constexpr
+    explicit
+    polynomial
+    (
+        coefficient_t<Powers>... aCoefficients
+    )
+    : mCoefficients{static_cast<value_t>(aCoefficients.value())...}
+    {
+    }
+
+    //--------------------------------------------------------------------------
+    /// the coefficient of x^Power
+    template< std::size_t Power >
+    constexpr
+    coefficient_t<Power>
+    coefficient
+    (
+    ) const
+    {
+        static_assert(Power <= Degree, "Power must not exceed the degree of the polynomial");
+        return coefficient_t<Power>{mCoefficients[Power]};
+    }
+
+    //--------------------------------------------------------------------------
+    /// Evaluate the polynomial with Horner's scheme.
+    y_t
+    operator()
+    (
+        x_t aX
+    ) const
+    {
+        return y_t{evaluate(static_cast<value_t>(aX.value()))};
+    }
+
+    //--------------------------------------------------------------------------
+    /// Evaluate the polynomial at an argument in other units of the same quantity.
+    template< typename ValueT, typename IntervalT >
+    y_t
+    operator()
+    (
+        units_t<ValueT, IntervalT, typename x_t::quantity_t> aX
+    ) const
+    {
+        return (*this)(units_cast<x_t>(aX));
+    }
+
+    //--------------------------------------------------------------------------
+    /// Evaluate the polynomial at each of a block of arguments.
+    /// The evaluations are independent, so the compiler vectorizes across them.
+    void
+    operator()
+    (
+        std::span<const x_t> aX,
+        std::span<y_t> aY
+    ) const
+    {
+        assert(aY.size() >= aX.size());
+        for( std::size_t i = 0; i < aX.size(); ++i )
+        {
+            aY[i] = y_t{evaluate(static_cast<value_t>(aX[i].value()))};
+        }
+    }
+
+private:
+
+    using value_t = typename y_t::value_t;
+
+    value_t
+    evaluate
+    (
+        value_t aX
+    ) const
+    {
+        auto theResult = mCoefficients[Degree];
+        for( std::size_t i = Degree; i-- > 0; )
+        {
+            theResult = multiply_add(theResult, aX, mCoefficients[i]);
+        }
+        return theResult;
+    }
+
+    std::array<value_t, Degree + 1> mCoefficients;
+
+}; // end of class polynomial
+
+} // end of namespace si
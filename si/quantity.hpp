@@ -2,7 +2,6 @@
 #include <cstdint>
 #include <type_traits>
 #include <ratio>
-#include <string>
 #include "exponent.hpp"
 #include "constants.hpp"
 
@@ -208,120 +207,4 @@ ABBREV_CONST(inductance, "H");
 ABBREV_CONST(luminous_flux, "lm");
 ABBREV_CONST(illuminance, "lx");
 
-template< typename Exp, typename CharT >
-inline
-std::basic_string<CharT>
-basic_string_from_exp
-(
-    const CharT* const aAbbreviation,
-    std::basic_string<CharT> aString = std::basic_string<CharT>{}
-)
-{
-    if( Exp::value > 0 )
-    {
-        if( !aString.empty() )
-        {
-            aString += multiply_operator<CharT>;
-        }
-
-        aString += aAbbreviation;
-
-        if( Exp::value > 1 )
-        {
-            aString += si::basic_string_from<CharT>(Exp{});
-        }
-    }
-
-    return aString;
-}
-
-STRING_CONST(one, "1");
-
-template
-<
-    typename CharT,
-    std::intmax_t M,
-    std::intmax_t L,
-    std::intmax_t T,
-    std::intmax_t C,
-    std::intmax_t Temp,
-    std::intmax_t Lum,
-    std::intmax_t S,
-    std::intmax_t A
->
-inline
-std::basic_string<CharT>
-basic_string_from
-(
-    quantity_t<M,L,T,C,Temp,Lum,S,A> aQuantity
-)
-{
-    using Q_t = quantity_t<M,L,T,C,Temp,Lum,S,A>;
-    if( abbrev<CharT, Q_t> != nullptr )
-    {
-        return abbrev<CharT, Q_t>;
-    }
-
-    auto theNum = basic_string_from_exp<typename Q_t::mass>( abbrev<CharT,mass> );
-    theNum = basic_string_from_exp<typename Q_t::length>( abbrev<CharT,length>, std::move(theNum) );
-    theNum = basic_string_from_exp<typename Q_t::time>( abbrev<CharT,time>, std::move(theNum) );
-    theNum = basic_string_from_exp<typename Q_t::current>( abbrev<CharT,current>, std::move(theNum) );
-    theNum = basic_string_from_exp<typename Q_t::temperature>( abbrev<CharT,temperature>, std::move(theNum) );
-    theNum = basic_string_from_exp<typename Q_t::luminous_intensity>( abbrev<CharT,luminous_intensity>, std::move(theNum) );
-    theNum = basic_string_from_exp<typename Q_t::substance>( abbrev<CharT,substance>, std::move(theNum) );
-    theNum = basic_string_from_exp<typename Q_t::angle>( abbrev<CharT,angle>, std::move(theNum) );
-
-    using Recip_t = reciprocal_quantity<Q_t>;
-
-    auto theDen = basic_string_from_exp<typename Recip_t::mass>( abbrev<CharT,mass> );
-    theDen = basic_string_from_exp<typename Recip_t::length>( abbrev<CharT,length>, std::move(theDen) );
-    theDen = basic_string_from_exp<typename Recip_t::time>( abbrev<CharT,time>, std::move(theDen) );
-    theDen = basic_string_from_exp<typename Recip_t::current>( abbrev<CharT,current>, std::move(theDen) );
-    theDen = basic_string_from_exp<typename Recip_t::temperature>( abbrev<CharT,temperature>, std::move(theDen) );
-    theDen = basic_string_from_exp<typename Recip_t::luminous_intensity>( abbrev<CharT,luminous_intensity>, std::move(theDen) );
-    theDen = basic_string_from_exp<typename Recip_t::substance>( abbrev<CharT,substance>, std::move(theDen) );
-    theDen = basic_string_from_exp<typename Recip_t::angle>( abbrev<CharT,angle>, std::move(theDen) );
-
-    if( theDen.empty() )
-    {
-        return theNum;
-    }
-    else
-    {
-        if( theNum.empty() )
-        {
-            theNum = one<CharT>;
-        }
-
-        return theNum + divide_operator<CharT> + theDen;
-    }
-
-    return theNum;
-}
-
-template
-<
-    typename CharT,
-    std::intmax_t M,
-    std::intmax_t L,
-    std::intmax_t T,
-    std::intmax_t C,
-    std::intmax_t Te,
-    std::intmax_t Li,
-    std::intmax_t S,
-    std::intmax_t A
->
-inline
-std::basic_ostream<CharT>&
-operator <<
-(
-    std::basic_ostream<CharT>& aStream,
-    quantity_t<M,L,T,C,Te,Li,S,A> aQuantity
-)
-{
-    return aStream << basic_string_from<CharT>(aQuantity);
-}
-
 } // end of namespace si
-
-#include "string-from.hpp"
@@ -0,0 +1,279 @@
+#pragma once
+#include <bit>
+#include <cassert>
+#include <chrono>
+#include <cstddef>
+#include <vector>
+
+#include "units.hpp"
+
+namespace si
+{
+
+//------------------------------------------------------------------------------
+/// Class rolling_window holds the samples of the most recent time span and
+/// provides windowed aggregates over them.
+/// Samples are kept in a ring buffer that is allocated once at construction.
+/// sum() and mean() are maintained incrementally, with compensated summation
+/// for a floating value_t, and minimum() and maximum() are maintained with
+/// monotonic queues, so every aggregate is O(1) and every
+/// push is amortised O(1).
+template< typename UnitsT, typename TimeUnitsT = seconds<> >
+class rolling_window
+{
+    static_assert(is_units_t<UnitsT>, "UnitsT must be of type si::units_t");
+    static_assert(is_units_t<TimeUnitsT>, "TimeUnitsT must be of type si::units_t");
+    static_assert(std::is_same<typename TimeUnitsT::quantity_t, si::time>::value, "TimeUnitsT must have quantity si::time");
+
+public:
+
+    //--------------------------------------------------------------------------
+    /// Type aliases
+    using samples_t = UnitsT;
+    using times_t = TimeUnitsT;
+    using rate_t = divide_units<UnitsT, TimeUnitsT>;
+
+    //--------------------------------------------------------------------------
+    /// Initialize an empty window.
+    /// @param aSpan samples older than the newest sample by aSpan or more are evicted
+    /// @param aCapacity the maximum number of samples held, the oldest sample is evicted when full
+    rolling_window
+    (
+        times_t aSpan,
+        std::size_t aCapacity
+    )
+    : mSpan{aSpan}
+    , mMask{std::bit_ceil(aCapacity) - 1}
+    , mCapacity{aCapacity}
+    , mSamples(mMask + 1)
+    , mTimes(mMask + 1)
+    , mMinimums(mMask + 1)
+    , mMaximums(mMask + 1)
+    {
+        assert(aCapacity > 0);
+    }
+
+    //--------------------------------------------------------------------------
+    /// Initialize an empty window with a span given as a std::chrono::duration.
+    template< typename RepT, typename PeriodT >
+    rolling_window
+    (
+        std::chrono::duration<RepT, PeriodT> aSpan,
+        std::size_t aCapacity
+    )
+    : rolling_window{units_cast<times_t>(aSpan), aCapacity}
+    {
+    }
+
+    //--------------------------------------------------------------------------
+    /// Add a sample, evicting samples that fall outside the window.
+    /// @param aTime must not be earlier than the time of the previous sample
+    void
+    push
+    (
+        samples_t aSample,
+        times_t aTime
+    )
+    {
+        if( size() == mCapacity )
+        {
+            pop();
+        }
+
+        const auto theIndex = mTail & mMask;
+        mSamples[theIndex] = aSample;
+        mTimes[theIndex] = aTime;
+        accumulate(aSample);
+
+        while( mMinimumsHead != mMinimumsTail && !(sample(mMinimums[(mMinimumsTail - 1) & mMask]) < aSample) )
+        {
+            --mMinimumsTail;
+        }
+        mMinimums[mMinimumsTail++ & mMask] = mTail;
+
+        while( mMaximumsHead != mMaximumsTail && !(aSample < sample(mMaximums[(mMaximumsTail - 1) & mMask])) )
+        {
+            --mMaximumsTail;
+        }
+        mMaximums[mMaximumsTail++ & mMask] = mTail;
+
+        ++mTail;
+        expire(aTime);
+    }
+
+    //--------------------------------------------------------------------------
+    /// Evict the samples that fall outside the window ending at aNow.
+    void
+    expire
+    (
+        times_t aNow
+    )
+    {
+        while( !empty() && !(aNow - mTimes[mHead & mMask] < mSpan) )
+        {
+            pop();
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    /// Evict all samples.
+    void
+    clear
+    (
+    )
+    {
+        mHead = mTail = 0;
+        mMinimumsHead = mMinimumsTail = 0;
+        mMaximumsHead = mMaximumsTail = 0;
+        mSum = samples_t::zero();
+        mCompensation = samples_t::zero();
+    }
+
+    //--------------------------------------------------------------------------
+    // Accessor functions
+    times_t span() const {return mSpan;}
+    std::size_t capacity() const {return mCapacity;}
+    std::size_t size() const {return mTail - mHead;}
+    bool empty() const {return mTail == mHead;}
+    samples_t oldest() const {assert(!empty()); return sample(mHead);}
+    samples_t newest() const {assert(!empty()); return sample(mTail - 1);}
+
+    //--------------------------------------------------------------------------
+    // Aggregates, all of which require a non-empty window except sum()
+    samples_t sum() const {return mSum + mCompensation;}
+
+    samples_t
+    mean
+    (
+    ) const
+    {
+        assert(!empty());
+        return samples_t{sum().value() / static_cast<typename samples_t::value_t>(size())};
+    }
+
+    samples_t
+    minimum
+    (
+    ) const
+    {
+        assert(!empty());
+        return sample(mMinimums[mMinimumsHead & mMask]);
+    }
+
+    samples_t
+    maximum
+    (
+    ) const
+    {
+        assert(!empty());
+        return sample(mMaximums[mMaximumsHead & mMask]);
+    }
+
+    //--------------------------------------------------------------------------
+    /// the rate of change between the oldest and the newest sample,
+    /// e.g. the rate of a cumulative counter over the window
+    rate_t
+    rate
+    (
+    ) const
+    {
+        assert(size() > 1);
+        using RateValue_t = typename rate_t::value_t;
+        const auto theOldest = mHead & mMask;
+        const auto theNewest = (mTail - 1) & mMask;
+        return rate_t
+        {
+            static_cast<RateValue_t>(mSamples[theNewest].value() - mSamples[theOldest].value()) /
+            static_cast<RateValue_t>(mTimes[theNewest].value() - mTimes[theOldest].value())
+        };
+    }
+
+private:
+
+    samples_t sample(std::size_t aSequence) const {return mSamples[aSequence & mMask];}
+
+    //--------------------------------------------------------------------------
+    // Add aSample to mSum, carrying the rounding error of a floating value_t
+    // in mCompensation (Neumaier's variant of Kahan summation, which also
+    // holds when a sample is larger than the sum, as on eviction) so that
+    // the sum does not drift over long runs.
+    void
+    accumulate
+    (
+        samples_t aSample
+    )
+    {
+        if constexpr( is_floating_value<typename samples_t::value_t> )
+        {
+            using std::abs;
+            const auto theSum = mSum + aSample;
+            if( abs(mSum.value()) < abs(aSample.value()) )
+            {
+                mCompensation += (aSample - theSum) + mSum;
+            }
+            else
+            {
+                mCompensation += (mSum - theSum) + aSample;
+            }
+            mSum = theSum;
+        }
+        else
+        {
+            mSum += aSample;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // Evict the oldest sample.
+    void
+    pop
+    (
+    )
+    {
+        accumulate(-mSamples[mHead & mMask]);
+
+        if( mMinimums[mMinimumsHead & mMask] == mHead )
+        {
+            ++mMinimumsHead;
+        }
+
+        if( mMaximums[mMaximumsHead & mMask] == mHead )
+        {
+            ++mMaximumsHead;
+        }
+
+        ++mHead;
+
+        // an empty window sums to exactly zero, whatever the rounding error
+        if( empty() )
+        {
+            mSum = samples_t::zero();
+            mCompensation = samples_t::zero();
+        }
+    }
+
+    times_t mSpan;
+    std::size_t mMask;
+    std::size_t mCapacity;
+
+    // ring buffer of samples, indexed by sequence number & mMask
+    std::vector<samples_t> mSamples;
+    std::vector<times_t> mTimes;
+    std::size_t mHead = 0;
+    std::size_t mTail = 0;
+
+    // monotonic queues of sequence numbers, sample values increasing from
+    // head to tail in mMinimums and decreasing in mMaximums
+    std::vector<std::size_t> mMinimums;
+    std::size_t mMinimumsHead = 0;
+    std::size_t mMinimumsTail = 0;
+    std::vector<std::size_t> mMaximums;
+    std::size_t mMaximumsHead = 0;
+    std::size_t mMaximumsTail = 0;
+
+    samples_t mSum = samples_t::zero();
+    samples_t mCompensation = samples_t::zero();
+
+}; // end of class rolling_window
+
+} // end of namespace si
@@ -0,0 +1,653 @@
+#pragma once
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <optional>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+#include "units.hpp"
+#include "wire-format.hpp"
+
+namespace si
+{
+
+//------------------------------------------------------------------------------
+/// A series block holds a time series of units_t compressed as Facebook's
+/// Gorilla does: integral values, such as timestamps, as zigzag coded
+/// deltas of deltas, and floating point values as the exclusive or with the
+/// previous value. The block begins with a 48 byte little endian header:
+///
+///  offset | size | field
+///  -------|------|------------------------------------------------------
+///       0 |   32 | as in the wire format, with magic "sic1" and byte order 1
+///      32 |    8 | number of values
+///      40 |    8 | number of 64 bit words of bits that follow
+///
+/// The bits follow as little endian 64 bit words, filled from the most
+/// significant bit down. A regular series of timestamps takes one bit per
+/// value; a reading that seldom changes takes one or two bits per value.
+inline constexpr std::size_t series_header_size = 48;
+
+//------------------------------------------------------------------------------
+/// Class series_bit_writer appends bit fields to 64 bit words.
+class series_bit_writer
+{
+public:
+
+    //--------------------------------------------------------------------------
+    /// append the low aCount bits of aBits, most significant first;
+    /// aCount is in [1, 64] and the other bits of aBits are zero
+    void
+    write
+    (
+        std::uint64_t aBits,
+        int aCount
+    )
+    {
+        assert(aCount >= 1 && aCount <= 64);
+        assert(aCount == 64 || aBits >> aCount == 0);
+
+        const int theFree = 64 - mUsed;
+        if( aCount < theFree )
+        {
+            mWord |= aBits << (theFree - aCount);
+            mUsed += aCount;
+            return;
+        }
+
+        // fill the word and carry the rest into the next
+        const int theRest = aCount - theFree;
+        mWords.push_back(mWord | aBits >> theRest);
+        mWord = theRest == 0 ? 0 : aBits << (64 - theRest);
+        mUsed = theRest;
+    }
+
+    //--------------------------------------------------------------------------
+    /// the words written, with the last partial word
+    std::vector<std::uint64_t>
+    words
+    (
+    ) const
+    {
+        auto theWords = mWords;
+        if( mUsed > 0 )
+        {
+            theWords.push_back(mWord);
+        }
+        return theWords;
+    }
+
+private:
+
+    std::vector<std::uint64_t> mWords;
+    std::uint64_t mWord = 0;
+    int mUsed = 0;
+
+}; // end of class series_bit_writer
+
+//------------------------------------------------------------------------------
+/// Class series_bit_reader reads the bit fields of series_bit_writer from
+/// little endian words in place, a word at a time. Reading past the end
+/// gives zero bits and clears good.
+class series_bit_reader
+{
+public:
+
+    //--------------------------------------------------------------------------
+    series_bit_reader
+    (
+        std::span<const std::byte> aWords
+    )
+    : mWords{aWords}
+    , mBitCount{aWords.size() / 8 * 64}
+    {
+    }
+
+    //--------------------------------------------------------------------------
+    /// the next aCount bits, aCount in [1, 64]
+    std::uint64_t
+    read
+    (
+        int aCount
+    )
+    {
+        assert(aCount >= 1 && aCount <= 64);
+        if( mPosition + aCount > mBitCount )
+        {
+            mPosition = mBitCount;
+            mGood = false;
+            return 0;
+        }
+
+        const std::size_t theIndex = mPosition / 64;
+        const int theOffset = static_cast<int>(mPosition % 64);
+        std::uint64_t theBits = word(theIndex) << theOffset;
+        if( theOffset + aCount > 64 )
+        {
+            theBits |= word(theIndex + 1) >> (64 - theOffset);
+        }
+        mPosition += aCount;
+        return aCount == 64 ? theBits : theBits >> (64 - aCount);
+    }
+
+    //--------------------------------------------------------------------------
+    /// the number of leading one bits up to aLimit, and the zero that ends
+    /// them if fewer than aLimit
+    int
+    read_ones
+    (
+        int aLimit
+    )
+    {
+        int theOnes = 0;
+        while( theOnes < aLimit && read(1) == 1 )
+        {
+            ++theOnes;
+        }
+        return theOnes;
+    }
+
+    //--------------------------------------------------------------------------
+    bool good() const {return mGood;}
+
+private:
+
+    //--------------------------------------------------------------------------
+    std::uint64_t
+    word
+    (
+        std::size_t aIndex
+    ) const
+    {
+        std::uint64_t theWord;
+        std::memcpy(&theWord, mWords.data() + 8 * aIndex, 8);
+        if constexpr( std::endian::native == std::endian::big )
+        {
+            theWord = byte_swap(theWord);
+        }
+        return theWord;
+    }
+
+    std::span<const std::byte> mWords;
+    std::size_t mBitCount;
+    std::size_t mPosition = 0;
+    bool mGood = true;
+
+}; // end of class series_bit_reader
+
+//------------------------------------------------------------------------------
+/// the type descriptor of a series block of UnitsT, the first 32 bytes of
+/// its header
+template< typename UnitsT >
+constexpr
+std::array<std::byte, wire_header_size>
+series_type_header
+(
+)
+{
+    auto theHeader = wire_header<UnitsT>(0);
+    theHeader[2] = std::byte{'c'};
+    theHeader[6] = std::byte{1};
+    return theHeader;
+}
+
+//------------------------------------------------------------------------------
+/// the zigzag code of aValue as two's complement: 0, -1, 1, -2 ... become
+/// 0, 1, 2, 3 ...
+constexpr
+std::uint64_t
+zigzag_encode
+(
+    std::uint64_t aValue
+)
+{
+    return (aValue << 1) ^ (0 - (aValue >> 63));
+}
+
+//------------------------------------------------------------------------------
+constexpr
+std::uint64_t
+zigzag_decode
+(
+    std::uint64_t aCode
+)
+{
+    return (aCode >> 1) ^ (0 - (aCode & 1));
+}
+
+//------------------------------------------------------------------------------
+/// the unsigned bits a series block codes for a value of ValueT: integral
+/// values as 64 bits, floating point values as their own width
+template< typename ValueT >
+using series_bits_t = std::conditional_t<sizeof(ValueT) == 4 && std::is_floating_point<ValueT>::value, std::uint32_t, std::uint64_t>;
+
+//------------------------------------------------------------------------------
+template< typename ValueT >
+constexpr
+series_bits_t<ValueT>
+series_bits
+(
+    ValueT aValue
+)
+{
+    if constexpr( std::is_floating_point<ValueT>::value )
+    {
+        return std::bit_cast<series_bits_t<ValueT>>(aValue);
+    }
+    else
+    {
+        return static_cast<std::uint64_t>(aValue);
+    }
+}
+
+//------------------------------------------------------------------------------
+template< typename ValueT >
+constexpr
+ValueT
+series_value
+(
+    series_bits_t<ValueT> aBits
+)
+{
+    if constexpr( std::is_floating_point<ValueT>::value )
+    {
+        return std::bit_cast<ValueT>(aBits);
+    }
+    else
+    {
+        return static_cast<ValueT>(aBits);
+    }
+}
+
+//------------------------------------------------------------------------------
+/// Class series_encoder compresses a time series of UnitsT into a series
+/// block. An integral value_t is coded by its delta of deltas in one of five
+/// buckets, '0' for none, '10', '110' and '1110' followed by 7, 9 and 12
+/// bits, and '1111' followed by 64 bits. A floating point value_t is coded
+/// by its exclusive or with the previous value: '0' when equal, '10'
+/// followed by the meaningful bits when they fall within those of the
+/// previous code, and '11' followed by 5 bits of leading zeros, 6 bits of
+/// length and the meaningful bits otherwise. Equal floating point values
+/// compare by bits, so -0.0 and NaN payloads round trip.
+template< typename UnitsT >
+class series_encoder
+{
+    static_assert(is_units_t<UnitsT>, "UnitsT must be a units_t");
+    static_assert(std::is_arithmetic<typename UnitsT::value_t>::value && sizeof(typename UnitsT::value_t) <= 8, "series_encoder requires an arithmetic value_t of at most 64 bits");
+
+public:
+
+    //--------------------------------------------------------------------------
+    /// Type aliases
+    using stored_t = UnitsT;
+    using value_t = typename UnitsT::value_t;
+    using bits_t = series_bits_t<value_t>;
+
+    //--------------------------------------------------------------------------
+    /// append aUnits to the series
+    void
+    push
+    (
+        UnitsT aUnits
+    )
+    {
+        const bits_t theBits = series_bits<value_t>(aUnits.value());
+        if( mCount == 0 )
+        {
+            mWriter.write(theBits, sizeof(bits_t) * 8);
+        }
+        else if constexpr( std::is_floating_point<value_t>::value )
+        {
+            push_xor(theBits ^ mPrevious);
+        }
+        else
+        {
+            const std::uint64_t theDelta = theBits - mPrevious;
+            push_delta_of_delta(zigzag_encode(theDelta - mDelta));
+            mDelta = theDelta;
+        }
+        mPrevious = theBits;
+        ++mCount;
+    }
+
+    //--------------------------------------------------------------------------
+    /// append aUnits to the series
+    void
+    push
+    (
+        std::span<const UnitsT> aUnits
+    )
+    {
+        for( const auto theUnits : aUnits )
+        {
+            push(theUnits);
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    /// the number of values pushed
+    std::size_t size() const {return mCount;}
+
+    //--------------------------------------------------------------------------
+    /// the series block of the values pushed so far
+    std::vector<std::byte>
+    finish
+    (
+    ) const
+    {
+        const auto theWords = mWriter.words();
+        std::vector<std::byte> theBlock(series_header_size + 8 * theWords.size());
+
+        const auto theHeader = series_type_header<UnitsT>();
+        std::memcpy(theBlock.data(), theHeader.data(), 32);
+        put_wire_field(theBlock, 32, mCount);
+        put_wire_field(theBlock, 40, theWords.size());
+        for( std::size_t i = 0; i < theWords.size(); ++i )
+        {
+            put_wire_field(theBlock, series_header_size + 8 * i, theWords[i]);
+        }
+        return theBlock;
+    }
+
+private:
+
+    //--------------------------------------------------------------------------
+    void
+    push_delta_of_delta
+    (
+        std::uint64_t aCode
+    )
+    {
+        if( aCode == 0 )
+        {
+            mWriter.write(0b0, 1);
+        }
+        else if( aCode < (1u << 7) )
+        {
+            mWriter.write(0b10, 2);
+            mWriter.write(aCode, 7);
+        }
+        else if( aCode < (1u << 9) )
+        {
+            mWriter.write(0b110, 3);
+            mWriter.write(aCode, 9);
+        }
+        else if( aCode < (1u << 12) )
+        {
+            mWriter.write(0b1110, 4);
+            mWriter.write(aCode, 12);
+        }
+        else
+        {
+            mWriter.write(0b1111, 4);
+            mWriter.write(aCode, 64);
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    void
+    push_xor
+    (
+        bits_t aXor
+    )
+    {
+        constexpr int theWidth = sizeof(bits_t) * 8;
+        if( aXor == 0 )
+        {
+            mWriter.write(0b0, 1);
+            return;
+        }
+
+        const int theLeading = std::min(std::countl_zero(aXor), 31);
+        const int theTrailing = std::countr_zero(aXor);
+        if( theLeading >= mLeading && theTrailing >= mTrailing )
+        {
+            mWriter.write(0b10, 2);
+            mWriter.write(aXor >> mTrailing, theWidth - mLeading - mTrailing);
+            return;
+        }
+
+        const int theLength = theWidth - theLeading - theTrailing;
+        mWriter.write(0b11, 2);
+        mWriter.write(static_cast<std::uint64_t>(theLeading), 5);
+        mWriter.write(static_cast<std::uint64_t>(theLength - 1), 6);
+        mWriter.write(aXor >> theTrailing, theLength);
+        mLeading = theLeading;
+        mTrailing = theTrailing;
+    }
+
+    series_bit_writer mWriter;
+    std::uint64_t mCount = 0;
+    bits_t mPrevious = 0;
+    std::uint64_t mDelta = 0;
+    // no window until the first '11' code
+    int mLeading = 64;
+    int mTrailing = 64;
+
+}; // end of class series_encoder
+
+//------------------------------------------------------------------------------
+/// Class series_decoder decompresses a series block into UnitsT, in as many
+/// reads as the caller likes. The block must hold the quantity and value_t
+/// of UnitsT, in any interval whose ratio to that of UnitsT fits intmax_t;
+/// values in another interval are converted as units_cast converts while
+/// they are decoded.
+template< typename UnitsT >
+class series_decoder
+{
+    static_assert(is_units_t<UnitsT>, "UnitsT must be a units_t");
+    static_assert(std::is_arithmetic<typename UnitsT::value_t>::value && sizeof(typename UnitsT::value_t) <= 8, "series_decoder requires an arithmetic value_t of at most 64 bits");
+
+public:
+
+    //--------------------------------------------------------------------------
+    /// Type aliases
+    using stored_t = UnitsT;
+    using value_t = typename UnitsT::value_t;
+    using bits_t = series_bits_t<value_t>;
+
+    //--------------------------------------------------------------------------
+    /// a decoder of aBlock, which must outlive it; std::nullopt if aBlock is
+    /// not a whole series block of the quantity and value_t of UnitsT
+    static
+    std::optional<series_decoder>
+    open
+    (
+        std::span<const std::byte> aBlock
+    )
+    {
+        if( aBlock.size() < series_header_size )
+        {
+            return std::nullopt;
+        }
+
+        // the type descriptor up to the interval
+        const auto theExpected = series_type_header<UnitsT>();
+        if( std::memcmp(aBlock.data(), theExpected.data(), 16) != 0 )
+        {
+            return std::nullopt;
+        }
+
+        const auto theRatio = wire_interval_ratio_to<UnitsT>(aBlock);
+        const auto theCount = get_wire_field(aBlock, 32);
+        const auto theWordCount = get_wire_field(aBlock, 40);
+        // every value but the first takes at least a bit
+        if( !theRatio || theWordCount > (aBlock.size() - series_header_size) / 8 || theCount > 64 * theWordCount )
+        {
+            return std::nullopt;
+        }
+        return series_decoder{aBlock.subspan(series_header_size, 8 * theWordCount), theCount, *theRatio};
+    }
+
+    //--------------------------------------------------------------------------
+    /// the number of values in the block
+    std::size_t size() const {return mCount;}
+
+    //--------------------------------------------------------------------------
+    /// the number of values not yet read
+    std::size_t remaining() const {return mCount - mRead;}
+
+    //--------------------------------------------------------------------------
+    /// false if the bits of the block ran out before its values
+    bool good() const {return mReader.good();}
+
+    //--------------------------------------------------------------------------
+    /// decode the next values into aResult, as many as fit, and return their
+    /// number
+    std::size_t
+    read
+    (
+        std::span<UnitsT> aResult
+    )
+    {
+        const std::size_t theCount = std::min(aResult.size(), remaining());
+        if( mRatio.num == 1 && mRatio.den == 1 )
+        {
+            for( std::size_t i = 0; i < theCount; ++i )
+            {
+                aResult[i] = UnitsT{next()};
+            }
+        }
+        else
+        {
+            for( std::size_t i = 0; i < theCount; ++i )
+            {
+                aResult[i] = from_wire_value<UnitsT>(next(), mRatio);
+            }
+        }
+        return theCount;
+    }
+
+private:
+
+    //--------------------------------------------------------------------------
+    series_decoder
+    (
+        std::span<const std::byte> aWords,
+        std::size_t aCount,
+        wire_interval_ratio aRatio
+    )
+    : mReader{aWords}
+    , mCount{aCount}
+    , mRatio{aRatio}
+    {
+    }
+
+    //--------------------------------------------------------------------------
+    value_t
+    next
+    (
+    )
+    {
+        if( mRead++ == 0 )
+        {
+            mPrevious = static_cast<bits_t>(mReader.read(sizeof(bits_t) * 8));
+        }
+        else if constexpr( std::is_floating_point<value_t>::value )
+        {
+            mPrevious ^= next_xor();
+        }
+        else
+        {
+            mDelta += zigzag_decode(next_delta_of_delta());
+            mPrevious += mDelta;
+        }
+        return series_value<value_t>(mPrevious);
+    }
+
+    //--------------------------------------------------------------------------
+    std::uint64_t
+    next_delta_of_delta
+    (
+    )
+    {
+        constexpr int theBucketBits[] = {0, 7, 9, 12, 64};
+        const int theBucket = mReader.read_ones(4);
+        return theBucket == 0 ? 0 : mReader.read(theBucketBits[theBucket]);
+    }
+
+    //--------------------------------------------------------------------------
+    bits_t
+    next_xor
+    (
+    )
+    {
+        constexpr int theWidth = sizeof(bits_t) * 8;
+        if( mReader.read(1) == 0 )
+        {
+            return 0;
+        }
+        if( mReader.read(1) == 1 )
+        {
+            mLeading = static_cast<int>(mReader.read(5));
+            const int theLength = static_cast<int>(mReader.read(6)) + 1;
+            // a corrupt block may give a window wider than the value
+            mLeading = std::min(mLeading, theWidth - theLength);
+            mTrailing = theWidth - mLeading - theLength;
+        }
+        return static_cast<bits_t>(mReader.read(theWidth - mLeading - mTrailing) << mTrailing);
+    }
+
+    series_bit_reader mReader;
+    std::size_t mCount;
+    std::size_t mRead = 0;
+    wire_interval_ratio mRatio;
+    bits_t mPrevious = 0;
+    std::uint64_t mDelta = 0;
+    int mLeading = 0;
+    int mTrailing = 0;
+
+}; // end of class series_decoder
+
+//------------------------------------------------------------------------------
+/// the number of values in the series block aBlock; std::nullopt if it is
+/// not a series block of any units_t
+inline
+std::optional<std::size_t>
+series_count
+(
+    std::span<const std::byte> aBlock
+)
+{
+    if( aBlock.size() < series_header_size ||
+        aBlock[0] != std::byte{'s'} || aBlock[1] != std::byte{'i'} ||
+        aBlock[2] != std::byte{'c'} || aBlock[3] != std::byte{'1'} )
+    {
+        return std::nullopt;
+    }
+    return static_cast<std::size_t>(get_wire_field(aBlock, 32));
+}
+
+//------------------------------------------------------------------------------
+/// the values of the series block aBlock as UnitsT; std::nullopt if it is
+/// not a series block of the quantity and value_t of UnitsT, or is truncated
+template< typename UnitsT >
+inline
+std::optional<std::vector<UnitsT>>
+decode_series
+(
+    std::span<const std::byte> aBlock
+)
+{
+    auto theDecoder = series_decoder<UnitsT>::open(aBlock);
+    if( !theDecoder )
+    {
+        return std::nullopt;
+    }
+
+    std::vector<UnitsT> theResult(theDecoder->size());
+    theDecoder->read(theResult);
+    if( !theDecoder->good() )
+    {
+        return std::nullopt;
+    }
+    return theResult;
+}
+
+} // end of namespace si
@@ -0,0 +1,282 @@
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+#include "atomic-units.hpp"
+#include "units.hpp"
+
+namespace si
+{
+
+//------------------------------------------------------------------------------
+/// the totals of a sharded_accumulator. minimum and maximum are UnitsT::max()
+/// and UnitsT::min() while count is zero.
+template< typename UnitsT >
+struct accumulator_snapshot
+{
+    UnitsT sum;
+    std::uint64_t count;
+    UnitsT minimum;
+    UnitsT maximum;
+};
+
+//------------------------------------------------------------------------------
+/// Class sharded_accumulator accumulates the sum, count, minimum and maximum
+/// of units_t added from many threads. Each thread adds to a slot of its
+/// own, on its own cache line, that it takes on its first add and gives
+/// back when it exits, with the totals kept for the next thread to take it.
+/// As a slot has a single writer, an add is a few plain loads and stores
+/// with no read-modify-write. snapshot merges the slots while the writers
+/// go on; a sequence number in each slot lets it read a consistent slot.
+/// Slots are never freed while the accumulator lives, so snapshot walks
+/// them without hazard pointers or epochs. The accumulator must outlive
+/// the adds made to it, but may be destroyed before the threads that made
+/// them exit.
+template< typename UnitsT >
+class sharded_accumulator
+{
+    static_assert(is_units_t<UnitsT>, "UnitsT must be a units_t");
+    static_assert(std::is_arithmetic<typename UnitsT::value_t>::value, "sharded_accumulator requires an arithmetic value_t");
+
+public:
+
+    //--------------------------------------------------------------------------
+    /// Type aliases
+    using stored_t = UnitsT;
+    using value_t = typename UnitsT::value_t;
+    using quantity_t = typename UnitsT::quantity_t;
+    using snapshot_t = accumulator_snapshot<UnitsT>;
+
+    //--------------------------------------------------------------------------
+    sharded_accumulator
+    (
+    )
+    : mState{std::make_shared<state>()}
+    , mId{next_id()}
+    {
+    }
+
+    sharded_accumulator(const sharded_accumulator&) = delete;
+    sharded_accumulator& operator=(const sharded_accumulator&) = delete;
+
+    //--------------------------------------------------------------------------
+    /// add aUnits, of any interval that converts to UnitsT without loss, to
+    /// the slot of the calling thread
+    template< typename ValueT2, typename IntervalT2 >
+    typename std::enable_if
+    <
+        std::is_convertible<units_t<ValueT2, IntervalT2, quantity_t>, UnitsT>::value
+    >::type
+    add
+    (
+        units_t<ValueT2, IntervalT2, quantity_t> aUnits
+    )
+    {
+        const value_t theValue = units_cast<UnitsT>(aUnits).value();
+        slot& theSlot = this_thread_slot();
+
+        const auto theSequence = theSlot.sequence.load(std::memory_order_relaxed);
+        theSlot.sequence.store(theSequence + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        theSlot.count.store(theSlot.count.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        theSlot.sum.store(theSlot.sum.load(std::memory_order_relaxed) + theValue, std::memory_order_relaxed);
+        theSlot.minimum.store(std::min(theSlot.minimum.load(std::memory_order_relaxed), theValue), std::memory_order_relaxed);
+        theSlot.maximum.store(std::max(theSlot.maximum.load(std::memory_order_relaxed), theValue), std::memory_order_relaxed);
+        theSlot.sequence.store(theSequence + 2, std::memory_order_release);
+    }
+
+    //--------------------------------------------------------------------------
+    /// the totals of all slots. Each slot is read consistently, but adds to
+    /// different slots that run meanwhile may or may not be included.
+    snapshot_t
+    snapshot
+    (
+    ) const
+    {
+        snapshot_t theTotals{UnitsT::zero(), 0, UnitsT::max(), UnitsT::min()};
+        for( const slot* theSlot = mState->head.load(std::memory_order_acquire); theSlot != nullptr; theSlot = theSlot->next )
+        {
+            value_t theSum;
+            std::uint64_t theCount;
+            value_t theMinimum;
+            value_t theMaximum;
+            for( ;; )
+            {
+                const auto theSequence = theSlot->sequence.load(std::memory_order_acquire);
+                theCount = theSlot->count.load(std::memory_order_relaxed);
+                theSum = theSlot->sum.load(std::memory_order_relaxed);
+                theMinimum = theSlot->minimum.load(std::memory_order_relaxed);
+                theMaximum = theSlot->maximum.load(std::memory_order_relaxed);
+                std::atomic_thread_fence(std::memory_order_acquire);
+                if( theSequence % 2 == 0 && theSlot->sequence.load(std::memory_order_relaxed) == theSequence )
+                {
+                    break;
+                }
+            }
+
+            theTotals.sum += UnitsT{theSum};
+            theTotals.count += theCount;
+            theTotals.minimum = std::min(theTotals.minimum, UnitsT{theMinimum});
+            theTotals.maximum = std::max(theTotals.maximum, UnitsT{theMaximum});
+        }
+        return theTotals;
+    }
+
+    //--------------------------------------------------------------------------
+    /// the number of slots taken so far, at most the number of threads that
+    /// added at the same time
+    std::size_t
+    slot_count
+    (
+    ) const
+    {
+        std::size_t theCount = 0;
+        for( const slot* theSlot = mState->head.load(std::memory_order_acquire); theSlot != nullptr; theSlot = theSlot->next )
+        {
+            ++theCount;
+        }
+        return theCount;
+    }
+
+private:
+
+    //--------------------------------------------------------------------------
+    struct alignas(cache_line_size) slot
+    {
+        std::atomic<std::uint64_t> sequence{0};
+        std::atomic<std::uint64_t> count{0};
+        std::atomic<value_t> sum{value_t{}};
+        std::atomic<value_t> minimum{UnitsT::max().value()};
+        std::atomic<value_t> maximum{UnitsT::min().value()};
+        std::atomic<bool> taken{true};
+        slot* next{nullptr};
+    };
+
+    //--------------------------------------------------------------------------
+    /// the slots, shared with the threads that hold one so that they can give
+    /// it back when they exit after the accumulator
+    struct state
+    {
+        std::atomic<slot*> head{nullptr};
+
+        ~state()
+        {
+            for( slot* theSlot = head.load(std::memory_order_acquire); theSlot != nullptr; )
+            {
+                slot* theNext = theSlot->next;
+                delete theSlot;
+                theSlot = theNext;
+            }
+        }
+    };
+
+    //--------------------------------------------------------------------------
+    /// the slots a thread holds, given back when it exits
+    struct thread_slots
+    {
+        struct entry
+        {
+            std::uint64_t id;
+            std::weak_ptr<state> owner;
+            slot* held;
+        };
+
+        std::uint64_t last_id{0};
+        slot* last_slot{nullptr};
+        std::vector<entry> entries;
+
+        ~thread_slots()
+        {
+            for( auto& theEntry : entries )
+            {
+                if( const auto theOwner = theEntry.owner.lock() )
+                {
+                    theEntry.held->taken.store(false, std::memory_order_release);
+                }
+            }
+        }
+    };
+
+    //--------------------------------------------------------------------------
+    /// a distinct id for each accumulator, never reused, so that the slots of
+    /// the threads are not confused with those of a destroyed accumulator
+    static
+    std::uint64_t
+    next_id
+    (
+    )
+    {
+        static std::atomic<std::uint64_t> theNextId{1};
+        return theNextId.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    //--------------------------------------------------------------------------
+    static
+    thread_slots&
+    this_thread_slots
+    (
+    )
+    {
+        thread_local thread_slots theSlots;
+        return theSlots;
+    }
+
+    //--------------------------------------------------------------------------
+    slot&
+    this_thread_slot
+    (
+    )
+    {
+        auto& theSlots = this_thread_slots();
+        if( theSlots.last_id == mId )
+        {
+            return *theSlots.last_slot;
+        }
+
+        // the entries of destroyed accumulators are dropped on the way
+        std::erase_if(theSlots.entries, [](const auto& aEntry) {return aEntry.owner.expired();});
+        auto theEntry = std::find_if(theSlots.entries.begin(), theSlots.entries.end(), [this](const auto& aEntry) {return aEntry.id == mId;});
+        if( theEntry == theSlots.entries.end() )
+        {
+            theSlots.entries.push_back({mId, mState, take_slot()});
+            theEntry = theSlots.entries.end() - 1;
+        }
+        theSlots.last_id = mId;
+        theSlots.last_slot = theEntry->held;
+        return *theEntry->held;
+    }
+
+    //--------------------------------------------------------------------------
+    /// a slot given back by an exited thread, or else a new one
+    slot*
+    take_slot
+    (
+    )
+    {
+        for( slot* theSlot = mState->head.load(std::memory_order_acquire); theSlot != nullptr; theSlot = theSlot->next )
+        {
+            bool isTaken = false;
+            if( theSlot->taken.compare_exchange_strong(isTaken, true, std::memory_order_acquire) )
+            {
+                return theSlot;
+            }
+        }
+
+        slot* theSlot = new slot;
+        theSlot->next = mState->head.load(std::memory_order_relaxed);
+        while( !mState->head.compare_exchange_weak(theSlot->next, theSlot, std::memory_order_release, std::memory_order_relaxed) )
+        {
+        }
+        return theSlot;
+    }
+
+    std::shared_ptr<state> mState;
+    std::uint64_t mId;
+
+}; // end of class sharded_accumulator
+
+} // end of namespace si
@@ -0,0 +1,5 @@
+//------------------------------------------------------------------------------
+/// units_cast from std::chrono::duration, and duration_cast
+export module si:chrono;
+
+export import "units-chrono.hpp";
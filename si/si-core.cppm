@@ -0,0 +1,5 @@
+//------------------------------------------------------------------------------
+/// quantity_t, units_t and its aliases, arithmetic, comparison and units_cast
+export module si:core;
+
+export import "units-core.hpp";
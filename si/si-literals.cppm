@@ -0,0 +1,5 @@
+//------------------------------------------------------------------------------
+/// the literals of si::literals, and the physical constants
+export module si:literals;
+
+export import "units-literals.hpp";
@@ -0,0 +1,5 @@
+//------------------------------------------------------------------------------
+/// the math functions, and std::complex values
+export module si:math;
+
+export import "units-math.hpp";
@@ -0,0 +1,12 @@
+//------------------------------------------------------------------------------
+/// The si module: units_t, quantity_t, their aliases, chrono interop, math
+/// functions, literals and constants. Each partition exports one of the
+/// headers of units.hpp as a header unit, so that the headers and their
+/// macro-generated constants are compiled once, into the module. Formatting
+/// is not exported yet: include units-io.hpp.
+export module si;
+
+export import :core;
+export import :chrono;
+export import :math;
+export import :literals;
@@ -0,0 +1,805 @@
+#pragma once
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <numeric>
+#include <optional>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+#include "units.hpp"
+
+namespace si
+{
+
+//------------------------------------------------------------------------------
+/// the exponents of mass, length, time, current, temperature, luminous
+/// intensity, substance and angle of QuantityT
+template< typename QuantityT >
+constexpr
+std::array<std::intmax_t, 8>
+quantity_exponents
+(
+)
+{
+    return
+    {
+        QuantityT::mass::value,
+        QuantityT::length::value,
+        QuantityT::time::value,
+        QuantityT::current::value,
+        QuantityT::temperature::value,
+        QuantityT::luminous_intensity::value,
+        QuantityT::substance::value,
+        QuantityT::angle::value
+    };
+}
+
+//------------------------------------------------------------------------------
+/// the units a unit symbol stands for: the exponents of its quantity, as
+/// quantity_exponents gives them, and its interval num/den in the units of
+/// units_t, with mass in kilograms
+struct unit_descriptor
+{
+    std::array<std::intmax_t, 8> exponents{};
+    std::intmax_t num = 1;
+    std::intmax_t den = 1;
+
+    friend constexpr bool operator==(const unit_descriptor&, const unit_descriptor&) = default;
+};
+
+//------------------------------------------------------------------------------
+template< typename UnitsT >
+constexpr
+unit_descriptor
+unit_descriptor_of
+(
+)
+{
+    static_assert(is_units_t<UnitsT>, "UnitsT must be a units_t");
+    return {quantity_exponents<typename UnitsT::quantity_t>(), UnitsT::interval_t::num, UnitsT::interval_t::den};
+}
+
+//------------------------------------------------------------------------------
+/// an SI prefix and its power of ten. The first prefix of a power is the one
+/// written; the others are also read.
+struct unit_prefix
+{
+    std::string_view symbol;
+    int exponent;
+};
+
+inline constexpr unit_prefix unit_prefixes[] =
+{
+    {"E", 18},
+    {"P", 15},
+    {"T", 12},
+    {"G", 9},
+    {"M", 6},
+    {"k", 3},
+    {"h", 2},
+    {"da", 1},
+    {"d", -1},
+    {"c", -2},
+    {"m", -3},
+    {"\u00B5", -6},
+    {"\u03BC", -6},
+    {"u", -6},
+    {"n", -9},
+    {"p", -12},
+    {"f", -15},
+    {"a", -18}
+};
+
+//------------------------------------------------------------------------------
+/// a unit with a symbol of its own, its interval in the units of units_t,
+/// and whether it takes an SI prefix
+struct unit_name
+{
+    std::string_view symbol;
+    std::array<std::intmax_t, 8> exponents;
+    std::intmax_t num;
+    std::intmax_t den;
+    bool is_prefixed;
+};
+
+inline constexpr unit_name unit_names[] =
+{
+    {"g", quantity_exponents<mass>(), 1, 1000, true},
+    {abbrev<char, length>, quantity_exponents<length>(), 1, 1, true},
+    {abbrev<char, time>, quantity_exponents<time>(), 1, 1, true},
+    {"min", quantity_exponents<time>(), 60, 1, false},
+    {"h", quantity_exponents<time>(), 3600, 1, false},
+    {"d", quantity_exponents<time>(), 86400, 1, false},
+    {abbrev<char, current>, quantity_exponents<current>(), 1, 1, true},
+    {abbrev<char, temperature>, quantity_exponents<temperature>(), 1, 1, true},
+    {abbrev<char, luminous_intensity>, quantity_exponents<luminous_intensity>(), 1, 1, true},
+    {abbrev<char, substance>, quantity_exponents<substance>(), 1, 1, true},
+    {abbrev<char, angle>, quantity_exponents<angle>(), 1, 1, true},
+    {abbrev<char, solid_angle>, quantity_exponents<solid_angle>(), 1, 1, true},
+    {abbrev<char, frequency>, quantity_exponents<frequency>(), 1, 1, true},
+    {abbrev<char, force>, quantity_exponents<force>(), 1, 1, true},
+    {abbrev<char, pressure>, quantity_exponents<pressure>(), 1, 1, true},
+    {abbrev<char, energy>, quantity_exponents<energy>(), 1, 1, true},
+    {abbrev<char, power>, quantity_exponents<power>(), 1, 1, true},
+    {abbrev<char, charge>, quantity_exponents<charge>(), 1, 1, true},
+    {abbrev<char, voltage>, quantity_exponents<voltage>(), 1, 1, true},
+    {abbrev<char, capacitance>, quantity_exponents<capacitance>(), 1, 1, true},
+    {abbrev<char, impedance>, quantity_exponents<impedance>(), 1, 1, true},
+    {"\u03A9", quantity_exponents<impedance>(), 1, 1, true},
+    {abbrev<char, conductance>, quantity_exponents<conductance>(), 1, 1, true},
+    {abbrev<char, magnetic_flux>, quantity_exponents<magnetic_flux>(), 1, 1, true},
+    {abbrev<char, magnetic_flux_density>, quantity_exponents<magnetic_flux_density>(), 1, 1, true},
+    {abbrev<char, inductance>, quantity_exponents<inductance>(), 1, 1, true},
+    {abbrev<char, luminous_flux>, quantity_exponents<luminous_flux>(), 1, 1, true},
+    {abbrev<char, illuminance>, quantity_exponents<illuminance>(), 1, 1, true}
+};
+
+//------------------------------------------------------------------------------
+/// aNum/aDen as a power of ten, if it is one
+constexpr
+std::optional<int>
+decimal_exponent
+(
+    std::intmax_t aNum,
+    std::intmax_t aDen
+)
+{
+    int theExponent = 0;
+    for( ; aNum % 10 == 0; aNum /= 10 )
+    {
+        ++theExponent;
+    }
+    for( ; aDen % 10 == 0; aDen /= 10 )
+    {
+        --theExponent;
+    }
+    if( aNum != 1 || aDen != 1 )
+    {
+        return std::nullopt;
+    }
+    return theExponent;
+}
+
+//------------------------------------------------------------------------------
+/// the symbol of the SI prefix of aExponent, if there is one
+constexpr
+std::optional<std::string_view>
+prefix_symbol
+(
+    int aExponent
+)
+{
+    if( aExponent == 0 )
+    {
+        return std::string_view{};
+    }
+    for( const auto& thePrefix : unit_prefixes )
+    {
+        if( thePrefix.exponent == aExponent )
+        {
+            return thePrefix.symbol;
+        }
+    }
+    return std::nullopt;
+}
+
+//------------------------------------------------------------------------------
+/// Class unit_symbol_writer counts, and writes when given room, the
+/// characters of a unit symbol.
+class unit_symbol_writer
+{
+public:
+
+    //--------------------------------------------------------------------------
+    constexpr
+    unit_symbol_writer
+    (
+        char* aOut
+    )
+    : mOut{aOut}
+    {
+    }
+
+    //--------------------------------------------------------------------------
+    constexpr
+    void
+    append
+    (
+        std::string_view aString
+    )
+    {
+        for( const char theChar : aString )
+        {
+            if( mOut != nullptr )
+            {
+                mOut[mSize] = theChar;
+            }
+            ++mSize;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    /// append the factors of the positive exponents of aExponents times
+    /// aSign, as the string_from of a quantity_t writes them
+    constexpr
+    void
+    append_factors
+    (
+        const std::array<std::intmax_t, 8>& aExponents,
+        std::intmax_t aSign
+    )
+    {
+        constexpr const char* theBases[] =
+        {
+            abbrev<char, mass>,
+            abbrev<char, length>,
+            abbrev<char, time>,
+            abbrev<char, current>,
+            abbrev<char, temperature>,
+            abbrev<char, luminous_intensity>,
+            abbrev<char, substance>,
+            abbrev<char, angle>
+        };
+
+        bool isFirst = true;
+        for( std::size_t i = 0; i < aExponents.size(); ++i )
+        {
+            const std::intmax_t theExponent = aExponents[i] * aSign;
+            if( theExponent <= 0 )
+            {
+                continue;
+            }
+            if( !isFirst )
+            {
+                append(multiply_operator<char>);
+            }
+            append(theBases[i]);
+            if( theExponent > 1 )
+            {
+                append_superscript(theExponent);
+            }
+            isFirst = false;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    constexpr std::size_t size() const {return mSize;}
+
+private:
+
+    //--------------------------------------------------------------------------
+    constexpr
+    void
+    append_superscript
+    (
+        std::intmax_t aExponent
+    )
+    {
+        if( aExponent >= 10 )
+        {
+            append_superscript(aExponent / 10);
+        }
+        append(superscript_digit<char>[aExponent % 10]);
+    }
+
+    char* mOut;
+    std::size_t mSize = 0;
+
+}; // end of class unit_symbol_writer
+
+//------------------------------------------------------------------------------
+/// write the symbol of UnitsT to aWriter and return true, or return false if
+/// UnitsT has none. A quantity with a symbol of its own takes an SI prefix,
+/// as in kW, ms and mg, and a time also the names min, h and d. Other
+/// quantities are written as the string_from of a quantity_t writes them,
+/// as in m/s², and only in the interval one. A dimensionless value in the
+/// interval one has the empty symbol.
+template< typename UnitsT >
+constexpr
+bool
+write_unit_symbol
+(
+    unit_symbol_writer& aWriter
+)
+{
+    static_assert(is_units_t<UnitsT>, "UnitsT must be a units_t");
+    using Quantity_t = typename UnitsT::quantity_t;
+    using Interval_t = typename UnitsT::interval_t;
+    constexpr auto theExponents = quantity_exponents<Quantity_t>();
+
+    if constexpr( std::is_same<Quantity_t, time>::value )
+    {
+        for( const auto& theName : unit_names )
+        {
+            if( !theName.is_prefixed && theName.num == Interval_t::num && theName.den == Interval_t::den )
+            {
+                aWriter.append(theName.symbol);
+                return true;
+            }
+        }
+    }
+
+    if constexpr( std::is_same<Quantity_t, none>::value )
+    {
+        return Interval_t::num == 1 && Interval_t::den == 1;
+    }
+    else if constexpr( std::is_same<Quantity_t, mass>::value )
+    {
+        const auto theExponent = decimal_exponent(Interval_t::num, Interval_t::den);
+        const auto thePrefix = theExponent ? prefix_symbol(*theExponent + 3) : std::nullopt;
+        if( !thePrefix )
+        {
+            return false;
+        }
+        aWriter.append(*thePrefix);
+        aWriter.append("g");
+        return true;
+    }
+    else if constexpr( abbrev<char, Quantity_t> != nullptr )
+    {
+        const auto theExponent = decimal_exponent(Interval_t::num, Interval_t::den);
+        const auto thePrefix = theExponent ? prefix_symbol(*theExponent) : std::nullopt;
+        if( !thePrefix )
+        {
+            return false;
+        }
+        aWriter.append(*thePrefix);
+        aWriter.append(abbrev<char, Quantity_t>);
+        return true;
+    }
+    else
+    {
+        if( Interval_t::num != 1 || Interval_t::den != 1 )
+        {
+            return false;
+        }
+
+        unit_symbol_writer theNumerator{nullptr};
+        theNumerator.append_factors(theExponents, 1);
+        unit_symbol_writer theDenominator{nullptr};
+        theDenominator.append_factors(theExponents, -1);
+        if( theNumerator.size() == 0 )
+        {
+            aWriter.append(one<char>);
+        }
+        aWriter.append_factors(theExponents, 1);
+        if( theDenominator.size() != 0 )
+        {
+            aWriter.append(divide_operator<char>);
+            aWriter.append_factors(theExponents, -1);
+        }
+        return true;
+    }
+}
+
+//------------------------------------------------------------------------------
+/// true if UnitsT has a unit symbol
+template< typename UnitsT >
+constexpr bool has_unit_symbol = []
+{
+    unit_symbol_writer theWriter{nullptr};
+    return write_unit_symbol<UnitsT>(theWriter);
+}();
+
+//------------------------------------------------------------------------------
+/// the characters of the unit symbol of UnitsT, built once at compile time
+template< typename UnitsT >
+struct unit_symbol_storage
+{
+    static_assert(has_unit_symbol<UnitsT>, "UnitsT has no unit symbol");
+
+    static constexpr std::size_t size = []
+    {
+        unit_symbol_writer theWriter{nullptr};
+        write_unit_symbol<UnitsT>(theWriter);
+        return theWriter.size();
+    }();
+
+    static constexpr std::array<char, size + 1> chars = []
+    {
+        std::array<char, size + 1> theChars{};
+        unit_symbol_writer theWriter{theChars.data()};
+        write_unit_symbol<UnitsT>(theWriter);
+        return theChars;
+    }();
+};
+
+//------------------------------------------------------------------------------
+/// the unit symbol of UnitsT, such as "kW" for watts<std::kilo>, in UTF-8
+template< typename UnitsT >
+inline constexpr std::string_view unit_symbol{unit_symbol_storage<UnitsT>::chars.data(), unit_symbol_storage<UnitsT>::size};
+
+//------------------------------------------------------------------------------
+/// aDescriptor with its interval times aNum/aDen, reduced; std::nullopt if
+/// it overflows
+constexpr
+std::optional<unit_descriptor>
+scale_unit_descriptor
+(
+    unit_descriptor aDescriptor,
+    std::intmax_t aNum,
+    std::intmax_t aDen
+)
+{
+    const std::intmax_t theNumGcd = std::gcd(aNum, aDescriptor.den);
+    const std::intmax_t theDenGcd = std::gcd(aDen, aDescriptor.num);
+    const std::intmax_t theNum1 = aDescriptor.num / theDenGcd;
+    const std::intmax_t theNum2 = aNum / theNumGcd;
+    const std::intmax_t theDen1 = aDescriptor.den / theNumGcd;
+    const std::intmax_t theDen2 = aDen / theDenGcd;
+    constexpr std::intmax_t theMax = std::numeric_limits<std::intmax_t>::max();
+    if( theNum1 > theMax / theNum2 || theDen1 > theMax / theDen2 )
+    {
+        return std::nullopt;
+    }
+    aDescriptor.num = theNum1 * theNum2;
+    aDescriptor.den = theDen1 * theDen2;
+    return aDescriptor;
+}
+
+//------------------------------------------------------------------------------
+/// the exponent at the end of the factor aFactor, in superscript digits as
+/// unit_symbol writes them or in ASCII, as in m², m^2 or m2, and the length
+/// of the factor before it; an exponent of one if there is none
+constexpr
+std::optional<std::pair<std::size_t, std::intmax_t>>
+parse_unit_exponent
+(
+    std::string_view aFactor
+)
+{
+    // the exponent begins at the first character that may be part of one
+    const auto isExponentAt = [aFactor](std::size_t aIndex)
+    {
+        const std::string_view theRest = aFactor.substr(aIndex);
+        if( theRest[0] == '^' || theRest[0] == '-' || (theRest[0] >= '0' && theRest[0] <= '9') || theRest.starts_with(superscript_minus<char>) )
+        {
+            return true;
+        }
+        for( const char* theDigit : superscript_digit<char> )
+        {
+            if( theRest.starts_with(theDigit) )
+            {
+                return true;
+            }
+        }
+        return false;
+    };
+
+    std::size_t theStart = 0;
+    while( theStart < aFactor.size() && !isExponentAt(theStart) )
+    {
+        ++theStart;
+    }
+    std::string_view theRest = aFactor.substr(theStart);
+    if( theRest.empty() )
+    {
+        return std::pair<std::size_t, std::intmax_t>{aFactor.size(), 1};
+    }
+
+    if( theRest[0] == '^' )
+    {
+        theRest.remove_prefix(1);
+    }
+    bool isNegative = false;
+    if( theRest.starts_with('-') || theRest.starts_with(superscript_minus<char>) )
+    {
+        isNegative = true;
+        theRest.remove_prefix(theRest[0] == '-' ? 1 : std::string_view{superscript_minus<char>}.size());
+    }
+
+    std::intmax_t theExponent = 0;
+    bool hasDigits = false;
+    while( !theRest.empty() && theExponent < 1000 )
+    {
+        int theDigit = -1;
+        std::size_t theLength = 1;
+        if( theRest[0] >= '0' && theRest[0] <= '9' )
+        {
+            theDigit = theRest[0] - '0';
+        }
+        else
+        {
+            for( int i = 0; i < digit_count; ++i )
+            {
+                if( theRest.starts_with(superscript_digit<char>[i]) )
+                {
+                    theDigit = i;
+                    theLength = std::string_view{superscript_digit<char>[i]}.size();
+                }
+            }
+        }
+        if( theDigit < 0 )
+        {
+            return std::nullopt;
+        }
+        theExponent = theExponent * 10 + theDigit;
+        theRest.remove_prefix(theLength);
+        hasDigits = true;
+    }
+    if( !hasDigits || !theRest.empty() || theExponent == 0 )
+    {
+        return std::nullopt;
+    }
+    return std::pair<std::size_t, std::intmax_t>{theStart, isNegative ? -theExponent : theExponent};
+}
+
+//------------------------------------------------------------------------------
+/// the units of aName with the prefix aPrefix
+constexpr
+std::optional<unit_descriptor>
+prefixed_unit
+(
+    const unit_prefix& aPrefix,
+    const unit_name& aName
+)
+{
+    std::intmax_t thePower = 1;
+    for( int i = 0; i < (aPrefix.exponent < 0 ? -aPrefix.exponent : aPrefix.exponent); ++i )
+    {
+        thePower *= 10;
+    }
+    return aPrefix.exponent < 0 ?
+        scale_unit_descriptor({aName.exponents, aName.num, aName.den}, 1, thePower) :
+        scale_unit_descriptor({aName.exponents, aName.num, aName.den}, thePower, 1);
+}
+
+//------------------------------------------------------------------------------
+/// the unit of the symbol aSymbol, without exponent: a unit name, or an SI
+/// prefix and a unit name that takes one
+constexpr
+std::optional<unit_descriptor>
+parse_unit_name
+(
+    std::string_view aSymbol
+)
+{
+    for( const auto& theName : unit_names )
+    {
+        if( theName.symbol == aSymbol )
+        {
+            return unit_descriptor{theName.exponents, theName.num, theName.den};
+        }
+    }
+
+    for( const auto& thePrefix : unit_prefixes )
+    {
+        if( !aSymbol.starts_with(thePrefix.symbol) )
+        {
+            continue;
+        }
+        for( const auto& theName : unit_names )
+        {
+            if( theName.is_prefixed && theName.symbol == aSymbol.substr(thePrefix.symbol.size()) )
+            {
+                return prefixed_unit(thePrefix, theName);
+            }
+        }
+    }
+    return std::nullopt;
+}
+
+//------------------------------------------------------------------------------
+/// the units of the unit symbol aSymbol, as unit_symbol writes them or as
+/// people type them: factors of prefixed unit names with exponents, joined
+/// by '·', '*' or '.', with at most one '/', as in kW, ms, m/s², kg*m^2 and
+/// 1/s. Spaces around the symbol are ignored; the empty symbol is
+/// dimensionless. std::nullopt if aSymbol is not a unit symbol.
+constexpr
+std::optional<unit_descriptor>
+parse_unit_symbol
+(
+    std::string_view aSymbol
+)
+{
+    while( aSymbol.starts_with(' ') )
+    {
+        aSymbol.remove_prefix(1);
+    }
+    while( aSymbol.ends_with(' ') )
+    {
+        aSymbol.remove_suffix(1);
+    }
+
+    std::optional<unit_descriptor> theResult = unit_descriptor{};
+    std::intmax_t theSign = 1;
+    bool isFirst = true;
+    while( theResult && !aSymbol.empty() )
+    {
+        // the next factor and the separator that ends it
+        const std::string_view theMultiply = multiply_operator<char>;
+        std::size_t theEnd = 0;
+        std::size_t theSeparator = 0;
+        bool isDivide = false;
+        for( ; theEnd < aSymbol.size(); ++theEnd )
+        {
+            if( aSymbol[theEnd] == '*' || aSymbol[theEnd] == '.' || aSymbol[theEnd] == '/' )
+            {
+                theSeparator = 1;
+                isDivide = aSymbol[theEnd] == '/';
+                break;
+            }
+            if( aSymbol.substr(theEnd).starts_with(theMultiply) )
+            {
+                theSeparator = theMultiply.size();
+                break;
+            }
+        }
+
+        const std::string_view theFactor = aSymbol.substr(0, theEnd);
+        aSymbol.remove_prefix(theEnd + theSeparator);
+        if( theSeparator != 0 && aSymbol.empty() )
+        {
+            return std::nullopt;
+        }
+
+        if( !(isFirst && theFactor == one<char> && (isDivide || aSymbol.empty())) )
+        {
+            const auto theExponent = parse_unit_exponent(theFactor);
+            const auto theName = theExponent ? parse_unit_name(theFactor.substr(0, theExponent->first)) : std::nullopt;
+            if( !theName )
+            {
+                return std::nullopt;
+            }
+
+            const std::intmax_t thePower = theExponent->second * theSign;
+            for( std::size_t i = 0; i < theResult->exponents.size(); ++i )
+            {
+                theResult->exponents[i] += theName->exponents[i] * thePower;
+            }
+            for( std::intmax_t i = 0; theResult && i < (thePower < 0 ? -thePower : thePower); ++i )
+            {
+                theResult = thePower < 0 ?
+                    scale_unit_descriptor(*theResult, theName->den, theName->num) :
+                    scale_unit_descriptor(*theResult, theName->num, theName->den);
+            }
+        }
+
+        if( isDivide )
+        {
+            if( theSign < 0 )
+            {
+                return std::nullopt;
+            }
+            theSign = -1;
+        }
+        isFirst = false;
+    }
+    return theResult;
+}
+
+//------------------------------------------------------------------------------
+/// the FNV-1a hash of aString, continuing from aHash
+constexpr
+std::uint32_t
+unit_symbol_hash
+(
+    std::string_view aString,
+    std::uint32_t aHash = 2166136261u
+)
+{
+    for( const char theChar : aString )
+    {
+        aHash = (aHash ^ static_cast<std::uint8_t>(theChar)) * 16777619u;
+    }
+    return aHash;
+}
+
+//------------------------------------------------------------------------------
+/// an entry of unit_symbol_table: the hash of a symbol, and the indices of
+/// its unit_prefixes entry, or no_prefix, and its unit_names entry, or
+/// no_name for an empty entry
+struct unit_symbol_entry
+{
+    static constexpr std::uint16_t no_prefix = 0xffff;
+    static constexpr std::uint16_t no_name = 0xffff;
+
+    std::uint32_t hash = 0;
+    std::uint16_t prefix = no_prefix;
+    std::uint16_t name = no_name;
+};
+
+//------------------------------------------------------------------------------
+/// the symbol of aEntry as a prefix and a name
+constexpr
+std::pair<std::string_view, std::string_view>
+unit_symbol_of
+(
+    const unit_symbol_entry& aEntry
+)
+{
+    return
+    {
+        aEntry.prefix == unit_symbol_entry::no_prefix ? std::string_view{} : unit_prefixes[aEntry.prefix].symbol,
+        unit_names[aEntry.name].symbol
+    };
+}
+
+//------------------------------------------------------------------------------
+/// an open addressing hash table of every unit name, alone and with each
+/// prefix it takes, built at compile time. A name alone is entered first, so
+/// that h is an hour and not a prefix.
+inline constexpr auto unit_symbol_table = []
+{
+    // filled explicitly: GCC 12 emits {} as zeros, ignoring the member
+    // initializers of the empty entry
+    std::array<unit_symbol_entry, 1024> theTable{};
+    theTable.fill(unit_symbol_entry{});
+    const auto theInsert = [&theTable](unit_symbol_entry aEntry)
+    {
+        const auto [thePrefix, theName] = unit_symbol_of(aEntry);
+        for( std::size_t i = aEntry.hash % theTable.size(); ; i = (i + 1) % theTable.size() )
+        {
+            if( theTable[i].name == unit_symbol_entry::no_name )
+            {
+                theTable[i] = aEntry;
+                return;
+            }
+            const auto [theOtherPrefix, theOtherName] = unit_symbol_of(theTable[i]);
+            if( theTable[i].hash == aEntry.hash && theOtherPrefix.size() + theOtherName.size() == thePrefix.size() + theName.size() )
+            {
+                std::array<char, 16> theSymbol{};
+                std::array<char, 16> theOtherSymbol{};
+                thePrefix.copy(theSymbol.data(), thePrefix.size());
+                theName.copy(theSymbol.data() + thePrefix.size(), theName.size());
+                theOtherPrefix.copy(theOtherSymbol.data(), theOtherPrefix.size());
+                theOtherName.copy(theOtherSymbol.data() + theOtherPrefix.size(), theOtherName.size());
+                if( theSymbol == theOtherSymbol )
+                {
+                    return;
+                }
+            }
+        }
+    };
+
+    for( std::size_t theName = 0; theName < std::size(unit_names); ++theName )
+    {
+        theInsert({unit_symbol_hash(unit_names[theName].symbol), unit_symbol_entry::no_prefix, static_cast<std::uint16_t>(theName)});
+    }
+    for( std::size_t theName = 0; theName < std::size(unit_names); ++theName )
+    {
+        for( std::size_t thePrefix = 0; unit_names[theName].is_prefixed && thePrefix < std::size(unit_prefixes); ++thePrefix )
+        {
+            const auto theHash = unit_symbol_hash(unit_names[theName].symbol, unit_symbol_hash(unit_prefixes[thePrefix].symbol));
+            theInsert({theHash, static_cast<std::uint16_t>(thePrefix), static_cast<std::uint16_t>(theName)});
+        }
+    }
+    return theTable;
+}();
+
+//------------------------------------------------------------------------------
+/// the units of the unit symbol aSymbol, as parse_unit_symbol gives them. A
+/// prefixed unit name, such as kW, is found with one hash and one compare;
+/// other symbols are parsed.
+constexpr
+std::optional<unit_descriptor>
+find_unit_symbol
+(
+    std::string_view aSymbol
+)
+{
+    const std::uint32_t theHash = unit_symbol_hash(aSymbol);
+    for( std::size_t i = theHash % unit_symbol_table.size(); unit_symbol_table[i].name != unit_symbol_entry::no_name; i = (i + 1) % unit_symbol_table.size() )
+    {
+        const auto& theEntry = unit_symbol_table[i];
+        if( theEntry.hash != theHash )
+        {
+            continue;
+        }
+        const auto [thePrefix, theName] = unit_symbol_of(theEntry);
+        if( aSymbol.size() == thePrefix.size() + theName.size() && aSymbol.starts_with(thePrefix) && aSymbol.ends_with(theName) )
+        {
+            const auto& theUnitName = unit_names[theEntry.name];
+            return theEntry.prefix == unit_symbol_entry::no_prefix ?
+                unit_descriptor{theUnitName.exponents, theUnitName.num, theUnitName.den} :
+                prefixed_unit(unit_prefixes[theEntry.prefix], theUnitName);
+        }
+    }
+    return parse_unit_symbol(aSymbol);
+}
+
+} // end of namespace si
@@ -0,0 +1,56 @@
+#pragma once
+#include <chrono>
+#include <type_traits>
+
+#include "units-core.hpp"
+
+namespace si
+{
+
+//------------------------------------------------------------------------------
+/// Convert a std::chrono::duration to si::seconds.
+template <Units ToUnitsT, typename REP, typename PERIOD>
+    requires SameQuantity<ToUnitsT, units_t<REP, PERIOD, si::time>>
+inline
+constexpr
+ToUnitsT
+units_cast
+(
+    std::chrono::duration<REP, PERIOD> aFromDuration
+)
+{
+    using FromUnitsT = units_t<REP, PERIOD, si::time>;
+    return units_cast_impl
+    <
+        FromUnitsT,
+        ToUnitsT
+    >{}(FromUnitsT{aFromDuration.count()});
+}
+
+template <typename aType>
+struct is_duration : std::false_type {};
+
+template <typename REP, typename PERIOD>
+struct is_duration<std::chrono::duration<REP, PERIOD>> : std::true_type {};
+
+//------------------------------------------------------------------------------
+/// a std::chrono::duration
+template <typename DurationT>
+concept Duration = is_duration<DurationT>::value;
+
+//------------------------------------------------------------------------------
+/// Convert an si::seconds to a std::chrono::duration.
+template<Duration ToDurationT, typename ValueT, typename IntervalT>
+inline
+constexpr
+ToDurationT
+duration_cast
+(
+    units_t<ValueT, IntervalT, si::time> aUnits
+)
+{
+    using Result_t = units_t<typename ToDurationT::rep, typename ToDurationT::period, si::time>;
+    return ToDurationT{units_cast<Result_t>(aUnits).value()};
+}
+
+} // end of namespace si
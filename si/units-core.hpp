@@ -0,0 +1,947 @@
+#pragma once
+#include <compare>
+#include <cstdint>
+#include <limits>
+#include <ratio>
+#include <type_traits>
+
+#include "quantity.hpp"
+#include "ratio.hpp"
+
+namespace si
+{
+
+//------------------------------------------------------------------------------
+/// The core of units_t: the class, its aliases, arithmetic, comparison and
+/// units_cast. Formatting, chrono, math functions and literals are in
+/// units-io.hpp, units-chrono.hpp, units-math.hpp and units-literals.hpp;
+/// units.hpp includes them all.
+
+// Forward declaration
+template <typename ValueT, typename IntervalT, typename QuantityT > class units_t;
+
+template <typename aType>
+struct is_complex_impl : std::false_type {};
+
+//------------------------------------------------------------------------------
+/// true if aType is a std::complex, false otherwise; std::complex is
+/// recognized where complex.hpp is included
+template <typename aType>
+constexpr bool is_complex = is_complex_impl<typename std::decay<aType>::type>::value;
+
+template <typename ValueT>
+struct real_value_impl
+{
+    using type = ValueT;
+};
+
+//------------------------------------------------------------------------------
+/// the type of the real part of ValueT, ValueT itself if it is not complex
+template <typename ValueT>
+using real_value_t = typename real_value_impl<ValueT>::type;
+
+//------------------------------------------------------------------------------
+/// Specialize is_units_value_impl as std::true_type for a class type that may
+/// be the value_t of a units_t. Arithmetic types and, with complex.hpp,
+/// std::complex are accepted.
+template <typename ValueT>
+struct is_units_value_impl : std::bool_constant<std::is_arithmetic<ValueT>::value || is_complex<ValueT>> {};
+
+//------------------------------------------------------------------------------
+/// Specialize is_floating_value_impl as std::true_type for a class type that
+/// holds fractional values, like a floating point type. Floating point types
+/// and std::complex of floating point types are floating values.
+template <typename ValueT>
+struct is_floating_value_impl : std::is_floating_point<real_value_t<ValueT>> {};
+
+//------------------------------------------------------------------------------
+/// true if aType may be the value_t of a units_t
+template <typename aType>
+constexpr bool is_units_value = is_units_value_impl<typename std::decay<aType>::type>::value;
+
+//------------------------------------------------------------------------------
+/// true if aType is a floating point type or a value type specialized to behave as one
+template <typename aType>
+constexpr bool is_floating_value = is_floating_value_impl<typename std::decay<aType>::type>::value;
+
+template <bool IsComplex, typename... ValueT>
+struct common_value_impl
+{
+    using type = std::common_type_t<ValueT...>;
+};
+
+//------------------------------------------------------------------------------
+/// std::common_type_t of ValueT, except that the common value of a
+/// std::complex<T> and U is std::complex<std::common_type_t<T, U>>, so that
+/// std::complex<float> and double promote to std::complex<double>
+template <typename... ValueT>
+using common_value_t = typename common_value_impl<(is_complex<ValueT> || ...), ValueT...>::type;
+
+} // end of namespace si
+
+//------------------------------------------------------------------------------
+/// Specialization of std::common_type for units_t.
+template
+<
+    typename QuantityT,
+    typename ValueT1,
+    typename IntervalT1,
+    typename ValueT2,
+    typename IntervalT2
+>
+struct std::common_type
+<
+    si::units_t<ValueT1, IntervalT1, QuantityT>,
+    si::units_t<ValueT2, IntervalT2, QuantityT>
+>
+{
+    using type = si::units_t
+    <
+        si::common_value_t<ValueT1, ValueT2>,
+        si::ratio_gcd<IntervalT1, IntervalT2>,
+        QuantityT
+    >;
+};
+
+namespace si
+{
+
+template
+<
+    typename FromUnitsT,
+    typename ToUnitsT,
+    typename IntervalT = typename std::ratio_divide
+    <
+        typename FromUnitsT::interval_t,
+        typename ToUnitsT::interval_t
+    >::type,
+    bool = IntervalT::num == 1,
+    bool = IntervalT::den == 1>
+struct units_cast_impl;
+
+template
+<
+    typename FromUnitsT,
+    typename ToUnitsT,
+    typename IntervalT
+>
+struct units_cast_impl<FromUnitsT, ToUnitsT, IntervalT, true, true>
+{
+    constexpr
+    ToUnitsT operator()(FromUnitsT aFromUnits) const
+    {
+        return ToUnitsT
+        {
+            static_cast<typename ToUnitsT::value_t>(aFromUnits.value())
+        };
+    }
+};
+
+template
+<
+    typename FromUnitsT,
+    typename ToUnitsT,
+    typename IntervalT
+>
+struct units_cast_impl<FromUnitsT, ToUnitsT, IntervalT, true, false>
+{
+    constexpr
+    ToUnitsT operator()(FromUnitsT aFromUnits) const
+    {
+        using ResultValue_t = common_value_t
+        <
+            typename ToUnitsT::value_t,
+            typename FromUnitsT::value_t,
+            intmax_t
+        >;
+        return ToUnitsT
+        {
+            static_cast<typename ToUnitsT::value_t>
+            (
+                static_cast<ResultValue_t>(aFromUnits.value()) /
+                static_cast<ResultValue_t>(IntervalT::den)
+            )
+        };
+    }
+};
+
+template
+<
+    typename FromUnitsT,
+    typename ToUnitsT,
+    typename IntervalT
+>
+struct units_cast_impl<FromUnitsT, ToUnitsT, IntervalT, false, true>
+{
+    constexpr
+    ToUnitsT operator()(FromUnitsT aFromUnits) const
+    {
+        using ResultValue_t = common_value_t
+        <
+            typename ToUnitsT::value_t,
+            typename FromUnitsT::value_t,
+            intmax_t
+        >;
+        return ToUnitsT
+        {
+            static_cast<typename ToUnitsT::value_t>
+            (
+                static_cast<ResultValue_t>(aFromUnits.value()) *
+                static_cast<ResultValue_t>(IntervalT::num)
+            )
+        };
+    }
+};
+
+template
+<
+    typename FromUnitsT,
+    typename ToUnitsT,
+    typename IntervalT
+>
+struct units_cast_impl<FromUnitsT, ToUnitsT, IntervalT, false, false>
+{
+    constexpr
+    ToUnitsT operator()(FromUnitsT aFromUnits) const
+    {
+        using ResultValue_t = common_value_t
+        <
+            typename ToUnitsT::value_t,
+            typename FromUnitsT::value_t,
+            intmax_t
+        >;
+        return ToUnitsT
+        {
+            static_cast<typename ToUnitsT::value_t>
+            (
+                static_cast<ResultValue_t>(aFromUnits.value()) *
+                static_cast<ResultValue_t>(IntervalT::num) /
+                static_cast<ResultValue_t>(IntervalT::den)
+            )
+        };
+    }
+};
+
+template <typename aType>
+struct is_units_impl : std::false_type {};
+
+template <typename QuantityT, typename ValueT, typename IntervalT>
+struct is_units_impl<units_t<ValueT, IntervalT, QuantityT>> : std::true_type {};
+
+//------------------------------------------------------------------------------
+/// true if aType is a units_t, false otherwise
+template <typename aType>
+constexpr bool is_units_t = is_units_impl<typename std::decay<aType>::type>::value;
+
+//------------------------------------------------------------------------------
+/// a units_t
+template <typename UnitsT>
+concept Units = is_units_t<UnitsT>;
+
+//------------------------------------------------------------------------------
+/// two units_t of the same quantity_t, whatever their value_t and interval_t
+template <typename UnitsT1, typename UnitsT2>
+concept SameQuantity =
+    Units<UnitsT1> &&
+    Units<UnitsT2> &&
+    std::is_same<typename std::decay_t<UnitsT1>::quantity_t, typename std::decay_t<UnitsT2>::quantity_t>::value;
+
+//------------------------------------------------------------------------------
+/// The factor FromIntervalT / ToIntervalT of a conversion between intervals.
+/// is_exact is false if the factor overflows intmax_t, is_whole is true if it
+/// is an exact whole number, so that an integral value converts without loss.
+template <typename FromIntervalT, typename ToIntervalT>
+struct interval_conversion
+{
+private:
+    static constexpr intmax_t num_gcd = gcd<FromIntervalT::num, ToIntervalT::num>;
+    static constexpr intmax_t den_gcd = gcd<FromIntervalT::den, ToIntervalT::den>;
+    static constexpr intmax_t num1 = FromIntervalT::num / num_gcd;
+    static constexpr intmax_t den1 = FromIntervalT::den / den_gcd;
+    static constexpr intmax_t num2 = ToIntervalT::num / num_gcd;
+    static constexpr intmax_t den2 = ToIntervalT::den / den_gcd;
+
+public:
+    static constexpr bool is_exact = (num1 <= INTMAX_MAX / den2) && (num2 <= INTMAX_MAX / den1);
+    static constexpr bool is_whole = is_exact && (num1 * den2) % (num2 * den1) == 0;
+};
+
+//------------------------------------------------------------------------------
+/// a value that converts to ToValueT without loss of precision, i.e. not a
+/// floating value to an integral one
+template <typename FromValueT, typename ToValueT>
+concept LosslessValue =
+    is_units_value<FromValueT> &&
+    std::is_convertible<FromValueT, ToValueT>::value &&
+    (
+        is_floating_value<ToValueT> ||
+        !is_floating_value<FromValueT>
+    );
+
+//------------------------------------------------------------------------------
+/// a units_t that converts to ToUnitsT without overflow or loss of precision:
+/// the same quantity_t, a lossless value_t, and a whole interval factor unless
+/// ToUnitsT has a floating value_t
+template <typename FromUnitsT, typename ToUnitsT>
+concept LosslessConvertible =
+    SameQuantity<FromUnitsT, ToUnitsT> &&
+    interval_conversion<typename FromUnitsT::interval_t, typename ToUnitsT::interval_t>::is_exact &&
+    LosslessValue<typename FromUnitsT::value_t, typename ToUnitsT::value_t> &&
+    (
+        is_floating_value<typename ToUnitsT::value_t> ||
+        interval_conversion<typename FromUnitsT::interval_t, typename ToUnitsT::interval_t>::is_whole
+    );
+
+//------------------------------------------------------------------------------
+/// Convert a units_t to another units_t type.
+/// Both types must have the same quantity_t type.
+template <Units ToUnitsT, typename QuantityT, typename ValueT, typename IntervalT>
+    requires SameQuantity<ToUnitsT, units_t<ValueT, IntervalT, QuantityT>>
+inline
+constexpr
+ToUnitsT
+units_cast
+(
+    units_t<ValueT, IntervalT, QuantityT> aFromUnits
+)
+{
+    return units_cast_impl
+    <
+        decltype(aFromUnits),
+        ToUnitsT
+    >{}(aFromUnits);
+}
+
+// some special units_t values
+template <typename ValueT>
+struct units_values
+{
+public:
+    static constexpr ValueT zero() {return ValueT(0);}
+    static constexpr ValueT max()  {return std::numeric_limits<ValueT>::max();}
+    static constexpr ValueT min()  {return std::numeric_limits<ValueT>::lowest();}
+};
+
+// This is coming in c++ 17 but we don't have that yet
+template< class From, class To >
+constexpr bool is_convertible_v = std::is_convertible<From, To>::value;
+
+//------------------------------------------------------------------------------
+/// Class units_t represents a numeric value with associated SI units.
+template <typename ValueT, typename IntervalT, typename QuantityT>
+class units_t
+{
+    static_assert(is_units_value<ValueT>, "ValueT must be an arithmetic type, a std::complex or a specialized value type");
+    static_assert(!is_complex<ValueT> || is_floating_value<ValueT>, "a std::complex ValueT must have a floating point value_type");
+    static_assert(is_ratio<IntervalT>, "IntervalT must be of type std::ratio");
+    static_assert(std::ratio_greater<IntervalT, r_zero>::value, "IntervalT must be positive");
+    static_assert(is_quantity<QuantityT>, "QuantityT must be of type si::quantity_t" );
+
+public:
+
+    //--------------------------------------------------------------------------
+    /// Type aliases
+    using quantity_t = QuantityT;
+    using value_t = ValueT;
+    using interval_t = typename IntervalT::type;
+
+
+    //--------------------------------------------------------------------------
+    /// Static member constants
+    static constexpr auto interval = interval_t{};
+    static constexpr auto quantity = quantity_t{};
+
+    //--------------------------------------------------------------------------
+    constexpr
+    units_t
+    (
+    ) = default;
+
+    //--------------------------------------------------------------------------
+    constexpr
+    units_t
+    (
+        const units_t&
+    ) = default;
+
+    //--------------------------------------------------------------------------
+    /// Initialize a units_t from a unitless value.
+    /// This constructor will not be chosen by the compiler if it would result in loss of precision.
+    /// @param aValue the scalar value that will be stored in this object
+    template <LosslessValue<ValueT> ValueT2>
+    constexpr
+    explicit
+    units_t
+    (
+        ValueT2 aValue
+    )
+    : mValue{static_cast<value_t>(aValue)}
+    {
+    }
+
+    //--------------------------------------------------------------------------
+    /// Initialize a units_t from another units_t possibly having different value_t and interval_t types but the same quantity_t type.
+    /// This constructor will not be chosen by the compiler if it would result in overflow or loss of precision.
+    /// @param aUnits the units_t that will be converted to this units_t
+    template <typename ValueT2, typename IntervalT2>
+        requires LosslessConvertible<units_t<ValueT2, IntervalT2, QuantityT>, units_t>
+    constexpr
+    units_t
+    (
+        units_t<ValueT2, IntervalT2, QuantityT> aUnits
+    )
+    : mValue{units_cast<units_t>(aUnits).value()}
+    {
+    }
+
+    //--------------------------------------------------------------------------
+    constexpr
+    auto
+    scalar
+    (
+    )
+    {
+        return units_t<ValueT, IntervalT, none>{mValue};
+    }
+
+    //--------------------------------------------------------------------------
+    // Accessor function
+    constexpr value_t value() const {return mValue;}
+
+    //--------------------------------------------------------------------------
+    // Arithmetic functions
+    constexpr units_t operator+() const {return *this;}
+    constexpr units_t operator-() const {return units_t{-mValue};}
+    constexpr units_t& operator++() {++mValue; return *this;}
+    constexpr units_t operator++(int) {return units_t{mValue++};}
+    constexpr units_t& operator--() {--mValue; return *this;}
+    constexpr units_t operator--(int) {return units_t{mValue--};}
+    constexpr units_t& operator+=(units_t rhs) {mValue += rhs.value(); return *this;}
+    constexpr units_t& operator-=(units_t rhs) {mValue -= rhs.value(); return *this;}
+    constexpr units_t& operator*=(value_t rhs) {mValue *= rhs; return *this;}
+    constexpr units_t& operator/=(value_t rhs) {mValue /= rhs; return *this;}
+    constexpr units_t& operator%=(value_t rhs) {mValue %= rhs; return *this;}
+    constexpr units_t& operator%=(units_t rhs) {mValue %= rhs.value(); return *this;}
+
+    //--------------------------------------------------------------------------
+    // Special values
+    static constexpr units_t zero() {return units_t{units_values<value_t>::zero()};}
+    static constexpr units_t min() {return units_t{units_values<value_t>::min()};}
+    static constexpr units_t max() {return units_t{units_values<value_t>::max()};}
+
+private:
+
+    value_t mValue;
+
+}; // end of class units_t
+
+template< typename... >
+struct multiply_units_impl;
+
+template< typename First, typename... Rest >
+struct multiply_units_impl< First, Rest... >
+{
+    using previous = multiply_units_impl<Rest...>;
+
+    using type = units_t
+    <
+        common_value_t<typename First::value_t, typename previous::type::value_t>,
+        std::ratio_multiply<typename First::interval_t, typename previous::type::interval_t>,
+        multiply_quantity<typename First::quantity_t, typename previous::type::quantity_t>
+    >;
+};
+
+template< typename UnitsT >
+struct multiply_units_impl<UnitsT>
+{
+    using type = units_t
+    <
+        typename UnitsT::value_t,
+        typename UnitsT::interval_t,
+        typename UnitsT::quantity_t
+    >;
+};
+
+//------------------------------------------------------------------------------
+template< typename... UnitsT >
+using multiply_units = typename multiply_units_impl< UnitsT... >::type;
+
+//------------------------------------------------------------------------------
+template< typename Units1, typename Units2 >
+using divide_units = si::units_t
+<
+    common_value_t<typename Units1::value_t, typename Units2::value_t>,
+    std::ratio_divide<typename Units1::interval_t, typename Units2::interval_t>,
+    si::divide_quantity<typename Units1::quantity_t, typename Units2::quantity_t>
+>;
+
+template< typename RatioT, std::intmax_t Power >
+struct power_ratio_impl
+{
+    using previous = power_ratio_impl<RatioT, Power - 1>;
+    using type = std::ratio_multiply<RatioT, typename previous::type>;
+};
+
+template< typename RatioT >
+struct power_ratio_impl<RatioT, 0>
+{
+    using type = r_one;
+};
+
+template< typename UnitsT, std::intmax_t Power >
+struct power_units_impl
+{
+    using type = units_t
+    <
+        typename UnitsT::value_t,
+        typename power_ratio_impl<typename UnitsT::interval_t, Power>::type,
+        power_quantity<typename UnitsT::quantity_t, Power>
+    >;
+};
+
+//------------------------------------------------------------------------------
+template< typename UnitsT, std::intmax_t Power >
+using power_units = typename power_units_impl<UnitsT, Power>::type;
+
+//------------------------------------------------------------------------------
+template< typename UnitsT >
+using reciprocal_units = divide_units<units_t<typename UnitsT::value_t, r_one, none>, UnitsT>;
+
+//==============================================================================
+// Some useful units_t types
+template< typename IntervalT = r_one, typename ValueT = double >
+using scalar = units_t<ValueT, IntervalT, none>;
+
+template< typename IntervalT = r_one, typename ValueT = double >
+using meters = units_t<ValueT, IntervalT, length>;
+
+template< typename IntervalT = r_one, typename ValueT = double >
+using kilograms = units_t<ValueT, IntervalT, mass>;
+
+template< typename ValueT = double >
+using grams = units_t<ValueT, std::milli, mass>;
+
+template< typename IntervalT = r_one, typename ValueT = double >
+using seconds = units_t<ValueT, IntervalT, time>;
+
+template< typename ValueT = double >
+using minutes = seconds<std::ratio<60>, ValueT>;
+
+template< typename ValueT = double >
+using hours = seconds<std::ratio<60*60>, ValueT>;
+
+template< typename ValueT = double >
+using days = seconds<std::ratio<24*60*60>, ValueT>;
+
+template< typename ValueT = double >
+using milliseconds = seconds<std::milli, ValueT>;
+
+template< typename ValueT = double >
+using microseconds = seconds<std::micro, ValueT>;
+
+template< typename ValueT = double >
+using nanoseconds = seconds<std::nano, ValueT>;
+
+template< typename IntervalT = r_one, typename ValueT = double >
+using amperes = units_t<ValueT, IntervalT, current>;
+
+template< typename IntervalT = r_one, typename ValueT = double >
+using kelvins = units_t<ValueT, IntervalT, temperature>;
+
+template< typename IntervalT = r_one, typename ValueT = double >
+using candelas = units_t<ValueT, IntervalT, luminous_intensity>;
+
+template< typename IntervalT = r_one, typename ValueT = double >
+using moles = units_t<ValueT, IntervalT, substance>;
+
+template< typename IntervalT = r_one, typename ValueT = double >
+using radians = units_t<ValueT, IntervalT, angle>;
+
+template< typename IntervalT = r_one, typename ValueT = double >
+using steradians = units_t<ValueT, IntervalT, solid_angle>;
+
+template< typename IntervalT = r_one, typename ValueT = double >
+using hertz = units_t<ValueT, IntervalT, frequency>;
+
+template< typename IntervalT = r_one, typename ValueT = double >
+using newtons = units_t<ValueT, IntervalT, force>;
+
+template< typename IntervalT = r_one, typename ValueT = double >
+using coulombs = units_t<ValueT, IntervalT, charge>;
+
+template< typename IntervalT = r_one, typename ValueT = double >
+using lux = units_t<ValueT, IntervalT, illuminance>;
+
+template< typename IntervalT = r_one, typename ValueT = double >
+using pascals = units_t<ValueT, IntervalT, pressure>;
+
+template< typename IntervalT = r_one, typename ValueT = double >
+using joules = units_t<ValueT, IntervalT, energy>;
+
+template< typename IntervalT = r_one, typename ValueT = double >
+using watts = units_t<ValueT, IntervalT, power>;
+
+template< typename IntervalT = r_one, typename ValueT = double >
+using volts = units_t<ValueT, IntervalT, voltage>;
+
+template< typename IntervalT = r_one, typename ValueT = double >
+using farads = units_t<ValueT, IntervalT, capacitance>;
+
+template< typename IntervalT = r_one, typename ValueT = double >
+using ohms = units_t<ValueT, IntervalT, impedance>;
+
+template< typename IntervalT = r_one, typename ValueT = double >
+using siemens = units_t<ValueT, IntervalT, conductance>;
+
+template< typename IntervalT = r_one, typename ValueT = double >
+using webers = units_t<ValueT, IntervalT, magnetic_flux>;
+
+template< typename IntervalT = r_one, typename ValueT = double >
+using teslas = units_t<ValueT, IntervalT, magnetic_flux_density>;
+
+template< typename IntervalT = r_one, typename ValueT = double >
+using henries = units_t<ValueT, IntervalT, inductance>;
+
+template< typename IntervalT = r_one, typename ValueT = double >
+using lumens = units_t<ValueT, IntervalT, luminous_flux>;
+
+template< typename IntervalT = r_one, typename ValueT = double >
+using newton_meters = units_t<ValueT, IntervalT, torque>;
+
+//------------------------------------------------------------------------------
+/// aLHS <=> aRHS, or for a value type with only == and <, e.g. dual, the
+/// partial ordering that they give
+template <typename ValueT>
+inline
+constexpr
+auto
+compare_values
+(
+    ValueT aLHS,
+    ValueT aRHS
+)
+{
+    if constexpr( std::three_way_comparable<ValueT> )
+    {
+        return aLHS <=> aRHS;
+    }
+    else if( aLHS < aRHS )
+    {
+        return std::partial_ordering::less;
+    }
+    else if( aRHS < aLHS )
+    {
+        return std::partial_ordering::greater;
+    }
+    else if( aLHS == aRHS )
+    {
+        return std::partial_ordering::equivalent;
+    }
+    else
+    {
+        return std::partial_ordering::unordered;
+    }
+}
+
+//------------------------------------------------------------------------------
+/// units_t ==, and != by rewriting
+template <typename QuantityT, typename ValueT1, typename IntervalT1, typename ValueT2, typename IntervalT2>
+inline
+constexpr
+bool
+operator ==
+(
+    units_t<ValueT1, IntervalT1, QuantityT> aLHS,
+    units_t<ValueT2, IntervalT2, QuantityT> aRHS
+)
+{
+    if constexpr( std::is_same<decltype(aLHS), decltype(aRHS)>::value )
+    {
+        return aLHS.value() == aRHS.value();
+    }
+    else
+    {
+        using CommonUnits_t = std::common_type_t<decltype(aLHS), decltype(aRHS)>;
+        return CommonUnits_t{aLHS}.value() == CommonUnits_t{aRHS}.value();
+    }
+}
+
+//------------------------------------------------------------------------------
+/// units_t <=>, and <, >, <= and >= by rewriting
+template <typename QuantityT, typename ValueT1, typename IntervalT1, typename ValueT2, typename IntervalT2>
+inline
+constexpr
+auto
+operator <=>
+(
+    units_t<ValueT1, IntervalT1, QuantityT> aLHS,
+    units_t<ValueT2, IntervalT2, QuantityT> aRHS
+)
+{
+    if constexpr( std::is_same<decltype(aLHS), decltype(aRHS)>::value )
+    {
+        return compare_values(aLHS.value(), aRHS.value());
+    }
+    else
+    {
+        using CommonUnits_t = std::common_type_t<decltype(aLHS), decltype(aRHS)>;
+        return compare_values(CommonUnits_t{aLHS}.value(), CommonUnits_t{aRHS}.value());
+    }
+}
+
+//------------------------------------------------------------------------------
+// units_t +
+template <typename QuantityT, typename ValueT1, typename IntervalT1, typename ValueT2, typename IntervalT2>
+inline
+constexpr
+auto
+operator +
+(
+    units_t<ValueT1, IntervalT1, QuantityT> aLHS,
+    units_t<ValueT2, IntervalT2, QuantityT> aRHS
+)
+{
+    using CommonUnits_t = std::common_type_t<decltype(aLHS), decltype(aRHS)>;
+    return CommonUnits_t{CommonUnits_t{aLHS}.value() + CommonUnits_t{aRHS}.value()};
+}
+
+//------------------------------------------------------------------------------
+// units_t -
+template <typename QuantityT, typename ValueT1, typename IntervalT1, typename ValueT2, typename IntervalT2>
+inline
+constexpr
+auto
+operator -
+(
+    units_t<ValueT1, IntervalT1, QuantityT> aLHS,
+    units_t<ValueT2, IntervalT2, QuantityT> aRHS
+)
+{
+    return aLHS + (-aRHS);
+}
+
+//------------------------------------------------------------------------------
+// units_t * units_t
+template
+<
+    typename QuantityT1,
+    typename ValueT1,
+    typename IntervalT1,
+    typename QuantityT2,
+    typename ValueT2,
+    typename IntervalT2
+>
+inline
+constexpr
+auto
+operator *
+(
+    units_t<ValueT1, IntervalT1, QuantityT1> aLHS,
+    units_t<ValueT2, IntervalT2, QuantityT2> aRHS
+)
+{
+    using ResultValue_t = common_value_t<ValueT1, ValueT2>;
+    using Result_t = units_t
+    <
+        ResultValue_t,
+        std::ratio_multiply<IntervalT1, IntervalT2>,
+        multiply_quantity<QuantityT1, QuantityT2>
+    >;
+
+    return Result_t
+    {
+        static_cast<ResultValue_t>( aLHS.value() )
+        *
+        static_cast<ResultValue_t>( aRHS.value() )
+    };
+}
+
+//------------------------------------------------------------------------------
+// units_t * scalar
+template <typename ValueT1, typename IntervalT, typename QuantityT, typename ValueT2>
+inline
+constexpr
+auto
+operator *
+(
+    units_t<ValueT1, IntervalT, QuantityT> aUnits,
+    ValueT2 aScalar
+)
+{
+    return aUnits * scalar<r_one, ValueT2>{aScalar};
+}
+
+//------------------------------------------------------------------------------
+// scalar * units_t
+template <typename ValueT1, typename IntervalT, typename QuantityT, typename ValueT2>
+inline
+constexpr
+auto
+operator *
+(
+    ValueT2 aScalar,
+    units_t<ValueT1, IntervalT, QuantityT> aUnits
+)
+{
+    return aUnits * aScalar;
+}
+
+template
+<
+    typename QuantityT1,
+    typename ValueT1,
+    typename IntervalT1,
+    typename QuantityT2,
+    typename ValueT2,
+    typename IntervalT2
+>
+using diff_quantity_results_t = units_t
+<
+    common_value_t<ValueT1, ValueT2>,
+    std::ratio_divide<IntervalT1, IntervalT2>,
+    divide_quantity<QuantityT1, QuantityT2>
+>;
+
+//------------------------------------------------------------------------------
+// divide units_t by units_t, different quantity_t
+template
+<
+    typename QuantityT1,
+    typename ValueT1,
+    typename IntervalT1,
+    typename QuantityT2,
+    typename ValueT2,
+    typename IntervalT2
+>
+    requires (!std::is_same<QuantityT1, QuantityT2>::value)
+inline
+constexpr
+diff_quantity_results_t<QuantityT1, ValueT1, IntervalT1, QuantityT2, ValueT2, IntervalT2>
+operator /
+(
+    units_t<ValueT1, IntervalT1, QuantityT1> aLHS,
+    units_t<ValueT2, IntervalT2, QuantityT2> aRHS
+)
+{
+    using Result_t = diff_quantity_results_t<QuantityT1, ValueT1, IntervalT1, QuantityT2, ValueT2, IntervalT2>;
+    return Result_t{aLHS.value() / aRHS.value()};
+}
+
+//------------------------------------------------------------------------------
+// divide units_t by units_t, same quantity_t
+template
+<
+    typename QuantityT,
+    typename ValueT1,
+    typename IntervalT1,
+    typename ValueT2,
+    typename IntervalT2
+>
+inline
+constexpr
+auto
+operator /
+(
+    units_t<ValueT1, IntervalT1, QuantityT> aLHS,
+    units_t<ValueT2, IntervalT2, QuantityT> aRHS
+)
+{
+    using CommonUnits_t = std::common_type_t
+    <
+        units_t<ValueT1, IntervalT1, QuantityT>,
+        units_t<ValueT2, IntervalT2, QuantityT>
+    >;
+    return CommonUnits_t{aLHS}.value() / CommonUnits_t{aRHS}.value();
+}
+
+//------------------------------------------------------------------------------
+// divide units_t by scalar
+template
+<
+    typename ValueT1,
+    typename IntervalT,
+    typename QuantityT,
+    typename ValueT2
+>
+inline
+constexpr
+auto
+operator /
+(
+    units_t<ValueT1, IntervalT, QuantityT> aUnits,
+    ValueT2 aScalar
+)
+{
+    using ResultValue_t = common_value_t<ValueT1, ValueT2>;
+    return aUnits / scalar<r_one, ResultValue_t>{aScalar};
+}
+
+//------------------------------------------------------------------------------
+// divide scalar by units_t
+template
+<
+    typename ValueT1,
+    typename IntervalT,
+    typename QuantityT,
+    typename ValueT2
+>
+inline
+constexpr
+auto
+operator /
+(
+    ValueT2 aScalar,
+    units_t<ValueT1, IntervalT, QuantityT> aUnits
+)
+{
+    using ResultValue_t = common_value_t<ValueT1, ValueT2>;
+    return scalar<r_one, ResultValue_t>{aScalar} / aUnits;
+}
+
+//------------------------------------------------------------------------------
+// modulo units_t by scalar
+template
+<
+    typename QuantityT,
+    typename ValueT1,
+    typename IntervalT,
+    typename ValueT2
+>
+inline
+constexpr
+auto
+operator%
+(
+    units_t<ValueT1, IntervalT, QuantityT> aUnits,
+    ValueT2 aScalar
+)
+{
+    using ResultValue_t = common_value_t<ValueT1, ValueT2>;
+    using Result_t = units_t<ResultValue_t, IntervalT, QuantityT>;
+    return Result_t{Result_t{aUnits}.value() % static_cast<ResultValue_t>(aScalar)};
+}
+
+//------------------------------------------------------------------------------
+// modulo units_t by units_t
+template
+<
+    typename ValueT1,
+    typename IntervalT1,
+    typename ValueT2,
+    typename IntervalT2,
+    typename QuantityT
+>
+inline
+constexpr
+auto
+operator%
+(
+    units_t<ValueT1, IntervalT1, QuantityT> aLHS,
+    units_t<ValueT2, IntervalT2, QuantityT> aRHS
+)
+{
+    using Result_t = std::common_type_t<decltype(aLHS), decltype(aRHS)>;
+    return Result_t{Result_t{aLHS}.value() % Result_t{aRHS}.value()};
+}
+
+} // end of namespace si
@@ -0,0 +1,378 @@
+#pragma once
+#include <cstdint>
+#include <istream>
+#include <ostream>
+#include <ratio>
+#include <string>
+
+#include "constants.hpp"
+#include "units-core.hpp"
+
+namespace si
+{
+
+//------------------------------------------------------------------------------
+/// basic_string_from and the stream operators of exponent_t, std::ratio,
+/// quantity_t and units_t. units.hpp includes them; include units-io.hpp
+/// alone to format the units of units-core.hpp.
+
+template<typename CharT, std::intmax_t Exp>
+inline
+std::basic_string<CharT>
+basic_string_from
+(
+    exponent_t<Exp> aExponent
+)
+{
+    auto theExponent = aExponent.value;
+
+    std::basic_string<CharT> theSign;
+
+    if( theExponent < 0 )
+    {
+        theSign = superscript_minus<CharT>;
+        theExponent = -theExponent;
+    }
+
+    std::basic_string<CharT> theResult;
+
+    do
+    {
+        theResult = superscript_digit<CharT>[theExponent % 10] + theResult;
+        theExponent /= 10;
+    }
+    while( theExponent > 0 );
+
+    theResult = theSign + theResult;
+
+    return theResult;
+}
+
+template<typename CharT>
+inline
+std::basic_string<CharT>
+basic_string_from
+(
+    long aInt
+);
+
+template<>
+inline
+std::string
+basic_string_from<char>
+(
+    long aInt
+)
+{
+    return std::to_string(aInt);
+}
+
+template<>
+inline
+std::wstring
+basic_string_from<wchar_t>
+    (
+    long aInt
+)
+{
+    return std::to_wstring(aInt);
+}
+
+template<>
+inline
+std::u16string
+basic_string_from<char16_t>
+(
+    long aInt
+)
+{
+    const auto theString = std::to_string(aInt);
+    return std::u16string(theString.begin(), theString.end());
+}
+
+template<>
+inline
+std::u32string
+basic_string_from<char32_t>
+(
+    long aInt
+)
+{
+    const auto theString = std::to_string(aInt);
+    return std::u32string(theString.begin(), theString.end());
+}
+
+template
+<
+    typename CharT,
+    std::intmax_t Num,
+    std::intmax_t Den
+>
+inline
+std::basic_string<CharT>
+basic_string_from
+(
+    std::ratio<Num,Den> aRatio
+)
+{
+    std::basic_string<CharT> theResult;
+
+    using sci = sci_t<decltype(aRatio)>;
+
+    if( sci::ratio::num != sci::ratio::den )
+    {
+        theResult = basic_string_from<CharT>(sci::ratio::num);
+    }
+
+    if( sci::ratio::den != 1 )
+    {
+        theResult += divide_operator<CharT> + basic_string_from<CharT>(sci::ratio::den);
+    }
+
+    if( sci::exponent::value != 0 )
+    {
+        if( !theResult.empty() )
+        {
+            theResult += multiply_operator<CharT>;
+        }
+
+        theResult += basic_string_from<CharT>(10) + basic_string_from<CharT>(typename sci::exponent{});
+    }
+
+    return theResult;
+}
+
+template< typename Exp, typename CharT >
+inline
+std::basic_string<CharT>
+basic_string_from_exp
+(
+    const CharT* const aAbbreviation,
+    std::basic_string<CharT> aString = std::basic_string<CharT>{}
+)
+{
+    if( Exp::value > 0 )
+    {
+        if( !aString.empty() )
+        {
+            aString += multiply_operator<CharT>;
+        }
+
+        aString += aAbbreviation;
+
+        if( Exp::value > 1 )
+        {
+            aString += si::basic_string_from<CharT>(Exp{});
+        }
+    }
+
+    return aString;
+}
+
+STRING_CONST(one, "1");
+
+template
+<
+    typename CharT,
+    std::intmax_t M,
+    std::intmax_t L,
+    std::intmax_t T,
+    std::intmax_t C,
+    std::intmax_t Temp,
+    std::intmax_t Lum,
+    std::intmax_t S,
+    std::intmax_t A
+>
+std::basic_string<CharT>
+basic_string_from
+(
+    quantity_t<M,L,T,C,Temp,Lum,S,A> aQuantity
+)
+{
+    using Q_t = quantity_t<M,L,T,C,Temp,Lum,S,A>;
+    if( abbrev<CharT, Q_t> != nullptr )
+    {
+        return abbrev<CharT, Q_t>;
+    }
+
+    auto theNum = basic_string_from_exp<typename Q_t::mass>( abbrev<CharT,mass> );
+    theNum = basic_string_from_exp<typename Q_t::length>( abbrev<CharT,length>, std::move(theNum) );
+    theNum = basic_string_from_exp<typename Q_t::time>( abbrev<CharT,time>, std::move(theNum) );
+    theNum = basic_string_from_exp<typename Q_t::current>( abbrev<CharT,current>, std::move(theNum) );
+    theNum = basic_string_from_exp<typename Q_t::temperature>( abbrev<CharT,temperature>, std::move(theNum) );
+    theNum = basic_string_from_exp<typename Q_t::luminous_intensity>( abbrev<CharT,luminous_intensity>, std::move(theNum) );
+    theNum = basic_string_from_exp<typename Q_t::substance>( abbrev<CharT,substance>, std::move(theNum) );
+    theNum = basic_string_from_exp<typename Q_t::angle>( abbrev<CharT,angle>, std::move(theNum) );
+
+    using Recip_t = reciprocal_quantity<Q_t>;
+
+    auto theDen = basic_string_from_exp<typename Recip_t::mass>( abbrev<CharT,mass> );
+    theDen = basic_string_from_exp<typename Recip_t::length>( abbrev<CharT,length>, std::move(theDen) );
+    theDen = basic_string_from_exp<typename Recip_t::time>( abbrev<CharT,time>, std::move(theDen) );
+    theDen = basic_string_from_exp<typename Recip_t::current>( abbrev<CharT,current>, std::move(theDen) );
+    theDen = basic_string_from_exp<typename Recip_t::temperature>( abbrev<CharT,temperature>, std::move(theDen) );
+    theDen = basic_string_from_exp<typename Recip_t::luminous_intensity>( abbrev<CharT,luminous_intensity>, std::move(theDen) );
+    theDen = basic_string_from_exp<typename Recip_t::substance>( abbrev<CharT,substance>, std::move(theDen) );
+    theDen = basic_string_from_exp<typename Recip_t::angle>( abbrev<CharT,angle>, std::move(theDen) );
+
+    if( theDen.empty() )
+    {
+        return theNum;
+    }
+    else
+    {
+        if( theNum.empty() )
+        {
+            theNum = std::basic_string<CharT>( one<CharT> );
+        }
+
+        return theNum + divide_operator<CharT> + theDen;
+    }
+
+    return theNum;
+}
+
+template
+<
+    typename CharT,
+    std::intmax_t M,
+    std::intmax_t L,
+    std::intmax_t T,
+    std::intmax_t C,
+    std::intmax_t Te,
+    std::intmax_t Li,
+    std::intmax_t S,
+    std::intmax_t A
+>
+std::basic_ostream<CharT>&
+operator <<
+(
+    std::basic_ostream<CharT>& aStream,
+    quantity_t<M,L,T,C,Te,Li,S,A> aQuantity
+)
+{
+    return aStream << basic_string_from<CharT>(aQuantity);
+}
+
+STRING_CONST(space, " ");
+
+template
+<
+    typename CharT,
+    typename ValueT,
+    typename IntervalT,
+    typename QuantityT
+>
+std::basic_string<CharT>
+basic_string_from
+(
+    units_t<ValueT, IntervalT, QuantityT> aUnits
+)
+{
+    std::basic_string<CharT> theResult;
+    if( aUnits.interval.num != aUnits.interval.den )
+    {
+        theResult = basic_string_from<CharT>(aUnits.interval);
+    }
+
+    const auto theQuantityString = basic_string_from<CharT>(aUnits.quantity);
+    if( !theQuantityString.empty() )
+    {
+        if( !theResult.empty() )
+        {
+            theResult += space<CharT>;
+        }
+
+        theResult += theQuantityString;
+    }
+
+    return theResult;
+}
+
+//------------------------------------------------------------------------------
+template
+<
+    typename CharT,
+    typename ValueT,
+    typename IntervalT
+>
+std::basic_ostream<CharT>&
+operator <<
+(
+    std::basic_ostream<CharT>& aStream,
+    scalar<IntervalT, ValueT> aScalar
+)
+{
+    if( aScalar.value() != 1 )
+    {
+        aStream << aScalar.value() << multiply_operator<CharT>;
+    }
+
+    return aStream << basic_string_from<CharT>(IntervalT{});
+}
+
+//------------------------------------------------------------------------------
+template
+<
+    typename CharT,
+    typename ValueT
+>
+inline
+std::basic_ostream<CharT>&
+operator <<
+(
+    std::basic_ostream<CharT>& aStream,
+    scalar<si::r_one, ValueT> aScalar
+)
+{
+    return aStream << aScalar.value();
+}
+
+//------------------------------------------------------------------------------
+template
+<
+    typename CharT,
+    typename ValueT,
+    typename IntervalT,
+    typename QuantityT
+>
+std::basic_ostream<CharT>&
+operator <<
+(
+    std::basic_ostream<CharT>& aStream,
+    units_t<ValueT, IntervalT, QuantityT> aUnits
+)
+{
+    return aStream << aUnits.scalar() << space<CharT> << QuantityT{};
+}
+
+//------------------------------------------------------------------------------
+template
+<
+    typename CharT,
+    typename ValueT,
+    typename IntervalT,
+    typename QuantityT
+>
+std::basic_istream<CharT>&
+operator >>
+(
+    std::basic_istream<CharT>& aStream,
+    units_t<ValueT, IntervalT, QuantityT>& aUnits
+)
+{
+    if( aStream )
+    {
+        ValueT theValue;
+        aStream >> theValue;
+        if( aStream )
+        {
+            aUnits = units_t<ValueT, IntervalT, QuantityT>{theValue};
+        }
+    }
+    return aStream;
+}
+
+} // end of namespace si
+
+#include "string-from.hpp"
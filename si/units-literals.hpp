@@ -0,0 +1,106 @@
+#pragma once
+#include <numbers>
+
+#include "units-core.hpp"
+
+namespace si
+{
+
+namespace literals
+{
+
+#define literal( type, str ) \
+constexpr type<> operator "" _##str \
+( \
+    long double aValue \
+) \
+{ \
+    return type<>{aValue}; \
+} \
+ \
+constexpr type<si::r_one,long long> operator "" _##str \
+( \
+    unsigned long long aValue \
+) \
+{ \
+    return type<si::r_one,long long>{aValue}; \
+}
+
+#define literal2( type, str ) \
+constexpr type<> operator "" _##str \
+( \
+    long double aValue \
+) \
+{ \
+    return type<>{aValue}; \
+} \
+ \
+constexpr type<long long> operator "" _##str \
+( \
+    unsigned long long aValue \
+) \
+{ \
+    return type<long long>{aValue}; \
+}
+
+literal(meters,m);
+literal(kilograms, kg);
+literal2(grams, g);
+literal(seconds, s);
+literal2(minutes, min);
+literal2(hours, h);
+literal2(days, d);
+literal2(milliseconds, ms);
+literal2(microseconds, us);
+literal2(nanoseconds, ns);
+literal(amperes, A);
+literal(kelvins, K);
+literal(candelas, cd);
+literal(radians, rad);
+literal(moles, mol);
+literal(steradians, sr);
+literal(hertz, Hz);
+literal(newtons, N);
+literal(pascals, Pa);
+literal(joules, J);
+literal(watts, W);
+literal(coulombs, C);
+literal(volts, V);
+literal(farads, F);
+literal(ohms, Ω);
+literal(siemens, S);
+literal(webers, Wb);
+literal(teslas, T);
+literal(henries, H);
+literal(lumens, lm);
+literal(lux, lx);
+
+} // end of namespace literals
+
+// Some useful constants
+
+// Speed of light
+template< typename ValueT = double >
+inline constexpr auto c = meters<r_one, ValueT>{299792458} / seconds<r_one, ValueT>{1};
+
+// Planck constant
+template< typename ValueT = double >
+inline constexpr auto h = joules<r_one, ValueT>{6.62607015e-34} * seconds<r_one, ValueT>{1};
+
+// Reduced Planck constant
+template< typename ValueT = double >
+inline constexpr auto h_bar = h<ValueT> / (2 * std::numbers::pi_v<ValueT>);
+
+// Boltzmann constant
+template< typename ValueT = double >
+inline constexpr auto k = joules<r_one, ValueT>{1.380649e-23} / kelvins<r_one, ValueT>{1};
+
+// Elementary charge
+template< typename ValueT = double >
+inline constexpr auto e = coulombs<r_one, ValueT>{1.602176634e-19};
+
+// Avogadro constant
+template< typename ValueT = double >
+inline constexpr auto NA = 6.02214076e23 / moles<si::r_one, ValueT>{1};
+
+} // end of namespace si
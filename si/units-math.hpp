@@ -0,0 +1,442 @@
+#pragma once
+#include <cmath>
+#include <type_traits>
+
+#include "constexpr-math.hpp"
+#include "units-core.hpp"
+
+namespace si
+{
+
+//------------------------------------------------------------------------------
+// absolute value of a units_t, the magnitude if value_t is a std::complex
+template
+<
+    typename ValueT,
+    typename IntervalT,
+    typename QuantityT
+>
+inline
+constexpr
+units_t<real_value_t<ValueT>, IntervalT, QuantityT>
+absolute
+(
+    units_t<ValueT, IntervalT, QuantityT> aUnits
+)
+{
+    // std::abs promotes the small integer types to int
+    using std::abs;
+    return units_t<real_value_t<ValueT>, IntervalT, QuantityT>{static_cast<real_value_t<ValueT>>(abs(aUnits.value()))};
+}
+
+//------------------------------------------------------------------------------
+// floor of a units_t
+template
+<
+    Units RESULT,
+    typename ValueT,
+    typename IntervalT,
+    typename QuantityT
+>
+inline
+constexpr
+RESULT
+floor
+(
+    units_t<ValueT, IntervalT, QuantityT> aUnits
+)
+{
+    static_assert(!is_complex<ValueT>, "floor requires a real value_t");
+    auto theResult = units_cast<RESULT>(aUnits);
+    if( theResult > aUnits )
+    {
+        theResult -= RESULT{static_cast<typename RESULT::value_t>(1)};
+    }
+
+    return RESULT{static_cast<typename RESULT::value_t>(std::floor(theResult.value()))};
+}
+
+//------------------------------------------------------------------------------
+// ceiling of a units_t
+template
+<
+    Units RESULT,
+    typename ValueT,
+    typename IntervalT,
+    typename QuantityT
+>
+inline
+constexpr
+RESULT
+ceiling
+(
+    units_t<ValueT, IntervalT, QuantityT> aUnits
+)
+{
+    static_assert(!is_complex<ValueT>, "ceiling requires a real value_t");
+    auto theResult = units_cast<RESULT>(aUnits);
+    if( theResult < aUnits )
+    {
+        theResult += RESULT{static_cast<typename RESULT::value_t>(1)};
+    }
+    return RESULT{static_cast<typename RESULT::value_t>(std::ceil(theResult.value()))};
+}
+
+//------------------------------------------------------------------------------
+// round of a units_t
+template
+<
+    Units RESULT,
+    typename ValueT,
+    typename IntervalT,
+    typename QuantityT
+>
+    requires (!std::is_floating_point<typename RESULT::value_t>::value)
+inline
+constexpr
+RESULT
+round
+(
+    units_t<ValueT, IntervalT, QuantityT> aUnits
+)
+{
+    static_assert(!is_complex<ValueT>, "round requires a real value_t");
+    RESULT t0 = floor<RESULT>(aUnits);
+    RESULT t1 = t0 + RESULT{1};
+    auto diff0 = aUnits - t0;
+    auto diff1 = t1 - aUnits;
+    if (diff0 == diff1) {
+        if (t0.value() & 1)
+            return t1;
+        return t0;
+    } else if (diff0 < diff1) {
+        return t0;
+    }
+    return t1;
+}
+
+//------------------------------------------------------------------------------
+// truncate a units_t
+template
+<
+    Units RESULT,
+    typename ValueT,
+    typename IntervalT,
+    typename QuantityT
+>
+inline
+constexpr
+RESULT
+truncate
+(
+    units_t<ValueT, IntervalT, QuantityT> aUnits
+)
+{
+    static_assert(!is_complex<ValueT>, "truncate requires a real value_t");
+    auto theResult = units_cast<RESULT>(aUnits);
+    return RESULT{static_cast<typename RESULT::value_t>(std::trunc(theResult.value()))};
+}
+
+template
+<
+    typename ValueT,
+    typename IntervalT,
+    typename QuantityT,
+    typename EPSILON
+>
+using sqrt_result_t = units_t
+<
+    ValueT,
+    typename ratio_sqrt<IntervalT, EPSILON>::type,
+    root_quantity<QuantityT, 2>
+>;
+
+//------------------------------------------------------------------------------
+// square root of a units_t, by constexpr_sqrt during constant evaluation
+template
+<
+    typename ValueT,
+    typename IntervalT,
+    typename QuantityT,
+    typename EPSILON = std::ratio<1,10000000000000>
+>
+    requires is_floating_value<ValueT>
+inline
+constexpr
+sqrt_result_t<ValueT, IntervalT, QuantityT, EPSILON>
+square_root
+(
+    units_t<ValueT, IntervalT, QuantityT> aQuantity
+)
+{
+    using Result_t = sqrt_result_t<ValueT, IntervalT, QuantityT, EPSILON>;
+    if constexpr( std::is_arithmetic<ValueT>::value )
+    {
+        if( std::is_constant_evaluated() )
+        {
+            using Value_t = typename Result_t::value_t;
+            return Result_t{static_cast<Value_t>(constexpr_sqrt(static_cast<double>(aQuantity.value())))};
+        }
+    }
+    using std::sqrt;
+    return Result_t{sqrt(aQuantity.value())};
+}
+
+template
+<
+    typename ValueT,
+    typename IntervalT,
+    typename QuantityT,
+    std::intmax_t EXPONENT
+>
+struct power_result_impl;
+
+template
+<
+    typename ValueT,
+    typename IntervalT,
+    typename QuantityT
+>
+struct power_result_impl<ValueT, IntervalT, QuantityT, 0>
+{
+    using type = scalar<r_one, ValueT>;
+};
+
+template
+<
+    typename ValueT,
+    typename IntervalT,
+    typename QuantityT,
+    std::intmax_t EXPONENT
+>
+struct power_result_impl
+{
+    static_assert(EXPONENT >= 0, "si::exponentiate EXPONENT must be non-negative");
+    using temp = typename power_result_impl<ValueT, IntervalT, QuantityT, EXPONENT-1>::type;
+    using type = units_t
+    <
+        ValueT,
+        std::ratio_multiply<IntervalT, typename temp::interval_t>,
+        multiply_quantity<QuantityT, typename temp::quantity_t>
+    >;
+};
+
+template
+<
+    typename ValueT,
+    typename IntervalT,
+    typename QuantityT,
+    std::intmax_t EXPONENT
+>
+using power_result_t = typename power_result_impl<ValueT, IntervalT, QuantityT, EXPONENT>::type;
+
+template< typename ValueT >
+constexpr
+inline
+ValueT
+value_pow
+(
+    ValueT aBase,
+    std::intmax_t aExponent
+)
+{
+    if( aExponent > 0 )
+    {
+        return aBase * value_pow(aBase, aExponent - 1);
+    }
+    else
+    {
+        return 1;
+    }
+}
+
+//------------------------------------------------------------------------------
+// raise units_t to a power
+template
+<
+    std::intmax_t EXPONENT,
+    typename ValueT,
+    typename IntervalT,
+    typename QuantityT
+>
+constexpr
+inline
+power_result_t<ValueT, IntervalT, QuantityT, EXPONENT>
+exponentiate
+(
+    const units_t<ValueT, IntervalT, QuantityT>& aQuantity
+)
+{
+    using Result_t = power_result_t<ValueT, IntervalT, QuantityT, EXPONENT>;
+    return Result_t{value_pow(aQuantity.value(), EXPONENT)};
+}
+
+//------------------------------------------------------------------------------
+/// the value_t of the results of the math functions for ValueT: double for
+/// arithmetic types, ValueT itself for std::complex and specialized value types
+template< typename ValueT >
+using math_value_t = std::conditional_t<std::is_arithmetic<ValueT>::value, double, ValueT>;
+
+//------------------------------------------------------------------------------
+// sine of radians, by constexpr_sin during constant evaluation
+template
+<
+    typename ValueT,
+    typename IntervalT
+>
+inline
+constexpr
+scalar<r_one, math_value_t<ValueT>>
+sine
+(
+    radians<IntervalT, ValueT> aRadians
+)
+{
+    const auto theBaseRadians = units_cast<radians<r_one, math_value_t<ValueT>>>(aRadians);
+    if constexpr( std::is_arithmetic<ValueT>::value )
+    {
+        if( std::is_constant_evaluated() )
+        {
+            return scalar<r_one, double>{constexpr_sin(theBaseRadians.value())};
+        }
+    }
+    using std::sin;
+    return scalar<r_one, math_value_t<ValueT>>{sin(theBaseRadians.value())};
+}
+
+//------------------------------------------------------------------------------
+// cosine of radians, by constexpr_cos during constant evaluation
+template
+<
+    typename ValueT,
+    typename IntervalT
+>
+inline
+constexpr
+scalar<r_one, math_value_t<ValueT>>
+cosine
+(
+    radians<IntervalT, ValueT> aRadians
+)
+{
+    const auto theBaseRadians = units_cast<radians<r_one, math_value_t<ValueT>>>(aRadians);
+    if constexpr( std::is_arithmetic<ValueT>::value )
+    {
+        if( std::is_constant_evaluated() )
+        {
+            return scalar<r_one, double>{constexpr_cos(theBaseRadians.value())};
+        }
+    }
+    using std::cos;
+    return scalar<r_one, math_value_t<ValueT>>{cos(theBaseRadians.value())};
+}
+
+//------------------------------------------------------------------------------
+// tangent of radians, by constexpr_tan during constant evaluation
+template
+<
+    typename ValueT,
+    typename IntervalT
+>
+inline
+constexpr
+scalar<r_one, math_value_t<ValueT>>
+tangent
+(
+    radians<IntervalT, ValueT> aRadians
+)
+{
+    const auto theBaseRadians = units_cast<radians<r_one, math_value_t<ValueT>>>(aRadians);
+    if constexpr( std::is_arithmetic<ValueT>::value )
+    {
+        if( std::is_constant_evaluated() )
+        {
+            return scalar<r_one, double>{constexpr_tan(theBaseRadians.value())};
+        }
+    }
+    using std::tan;
+    return scalar<r_one, math_value_t<ValueT>>{tan(theBaseRadians.value())};
+}
+
+//------------------------------------------------------------------------------
+// arc sine of scalar, by constexpr_asin during constant evaluation
+template
+<
+    typename ValueT,
+    typename IntervalT
+>
+inline
+constexpr
+radians<r_one, math_value_t<ValueT>>
+arc_sine
+(
+    scalar<IntervalT, ValueT> aScalar
+)
+{
+    const auto theBaseScalar = units_cast<scalar<r_one, math_value_t<ValueT>>>(aScalar);
+    if constexpr( std::is_arithmetic<ValueT>::value )
+    {
+        if( std::is_constant_evaluated() )
+        {
+            return radians<r_one, double>{constexpr_asin(theBaseScalar.value())};
+        }
+    }
+    using std::asin;
+    return radians<r_one, math_value_t<ValueT>>{asin(theBaseScalar.value())};
+}
+
+//------------------------------------------------------------------------------
+// arc cosine of scalar, by constexpr_acos during constant evaluation
+template
+<
+    typename ValueT,
+    typename IntervalT
+>
+inline
+constexpr
+radians<r_one, math_value_t<ValueT>>
+arc_cosine
+(
+    scalar<IntervalT, ValueT> aScalar
+)
+{
+    const auto theBaseScalar = units_cast<scalar<r_one, math_value_t<ValueT>>>(aScalar);
+    if constexpr( std::is_arithmetic<ValueT>::value )
+    {
+        if( std::is_constant_evaluated() )
+        {
+            return radians<r_one, double>{constexpr_acos(theBaseScalar.value())};
+        }
+    }
+    using std::acos;
+    return radians<r_one, math_value_t<ValueT>>{acos(theBaseScalar.value())};
+}
+
+//------------------------------------------------------------------------------
+// arc tangent of scalar, by constexpr_atan during constant evaluation
+template
+<
+    typename ValueT,
+    typename IntervalT
+>
+inline
+constexpr
+radians<r_one, math_value_t<ValueT>>
+arc_tangent
+(
+    scalar<IntervalT, ValueT> aScalar
+)
+{
+    const auto theBaseScalar = units_cast<scalar<r_one, math_value_t<ValueT>>>(aScalar);
+    if constexpr( std::is_arithmetic<ValueT>::value )
+    {
+        if( std::is_constant_evaluated() )
+        {
+            return radians<r_one, double>{constexpr_atan(theBaseScalar.value())};
+        }
+    }
+    using std::atan;
+    return radians<r_one, math_value_t<ValueT>>{atan(theBaseScalar.value())};
+}
+
+} // end of namespace si
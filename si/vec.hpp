@@ -0,0 +1,631 @@
+#pragma once
+#include <array>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include "units.hpp"
+
+namespace si
+{
+
+template< typename UnitsT, std::size_t Size, typename = std::make_index_sequence<Size> >
+class vec;
+
+//------------------------------------------------------------------------------
+/// Class vec is a fixed-size vector whose components are all of type UnitsT,
+/// e.g. a position in meters<> or a force in newtons<>.
+template< typename UnitsT, std::size_t Size, std::size_t... Indices >
+class vec<UnitsT, Size, std::index_sequence<Indices...>>
+{
+    static_assert(is_units_t<UnitsT>, "UnitsT must be of type si::units_t");
+    static_assert(Size > 0, "Size must be positive");
+
+    template< std::size_t >
+    using component_of = UnitsT;
+
+public:
+
+    //--------------------------------------------------------------------------
+    /// Type aliases
+    using component_t = UnitsT;
+
+    //--------------------------------------------------------------------------
+    /// Static member constants
+    static constexpr std::size_t size = Size;
+
+    //--------------------------------------------------------------------------
+    constexpr
+    vec
+    (
+    ) = default;
+
+    //--------------------------------------------------------------------------
+    /// Initialize a vec from its components.
+    constexpr
+    vec
+    (
+        component_of<Indices>... aComponents
+    )
+    : mComponents{aComponents...}
+    {
+    }
+
+    //--------------------------------------------------------------------------
+    /// Initialize a vec from another vec of the same quantity.
+    /// This constructor follows the rules of the converting units_t constructor.
+    template< typename UnitsT2, typename = std::enable_if_t<std::is_convertible<UnitsT2, UnitsT>::value> >
+    constexpr
+    vec
+    (
+        const vec<UnitsT2, Size>& aVec
+    )
+    : mComponents{component_t{aVec[Indices]}...}
+    {
+    }
+
+    //--------------------------------------------------------------------------
+    // Accessor functions
+    constexpr component_t operator[](std::size_t aIndex) const {return mComponents[aIndex];}
+    constexpr component_t& operator[](std::size_t aIndex) {return mComponents[aIndex];}
+
+    //--------------------------------------------------------------------------
+    // Arithmetic functions
+    constexpr vec operator+() const {return *this;}
+    constexpr vec operator-() const {return vec{-mComponents[Indices]...};}
+    constexpr vec& operator+=(const vec& rhs) {((mComponents[Indices] += rhs[Indices]), ...); return *this;}
+    constexpr vec& operator-=(const vec& rhs) {((mComponents[Indices] -= rhs[Indices]), ...); return *this;}
+    constexpr vec& operator*=(typename component_t::value_t rhs) {((mComponents[Indices] *= rhs), ...); return *this;}
+    constexpr vec& operator/=(typename component_t::value_t rhs) {((mComponents[Indices] /= rhs), ...); return *this;}
+
+    //--------------------------------------------------------------------------
+    // Special values
+    static constexpr vec zero() {return vec{component_of<Indices>::zero()...};}
+
+private:
+
+    std::array<component_t, Size> mComponents{};
+
+}; // end of class vec
+
+//------------------------------------------------------------------------------
+// apply a function to each pair of components, producing a vec of the results
+template< typename FunctionT, typename UnitsT1, typename UnitsT2, std::size_t Size, std::size_t... Indices >
+inline
+constexpr
+auto
+transform_impl
+(
+    FunctionT aFunction,
+    const vec<UnitsT1, Size>& aLHS,
+    const vec<UnitsT2, Size>& aRHS,
+    std::index_sequence<Indices...>
+)
+{
+    using Result_t = decltype(aFunction(aLHS[0], aRHS[0]));
+    return vec<Result_t, Size>{aFunction(aLHS[Indices], aRHS[Indices])...};
+}
+
+//------------------------------------------------------------------------------
+// vec ==
+template< typename UnitsT1, typename UnitsT2, std::size_t Size >
+inline
+constexpr
+bool
+operator ==
+(
+    const vec<UnitsT1, Size>& aLHS,
+    const vec<UnitsT2, Size>& aRHS
+)
+{
+    for( std::size_t i = 0; i < Size; ++i )
+    {
+        if( aLHS[i] != aRHS[i] )
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+//------------------------------------------------------------------------------
+// vec !=
+template< typename UnitsT1, typename UnitsT2, std::size_t Size >
+inline
+constexpr
+bool
+operator !=
+(
+    const vec<UnitsT1, Size>& aLHS,
+    const vec<UnitsT2, Size>& aRHS
+)
+{
+    return !(aLHS == aRHS);
+}
+
+//------------------------------------------------------------------------------
+// vec + vec
+template< typename UnitsT1, typename UnitsT2, std::size_t Size >
+inline
+constexpr
+auto
+operator +
+(
+    const vec<UnitsT1, Size>& aLHS,
+    const vec<UnitsT2, Size>& aRHS
+)
+{
+    return transform_impl([](auto aX, auto aY){return aX + aY;}, aLHS, aRHS, std::make_index_sequence<Size>{});
+}
+
+//------------------------------------------------------------------------------
+// vec - vec
+template< typename UnitsT1, typename UnitsT2, std::size_t Size >
+inline
+constexpr
+auto
+operator -
+(
+    const vec<UnitsT1, Size>& aLHS,
+    const vec<UnitsT2, Size>& aRHS
+)
+{
+    return transform_impl([](auto aX, auto aY){return aX - aY;}, aLHS, aRHS, std::make_index_sequence<Size>{});
+}
+
+//------------------------------------------------------------------------------
+// apply a function to each component, producing a vec of the results
+template< typename FunctionT, typename UnitsT, std::size_t Size >
+inline
+constexpr
+auto
+transform_impl
+(
+    FunctionT aFunction,
+    const vec<UnitsT, Size>& aVec
+)
+{
+    using Result_t = decltype(aFunction(aVec[0]));
+    vec<Result_t, Size> theResult;
+    for( std::size_t i = 0; i < Size; ++i )
+    {
+        theResult[i] = aFunction(aVec[i]);
+    }
+    return theResult;
+}
+
+//------------------------------------------------------------------------------
+// vec * units_t
+template< typename UnitsT, std::size_t Size, typename ValueT, typename IntervalT, typename QuantityT >
+inline
+constexpr
+auto
+operator *
+(
+    const vec<UnitsT, Size>& aVec,
+    units_t<ValueT, IntervalT, QuantityT> aFactor
+)
+{
+    return transform_impl([aFactor](auto aX){return aX * aFactor;}, aVec);
+}
+
+//------------------------------------------------------------------------------
+// units_t * vec
+template< typename UnitsT, std::size_t Size, typename ValueT, typename IntervalT, typename QuantityT >
+inline
+constexpr
+auto
+operator *
+(
+    units_t<ValueT, IntervalT, QuantityT> aFactor,
+    const vec<UnitsT, Size>& aVec
+)
+{
+    return aVec * aFactor;
+}
+
+//------------------------------------------------------------------------------
+// vec * arithmetic value
+template< typename UnitsT, std::size_t Size, typename ValueT, typename = std::enable_if_t<std::is_arithmetic<ValueT>::value> >
+inline
+constexpr
+auto
+operator *
+(
+    const vec<UnitsT, Size>& aVec,
+    ValueT aFactor
+)
+{
+    return transform_impl([aFactor](auto aX){return aX * aFactor;}, aVec);
+}
+
+//------------------------------------------------------------------------------
+// arithmetic value * vec
+template< typename UnitsT, std::size_t Size, typename ValueT, typename = std::enable_if_t<std::is_arithmetic<ValueT>::value> >
+inline
+constexpr
+auto
+operator *
+(
+    ValueT aFactor,
+    const vec<UnitsT, Size>& aVec
+)
+{
+    return aVec * aFactor;
+}
+
+//------------------------------------------------------------------------------
+// vec / units_t
+template< typename UnitsT, std::size_t Size, typename ValueT, typename IntervalT, typename QuantityT >
+inline
+constexpr
+auto
+operator /
+(
+    const vec<UnitsT, Size>& aVec,
+    units_t<ValueT, IntervalT, QuantityT> aDivisor
+)
+{
+    return transform_impl([aDivisor](auto aX){return aX / aDivisor;}, aVec);
+}
+
+//------------------------------------------------------------------------------
+// vec / arithmetic value
+template< typename UnitsT, std::size_t Size, typename ValueT, typename = std::enable_if_t<std::is_arithmetic<ValueT>::value> >
+inline
+constexpr
+auto
+operator /
+(
+    const vec<UnitsT, Size>& aVec,
+    ValueT aDivisor
+)
+{
+    return transform_impl([aDivisor](auto aX){return aX / aDivisor;}, aVec);
+}
+
+//------------------------------------------------------------------------------
+/// dot product of two vecs, in the units of the product of their components
+template< typename UnitsT1, typename UnitsT2, std::size_t Size >
+inline
+constexpr
+multiply_units<UnitsT1, UnitsT2>
+dot
+(
+    const vec<UnitsT1, Size>& aLHS,
+    const vec<UnitsT2, Size>& aRHS
+)
+{
+    using Result_t = multiply_units<UnitsT1, UnitsT2>;
+    using ResultValue_t = typename Result_t::value_t;
+    ResultValue_t theSum{};
+    for( std::size_t i = 0; i < Size; ++i )
+    {
+        theSum += static_cast<ResultValue_t>(aLHS[i].value()) * static_cast<ResultValue_t>(aRHS[i].value());
+    }
+    return Result_t{theSum};
+}
+
+//------------------------------------------------------------------------------
+/// cross product of two 3-vecs, e.g. meters × newtons is newton_meters
+template< typename UnitsT1, typename UnitsT2 >
+inline
+constexpr
+vec<multiply_units<UnitsT1, UnitsT2>, 3>
+cross
+(
+    const vec<UnitsT1, 3>& aLHS,
+    const vec<UnitsT2, 3>& aRHS
+)
+{
+    using Result_t = multiply_units<UnitsT1, UnitsT2>;
+    const auto theProduct = [](auto aX, auto aY)
+    {
+        using ResultValue_t = typename Result_t::value_t;
+        return static_cast<ResultValue_t>(aX.value()) * static_cast<ResultValue_t>(aY.value());
+    };
+
+    return vec<Result_t, 3>
+    {
+        Result_t{theProduct(aLHS[1], aRHS[2]) - theProduct(aLHS[2], aRHS[1])},
+        Result_t{theProduct(aLHS[2], aRHS[0]) - theProduct(aLHS[0], aRHS[2])},
+        Result_t{theProduct(aLHS[0], aRHS[1]) - theProduct(aLHS[1], aRHS[0])}
+    };
+}
+
+//------------------------------------------------------------------------------
+/// Euclidean length of a vec, in the units of its components
+template< typename UnitsT, std::size_t Size >
+inline
+auto
+norm
+(
+    const vec<UnitsT, Size>& aVec
+)
+{
+    return square_root(dot(aVec, aVec));
+}
+
+//------------------------------------------------------------------------------
+/// unit vector in the direction of aVec
+template< typename UnitsT, std::size_t Size >
+inline
+vec<scalar<r_one, typename UnitsT::value_t>, Size>
+normalize
+(
+    const vec<UnitsT, Size>& aVec
+)
+{
+    using Result_t = scalar<r_one, typename UnitsT::value_t>;
+    const auto theNorm = units_cast<UnitsT>(norm(aVec)).value();
+    vec<Result_t, Size> theResult;
+    for( std::size_t i = 0; i < Size; ++i )
+    {
+        theResult[i] = Result_t{aVec[i].value() / theNorm};
+    }
+    return theResult;
+}
+
+//------------------------------------------------------------------------------
+/// Class vec_array stores a sequence of vecs as structure of arrays, one
+/// contiguous array per component, so that kernels over many vecs load
+/// whole SIMD registers of a single component.
+template< typename UnitsT, std::size_t Size >
+class vec_array
+{
+    static_assert(is_units_t<UnitsT>, "UnitsT must be of type si::units_t");
+
+public:
+
+    //--------------------------------------------------------------------------
+    /// Type aliases
+    using component_t = UnitsT;
+    using vec_t = vec<UnitsT, Size>;
+
+    //--------------------------------------------------------------------------
+    /// Initialize an array of aCount zero vecs.
+    explicit
+    vec_array
+    (
+        std::size_t aCount = 0
+    )
+    {
+        resize(aCount);
+    }
+
+    //--------------------------------------------------------------------------
+    // Accessor functions
+    std::size_t size() const {return mComponents[0].size();}
+    bool empty() const {return mComponents[0].empty();}
+
+    //--------------------------------------------------------------------------
+    /// the contiguous array of component aComponent of every vec
+    std::span<component_t> component(std::size_t aComponent) {return mComponents[aComponent];}
+    std::span<const component_t> component(std::size_t aComponent) const {return mComponents[aComponent];}
+
+    //--------------------------------------------------------------------------
+    /// gather the vec at aIndex
+    vec_t
+    operator[]
+    (
+        std::size_t aIndex
+    ) const
+    {
+        vec_t theResult;
+        for( std::size_t i = 0; i < Size; ++i )
+        {
+            theResult[i] = mComponents[i][aIndex];
+        }
+        return theResult;
+    }
+
+    //--------------------------------------------------------------------------
+    /// scatter aVec to aIndex
+    void
+    set
+    (
+        std::size_t aIndex,
+        const vec_t& aVec
+    )
+    {
+        for( std::size_t i = 0; i < Size; ++i )
+        {
+            mComponents[i][aIndex] = aVec[i];
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    void
+    push_back
+    (
+        const vec_t& aVec
+    )
+    {
+        for( std::size_t i = 0; i < Size; ++i )
+        {
+            mComponents[i].push_back(aVec[i]);
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    void
+    resize
+    (
+        std::size_t aCount
+    )
+    {
+        for( auto& theComponent : mComponents )
+        {
+            theComponent.resize(aCount, component_t::zero());
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    void
+    reserve
+    (
+        std::size_t aCount
+    )
+    {
+        for( auto& theComponent : mComponents )
+        {
+            theComponent.reserve(aCount);
+        }
+    }
+
+private:
+
+    std::array<std::vector<component_t>, Size> mComponents;
+
+}; // end of class vec_array
+
+//------------------------------------------------------------------------------
+/// aTarget[i] += aSource[i] * aFactor for every vec, e.g. position += velocity * dt
+template< typename UnitsT1, typename UnitsT2, std::size_t Size, typename FactorT >
+inline
+void
+add_product
+(
+    vec_array<UnitsT1, Size>& aTarget,
+    const vec_array<UnitsT2, Size>& aSource,
+    FactorT aFactor
+)
+{
+    using Product_t = decltype(UnitsT2{} * aFactor);
+    static_assert
+    (
+        std::is_same<typename Product_t::quantity_t, typename UnitsT1::quantity_t>::value,
+        "aSource * aFactor must have the quantity of aTarget"
+    );
+    assert(aTarget.size() == aSource.size());
+
+    // the conversion of the product to the target interval is a compile-time factor
+    using Value_t = typename UnitsT1::value_t;
+    const auto theFactor = static_cast<Value_t>(units_cast<UnitsT1>(UnitsT2{1} * aFactor).value());
+    for( std::size_t c = 0; c < Size; ++c )
+    {
+        const auto theTarget = aTarget.component(c);
+        const auto theSource = aSource.component(c);
+        for( std::size_t i = 0; i < theTarget.size(); ++i )
+        {
+            theTarget[i] = UnitsT1{theTarget[i].value() + static_cast<Value_t>(theSource[i].value()) * theFactor};
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+/// aResult[i] = dot(aLHS[i], aRHS[i]) for every vec
+template< typename UnitsT1, typename UnitsT2, std::size_t Size >
+inline
+void
+dot
+(
+    const vec_array<UnitsT1, Size>& aLHS,
+    const vec_array<UnitsT2, Size>& aRHS,
+    std::span<multiply_units<UnitsT1, UnitsT2>> aResult
+)
+{
+    assert(aLHS.size() == aRHS.size());
+    assert(aResult.size() >= aLHS.size());
+
+    using Result_t = multiply_units<UnitsT1, UnitsT2>;
+    using ResultValue_t = typename Result_t::value_t;
+    for( std::size_t i = 0; i < aLHS.size(); ++i )
+    {
+        aResult[i] = Result_t::zero();
+    }
+
+    for( std::size_t c = 0; c < Size; ++c )
+    {
+        const auto theLHS = aLHS.component(c);
+        const auto theRHS = aRHS.component(c);
+        for( std::size_t i = 0; i < theLHS.size(); ++i )
+        {
+            aResult[i] = Result_t
+            {
+                aResult[i].value() +
+                static_cast<ResultValue_t>(theLHS[i].value()) * static_cast<ResultValue_t>(theRHS[i].value())
+            };
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+/// aResult[i] = cross(aLHS[i], aRHS[i]) for every vec
+template< typename UnitsT1, typename UnitsT2 >
+inline
+void
+cross
+(
+    const vec_array<UnitsT1, 3>& aLHS,
+    const vec_array<UnitsT2, 3>& aRHS,
+    vec_array<multiply_units<UnitsT1, UnitsT2>, 3>& aResult
+)
+{
+    assert(aLHS.size() == aRHS.size());
+    aResult.resize(aLHS.size());
+
+    using Result_t = multiply_units<UnitsT1, UnitsT2>;
+    using ResultValue_t = typename Result_t::value_t;
+    for( std::size_t c = 0; c < 3; ++c )
+    {
+        const auto theLHS1 = aLHS.component((c + 1) % 3);
+        const auto theLHS2 = aLHS.component((c + 2) % 3);
+        const auto theRHS1 = aRHS.component((c + 1) % 3);
+        const auto theRHS2 = aRHS.component((c + 2) % 3);
+        const auto theResult = aResult.component(c);
+        for( std::size_t i = 0; i < theResult.size(); ++i )
+        {
+            theResult[i] = Result_t
+            {
+                static_cast<ResultValue_t>(theLHS1[i].value()) * static_cast<ResultValue_t>(theRHS2[i].value()) -
+                static_cast<ResultValue_t>(theLHS2[i].value()) * static_cast<ResultValue_t>(theRHS1[i].value())
+            };
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+/// aResult[i] = norm(aVecs[i]) for every vec
+template< typename UnitsT, std::size_t Size >
+inline
+void
+norm
+(
+    const vec_array<UnitsT, Size>& aVecs,
+    std::span<decltype(norm(vec<UnitsT, Size>{}))> aResult
+)
+{
+    assert(aResult.size() >= aVecs.size());
+
+    using Result_t = decltype(norm(vec<UnitsT, Size>{}));
+    using ResultValue_t = typename Result_t::value_t;
+    for( std::size_t i = 0; i < aVecs.size(); ++i )
+    {
+        aResult[i] = Result_t::zero();
+    }
+
+    // accumulate the squares in the result, then take the roots
+    for( std::size_t c = 0; c < Size; ++c )
+    {
+        const auto theComponent = aVecs.component(c);
+        for( std::size_t i = 0; i < theComponent.size(); ++i )
+        {
+            const auto theValue = static_cast<ResultValue_t>(theComponent[i].value());
+            aResult[i] = Result_t{aResult[i].value() + theValue * theValue};
+        }
+    }
+
+    // the interval of the root is the interval of the components, up to the
+    // rounding of ratio_sqrt, so convert once through a unit component
+    const auto theScale = static_cast<ResultValue_t>(units_cast<Result_t>(UnitsT{1}).value());
+    for( std::size_t i = 0; i < aVecs.size(); ++i )
+    {
+        aResult[i] = Result_t{std::sqrt(aResult[i].value()) * theScale};
+    }
+}
+
+} // end of namespace si
@@ -0,0 +1,446 @@
+#pragma once
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <limits>
+#include <numeric>
+#include <optional>
+#include <span>
+#include <type_traits>
+
+#include "units.hpp"
+
+namespace si
+{
+
+//------------------------------------------------------------------------------
+/// a view of the units_t in a buffer
+template< typename UnitsT >
+using units_span = std::span<UnitsT>;
+
+//------------------------------------------------------------------------------
+/// The wire format is a 40 byte header followed by the values in the byte
+/// order of the writer. The header is little endian:
+///
+///  offset | size | field
+///  -------|------|------------------------------------------------------
+///       0 |    4 | magic "siu1"
+///       4 |    1 | wire_value_type of the values
+///       5 |    1 | size of a value in bytes
+///       6 |    1 | byte order of the values, 1 little or 2 big endian
+///       7 |    1 | zero
+///       8 |    8 | exponents of mass, length, time, current, temperature,
+///         |      | luminous intensity, substance and angle, signed bytes
+///      16 |    8 | interval numerator
+///      24 |    8 | interval denominator
+///      32 |    8 | number of values
+///
+/// The values begin 8-byte aligned when the buffer is.
+inline constexpr std::size_t wire_header_size = 40;
+
+//------------------------------------------------------------------------------
+/// the value types of the wire format
+enum class wire_value_type : std::uint8_t
+{
+    int8 = 1,
+    uint8,
+    int16,
+    uint16,
+    int32,
+    uint32,
+    int64,
+    uint64,
+    float32,
+    float64
+};
+
+//------------------------------------------------------------------------------
+/// the wire_value_type of ValueT
+template< typename ValueT >
+constexpr
+wire_value_type
+wire_value_type_of
+(
+)
+{
+    static_assert(std::is_arithmetic<ValueT>::value && !std::is_same<ValueT, bool>::value, "the wire format requires an arithmetic value_t");
+    static_assert(!std::is_floating_point<ValueT>::value || std::numeric_limits<ValueT>::is_iec559, "the wire format requires IEEE floating point");
+    static_assert(!std::is_floating_point<ValueT>::value || sizeof(ValueT) == 4 || sizeof(ValueT) == 8, "the wire format has no long double");
+
+    if constexpr( std::is_floating_point<ValueT>::value )
+    {
+        return sizeof(ValueT) == 4 ? wire_value_type::float32 : wire_value_type::float64;
+    }
+    else
+    {
+        constexpr int theLog2Size = std::bit_width(sizeof(ValueT)) - 1;
+        return static_cast<wire_value_type>(1 + 2 * theLog2Size + (std::is_unsigned<ValueT>::value ? 1 : 0));
+    }
+}
+
+//------------------------------------------------------------------------------
+/// aValue with the order of its bytes reversed
+template< typename UIntT >
+inline
+constexpr
+UIntT
+byte_swap
+(
+    UIntT aValue
+)
+{
+    static_assert(std::is_unsigned<UIntT>::value, "UIntT must be an unsigned integer type");
+    UIntT theResult = 0;
+    for( std::size_t i = 0; i < sizeof(UIntT); ++i )
+    {
+        theResult = static_cast<UIntT>((theResult << 8) | ((aValue >> (8 * i)) & 0xff));
+    }
+    return theResult;
+}
+
+//------------------------------------------------------------------------------
+/// reverse the bytes of each aValueSize-byte value in aBytes, a loop that the
+/// compiler vectorizes into byte shuffles
+template< std::size_t aValueSize >
+inline
+void
+byte_swap_values
+(
+    std::span<std::byte> aBytes
+)
+{
+    using UInt_t = std::conditional_t<aValueSize == 1, std::uint8_t, std::conditional_t<aValueSize == 2, std::uint16_t, std::conditional_t<aValueSize == 4, std::uint32_t, std::uint64_t>>>;
+    static_assert(sizeof(UInt_t) == aValueSize, "aValueSize must be 1, 2, 4 or 8");
+    assert(aBytes.size() % aValueSize == 0);
+
+    std::byte* theBytes = aBytes.data();
+    const std::size_t theCount = aBytes.size() / aValueSize;
+    for( std::size_t i = 0; i < theCount; ++i )
+    {
+        UInt_t theValue;
+        std::memcpy(&theValue, theBytes + i * aValueSize, aValueSize);
+        theValue = byte_swap(theValue);
+        std::memcpy(theBytes + i * aValueSize, &theValue, aValueSize);
+    }
+}
+
+//------------------------------------------------------------------------------
+/// the byte order field of this machine
+inline constexpr std::uint8_t wire_native_byte_order = std::endian::native == std::endian::little ? 1 : 2;
+
+static_assert(std::endian::native == std::endian::little || std::endian::native == std::endian::big, "the wire format requires a little or big endian machine");
+
+//------------------------------------------------------------------------------
+/// write aValue little endian at aOffset of aHeader
+inline
+constexpr
+void
+put_wire_field
+(
+    std::span<std::byte> aHeader,
+    std::size_t aOffset,
+    std::uint64_t aValue
+)
+{
+    for( std::size_t i = 0; i < 8; ++i )
+    {
+        aHeader[aOffset + i] = static_cast<std::byte>(aValue >> (8 * i));
+    }
+}
+
+//------------------------------------------------------------------------------
+/// read the little endian field at aOffset of aHeader
+inline
+constexpr
+std::uint64_t
+get_wire_field
+(
+    std::span<const std::byte> aHeader,
+    std::size_t aOffset
+)
+{
+    std::uint64_t theValue = 0;
+    for( std::size_t i = 0; i < 8; ++i )
+    {
+        theValue |= static_cast<std::uint64_t>(aHeader[aOffset + i]) << (8 * i);
+    }
+    return theValue;
+}
+
+//------------------------------------------------------------------------------
+/// the header of aCount values of UnitsT in the byte order of this machine
+template< typename UnitsT >
+constexpr
+std::array<std::byte, wire_header_size>
+wire_header
+(
+    std::uint64_t aCount
+)
+{
+    static_assert(is_units_t<UnitsT>, "UnitsT must be a units_t");
+    using Value_t = typename UnitsT::value_t;
+    using Quantity_t = typename UnitsT::quantity_t;
+    using Interval_t = typename UnitsT::interval_t;
+
+    constexpr std::intmax_t theExponents[] =
+    {
+        Quantity_t::mass::value,
+        Quantity_t::length::value,
+        Quantity_t::time::value,
+        Quantity_t::current::value,
+        Quantity_t::temperature::value,
+        Quantity_t::luminous_intensity::value,
+        Quantity_t::substance::value,
+        Quantity_t::angle::value
+    };
+    static_assert(std::all_of(std::begin(theExponents), std::end(theExponents), [](std::intmax_t aExponent) {return aExponent >= -128 && aExponent <= 127;}), "the wire format requires exponents in [-128, 127]");
+
+    std::array<std::byte, wire_header_size> theHeader{};
+    theHeader[0] = std::byte{'s'};
+    theHeader[1] = std::byte{'i'};
+    theHeader[2] = std::byte{'u'};
+    theHeader[3] = std::byte{'1'};
+    theHeader[4] = static_cast<std::byte>(wire_value_type_of<Value_t>());
+    theHeader[5] = static_cast<std::byte>(sizeof(Value_t));
+    theHeader[6] = static_cast<std::byte>(wire_native_byte_order);
+    for( std::size_t i = 0; i < 8; ++i )
+    {
+        theHeader[8 + i] = static_cast<std::byte>(static_cast<std::int8_t>(theExponents[i]));
+    }
+    put_wire_field(theHeader, 16, static_cast<std::uint64_t>(Interval_t::num));
+    put_wire_field(theHeader, 24, static_cast<std::uint64_t>(Interval_t::den));
+    put_wire_field(theHeader, 32, aCount);
+    return theHeader;
+}
+
+//------------------------------------------------------------------------------
+/// the size in bytes of the wire format of aCount values of UnitsT
+template< typename UnitsT >
+constexpr
+std::size_t
+wire_size
+(
+    std::size_t aCount
+)
+{
+    return wire_header_size + aCount * sizeof(typename UnitsT::value_t);
+}
+
+//------------------------------------------------------------------------------
+/// the interval recorded in a wire_header over the interval of a units_t,
+/// reduced; the recorded values times num/den are in the units_t interval
+struct wire_interval_ratio
+{
+    std::intmax_t num;
+    std::intmax_t den;
+};
+
+//------------------------------------------------------------------------------
+/// the interval aNum/aDen over that of UnitsT; std::nullopt if the interval
+/// is not positive or the ratio overflows
+template< typename UnitsT >
+constexpr
+std::optional<wire_interval_ratio>
+wire_interval_ratio_to
+(
+    std::intmax_t aNum,
+    std::intmax_t aDen
+)
+{
+    using Interval_t = typename UnitsT::interval_t;
+    if( aNum <= 0 || aDen <= 0 )
+    {
+        return std::nullopt;
+    }
+
+    const std::intmax_t theNumGcd = std::gcd(aNum, Interval_t::num);
+    const std::intmax_t theDenGcd = std::gcd(aDen, Interval_t::den);
+    const std::intmax_t theNum1 = aNum / theNumGcd;
+    const std::intmax_t theNum2 = Interval_t::den / theDenGcd;
+    const std::intmax_t theDen1 = aDen / theDenGcd;
+    const std::intmax_t theDen2 = Interval_t::num / theNumGcd;
+    constexpr std::intmax_t theMax = std::numeric_limits<std::intmax_t>::max();
+    if( theNum1 > theMax / theNum2 || theDen1 > theMax / theDen2 )
+    {
+        return std::nullopt;
+    }
+    return wire_interval_ratio{theNum1 * theNum2, theDen1 * theDen2};
+}
+
+//------------------------------------------------------------------------------
+/// the interval recorded in aHeader over that of UnitsT
+template< typename UnitsT >
+inline
+std::optional<wire_interval_ratio>
+wire_interval_ratio_to
+(
+    std::span<const std::byte> aHeader
+)
+{
+    return wire_interval_ratio_to<UnitsT>(static_cast<std::intmax_t>(get_wire_field(aHeader, 16)), static_cast<std::intmax_t>(get_wire_field(aHeader, 24)));
+}
+
+//------------------------------------------------------------------------------
+/// aValue recorded in an interval aRatio times that of UnitsT, converted to
+/// UnitsT as units_cast converts
+template< typename UnitsT >
+inline
+constexpr
+UnitsT
+from_wire_value
+(
+    typename UnitsT::value_t aValue,
+    wire_interval_ratio aRatio
+)
+{
+    using Value_t = typename UnitsT::value_t;
+    using Result_t = common_value_t<Value_t, std::intmax_t>;
+    return UnitsT{static_cast<Value_t>(static_cast<Result_t>(aValue) * static_cast<Result_t>(aRatio.num) / static_cast<Result_t>(aRatio.den))};
+}
+
+//------------------------------------------------------------------------------
+/// true if units_t can be viewed in place in a buffer of its value_t
+template< typename UnitsT >
+constexpr bool is_wire_viewable =
+    sizeof(UnitsT) == sizeof(typename UnitsT::value_t) &&
+    alignof(UnitsT) == alignof(typename UnitsT::value_t) &&
+    std::is_trivially_copyable<UnitsT>::value &&
+    std::is_standard_layout<UnitsT>::value;
+
+//------------------------------------------------------------------------------
+/// write the header of aCount values of UnitsT to the start of aBuffer and
+/// return a view of the values that follow, for the caller to fill in place.
+/// aBuffer must hold wire_size<UnitsT>(aCount) bytes and be aligned for
+/// value_t.
+template< typename UnitsT >
+inline
+units_span<UnitsT>
+prepare_wire
+(
+    std::span<std::byte> aBuffer,
+    std::size_t aCount
+)
+{
+    static_assert(is_wire_viewable<UnitsT>, "UnitsT must have the layout of its value_t");
+    assert(aBuffer.size() >= wire_size<UnitsT>(aCount));
+    assert(reinterpret_cast<std::uintptr_t>(aBuffer.data()) % alignof(UnitsT) == 0);
+
+    const auto theHeader = wire_header<UnitsT>(aCount);
+    std::memcpy(aBuffer.data(), theHeader.data(), wire_header_size);
+    return units_span<UnitsT>{reinterpret_cast<UnitsT*>(aBuffer.data() + wire_header_size), aCount};
+}
+
+//------------------------------------------------------------------------------
+/// write aUnits in the wire format to aBuffer and return the number of bytes
+/// written
+template< typename UnitsT >
+inline
+std::size_t
+write_wire
+(
+    std::span<const UnitsT> aUnits,
+    std::span<std::byte> aBuffer
+)
+{
+    static_assert(is_wire_viewable<UnitsT>, "UnitsT must have the layout of its value_t");
+    assert(aBuffer.size() >= wire_size<UnitsT>(aUnits.size()));
+
+    const auto theHeader = wire_header<UnitsT>(aUnits.size());
+    std::memcpy(aBuffer.data(), theHeader.data(), wire_header_size);
+    if( !aUnits.empty() )
+    {
+        std::memcpy(aBuffer.data() + wire_header_size, aUnits.data(), aUnits.size_bytes());
+    }
+    return wire_size<UnitsT>(aUnits.size());
+}
+
+//------------------------------------------------------------------------------
+/// the number of values of UnitsT in aBuffer if its header describes UnitsT
+/// in byte order aByteOrder, and the values fit in aBuffer aligned. The type
+/// is checked by a single comparison of the first 32 bytes of the header.
+template< typename UnitsT >
+inline
+std::optional<std::size_t>
+check_wire
+(
+    std::span<const std::byte> aBuffer,
+    std::uint8_t aByteOrder
+)
+{
+    if( aBuffer.size() < wire_header_size )
+    {
+        return std::nullopt;
+    }
+
+    auto theExpected = wire_header<UnitsT>(0);
+    theExpected[6] = static_cast<std::byte>(aByteOrder);
+    if( std::memcmp(aBuffer.data(), theExpected.data(), 32) != 0 )
+    {
+        return std::nullopt;
+    }
+
+    const auto theCount = get_wire_field(aBuffer, 32);
+    if( theCount > (aBuffer.size() - wire_header_size) / sizeof(UnitsT) ||
+        reinterpret_cast<std::uintptr_t>(aBuffer.data()) % alignof(UnitsT) != 0 )
+    {
+        return std::nullopt;
+    }
+    return static_cast<std::size_t>(theCount);
+}
+
+//------------------------------------------------------------------------------
+/// a view of the values in aBuffer if its header describes UnitsT in the
+/// byte order of this machine, with no copy and no per-value decoding;
+/// std::nullopt otherwise
+template< typename UnitsT >
+inline
+std::optional<units_span<const UnitsT>>
+read_wire
+(
+    std::span<const std::byte> aBuffer
+)
+{
+    static_assert(is_wire_viewable<UnitsT>, "UnitsT must have the layout of its value_t");
+    const auto theCount = check_wire<UnitsT>(aBuffer, wire_native_byte_order);
+    if( !theCount )
+    {
+        return std::nullopt;
+    }
+    return units_span<const UnitsT>{reinterpret_cast<const UnitsT*>(aBuffer.data() + wire_header_size), *theCount};
+}
+
+//------------------------------------------------------------------------------
+/// a view of the values in aBuffer if its header describes UnitsT;
+/// std::nullopt otherwise. Values in the other byte order are swapped in
+/// place, and the header marked native, so that reading again is free.
+template< typename UnitsT >
+inline
+std::optional<units_span<UnitsT>>
+read_wire
+(
+    std::span<std::byte> aBuffer
+)
+{
+    static_assert(is_wire_viewable<UnitsT>, "UnitsT must have the layout of its value_t");
+    constexpr std::uint8_t theForeignByteOrder = 3 - wire_native_byte_order;
+
+    auto theCount = check_wire<UnitsT>(aBuffer, wire_native_byte_order);
+    if( !theCount )
+    {
+        theCount = check_wire<UnitsT>(aBuffer, theForeignByteOrder);
+        if( !theCount )
+        {
+            return std::nullopt;
+        }
+        byte_swap_values<sizeof(UnitsT)>(aBuffer.subspan(wire_header_size, *theCount * sizeof(UnitsT)));
+        aBuffer[6] = static_cast<std::byte>(wire_native_byte_order);
+    }
+    return units_span<UnitsT>{reinterpret_cast<UnitsT*>(aBuffer.data() + wire_header_size), *theCount};
+}
+
+} // end of namespace si